@@ -0,0 +1,139 @@
+#include <cmath>
+#include <stdexcept>
+
+#include "logger.h"
+#include "buffercalculator.h"
+
+using namespace std;
+using namespace swss;
+
+unique_ptr<BufferCalculator> BufferCalculator::create(const string &vendor)
+{
+    if (vendor == "mellanox" || vendor == "vs")
+    {
+        return unique_ptr<BufferCalculator>(new MellanoxBufferCalculator());
+    }
+
+    return nullptr;
+}
+
+// Pause quanta to be taken for each operating speed, as defined in IEEE 802.3 31B.3.7
+// key: operating speed in Mb/s, value: number of pause quanta
+static const map<long, double> pauseQuantaPerSpeed =
+{
+    { 800000, 905 },
+    { 400000, 905 },
+    { 200000, 453 },
+    { 100000, 394 },
+    { 50000, 147 },
+    { 40000, 118 },
+    { 25000, 80 },
+    { 10000, 67 },
+    { 1000, 2 },
+    { 100, 1 }
+};
+
+static double getNumber(const map<string, string> &fields, const string &name)
+{
+    auto field = fields.find(name);
+    if (field == fields.end())
+    {
+        throw out_of_range(name);
+    }
+
+    return stod(field->second);
+}
+
+static double roundUpToKb(double value)
+{
+    return ceil(value / 1024) * 1024;
+}
+
+// The calculation follows buffer_headroom_mellanox.lua step by step, in double precision as lua does,
+// so that both give the same results
+bool MellanoxBufferCalculator::calculateHeadroom(const buffer_headroom_params_t &params, const buffer_headroom_input_t &input, buffer_headroom_t &headroom) const
+{
+    const double speed_of_light = 198000000;
+    const double minimal_packet_size = 64;
+
+    try
+    {
+        double port_speed = stod(input.speed);
+        // the cable length is in format of "<number>m"
+        double cable_length = stod(input.cable_length.substr(0, input.cable_length.size() - 1));
+        double port_mtu = stod(input.port_mtu);
+        double gearbox_delay = input.gearbox_delay.empty() ? 0 : stod(input.gearbox_delay);
+
+        double cell_size = getNumber(params.asic, "cell_size");
+        double pipeline_latency = getNumber(params.asic, "pipeline_latency") * 1024;
+        double mac_phy_delay = getNumber(params.asic, "mac_phy_delay") * 1024;
+        double lossless_mtu = getNumber(params.lossless_traffic, "mtu");
+        double small_packet_percentage = getNumber(params.lossless_traffic, "small_packet_percentage");
+
+        // The peer response time is derived from the pause quanta of the speed,
+        // and the one of the ASIC table is taken for other speeds
+        double peer_response_time;
+        size_t speed_length = 0;
+        long speed_key = stol(input.speed, &speed_length);
+        auto pause_quanta = pauseQuantaPerSpeed.find(speed_key);
+        if (pause_quanta != pauseQuantaPerSpeed.end() && speed_length == input.speed.size())
+        {
+            peer_response_time = pause_quanta->second * 512 / 8;
+        }
+        else
+        {
+            peer_response_time = getNumber(params.asic, "peer_response_time") * 1024;
+        }
+
+        // kB on tile for Spectrum-4 and Spectrum-5, whose generation is the last digit of the ASIC name
+        double kb_on_tile = 0;
+        char generation = params.asic_name.empty() ? '\0' : params.asic_name.back();
+        if (generation == '4' || generation == '5')
+        {
+            kb_on_tile = port_speed / 1000 * 120 / 8;
+        }
+
+        // Adjustment for 8-lane port
+        double speed_overhead = 0;
+        if (input.lane_count == 8)
+        {
+            pipeline_latency = pipeline_latency * 2;
+            speed_overhead = port_mtu;
+        }
+
+        double worst_case_factor;
+        if (cell_size > 2 * minimal_packet_size)
+        {
+            worst_case_factor = cell_size / minimal_packet_size;
+        }
+        else
+        {
+            worst_case_factor = (2 * cell_size) / (1 + cell_size);
+        }
+        worst_case_factor = ceil(worst_case_factor);
+
+        double small_packet_percentage_by_byte = 100 * minimal_packet_size /
+            ((small_packet_percentage * minimal_packet_size + (100 - small_packet_percentage) * lossless_mtu) / 100);
+        double cell_occupancy = (100 - small_packet_percentage_by_byte + small_packet_percentage_by_byte * worst_case_factor) / 100;
+
+        double bytes_on_gearbox = port_speed * gearbox_delay / (8 * 1024);
+
+        double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / speed_of_light / (8 * 1000);
+        double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + mac_phy_delay + peer_response_time + kb_on_tile;
+
+        double xoff_value = roundUpToKb(lossless_mtu + propagation_delay * cell_occupancy);
+        double xon_value = roundUpToKb(pipeline_latency);
+        double headroom_size = roundUpToKb(input.shp_enabled ? xon_value : xoff_value + xon_value + speed_overhead);
+
+        headroom.xon = to_string(static_cast<long long>(xon_value));
+        headroom.xoff = to_string(static_cast<long long>(xoff_value));
+        headroom.size = to_string(static_cast<long long>(headroom_size));
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_INFO("Unable to calculate headroom natively: %s", e.what());
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,62 @@
+#ifndef __BUFFERCALCULATOR__
+#define __BUFFERCALCULATOR__
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace swss {
+
+#define STATE_ASIC_TABLE_NAME               "ASIC_TABLE"
+#define CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE  "LOSSLESS_TRAFFIC_PATTERN"
+
+// Parameters of the headroom model, as stored in the databases
+typedef struct {
+    // key and fields of STATE_DB.ASIC_TABLE
+    std::string asic_name;
+    std::map<std::string, std::string> asic;
+    // fields of CONFIG_DB.LOSSLESS_TRAFFIC_PATTERN
+    std::map<std::string, std::string> lossless_traffic;
+} buffer_headroom_params_t;
+
+// Inputs of a headroom calculation, the same as the arguments of the buffer_headroom_<vendor>.lua plugins
+typedef struct {
+    std::string speed;
+    std::string cable_length;
+    std::string port_mtu;
+    std::string gearbox_delay;
+    long lane_count;
+    bool shp_enabled;
+} buffer_headroom_input_t;
+
+typedef struct {
+    std::string xon;
+    std::string xoff;
+    std::string xon_offset;
+    std::string size;
+} buffer_headroom_t;
+
+// In-process implementation of the vendor specific buffer_headroom_<vendor>.lua plugin
+class BufferCalculator
+{
+public:
+    virtual ~BufferCalculator() = default;
+
+    // Returns false if the headroom can't be calculated from the parameters,
+    // in which case the lua plugin is to be used
+    virtual bool calculateHeadroom(const buffer_headroom_params_t &params, const buffer_headroom_input_t &input, buffer_headroom_t &headroom) const = 0;
+
+    // Calculator of the vendor, nullptr if the vendor only has lua plugins
+    static std::unique_ptr<BufferCalculator> create(const std::string &vendor);
+};
+
+// Model of buffer_headroom_mellanox.lua, which is shared by the virtual switch
+class MellanoxBufferCalculator : public BufferCalculator
+{
+public:
+    bool calculateHeadroom(const buffer_headroom_params_t &params, const buffer_headroom_input_t &input, buffer_headroom_t &headroom) const override;
+};
+
+}
+
+#endif /* __BUFFERCALCULATOR__ */
@@ -46,6 +46,8 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_applBufferProfileListTables{ProducerStateTable(applDb, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME), ProducerStateTable(applDb, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME)},
         m_statePortTable(stateDb, STATE_PORT_TABLE_NAME),
         m_stateBufferMaximumTable(stateDb, STATE_BUFFER_MAXIMUM_VALUE_TABLE),
+        m_stateAsicTable(stateDb, STATE_ASIC_TABLE_NAME),
+        m_cfgLosslessTrafficPatternTable(cfgDb, CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE),
         m_stateBufferPoolTable(stateDb, STATE_BUFFER_POOL_TABLE_NAME),
         m_stateBufferProfileTable(stateDb, STATE_BUFFER_PROFILE_TABLE_NAME),
         m_applPortTable(applDb, APP_PORT_TABLE_NAME),
@@ -53,6 +55,7 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_bufferPoolReady(false),
         m_bufferObjectsPending(true),
         m_bufferCompletelyInitialized(false),
+        m_headroomParamsLoaded(false),
         m_mmuSizeNumber(0)
 {
     SWSS_LOG_ENTER();
@@ -101,6 +104,12 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         }
     }
 
+    m_bufferCalculator = BufferCalculator::create(platform);
+    if (m_bufferCalculator)
+    {
+        SWSS_LOG_NOTICE("Headroom is calculated in-process for platform %s", platform.c_str());
+    }
+
     try
     {
         string headroomLuaScript = swss::loadLuaScript(headroomPluginName);
@@ -446,6 +455,7 @@ void BufferMgrDynamic::initTableHandlerMap()
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, &BufferMgrDynamic::handleBufferPortEgressProfileListTable));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_PORT_TABLE_NAME, &BufferMgrDynamic::handlePortTable));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_PORT_CABLE_LEN_TABLE_NAME, &BufferMgrDynamic::handleCableLenTable));
+    m_bufferTableHandlerMap.insert(buffer_handler_pair(CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE, &BufferMgrDynamic::handleLosslessTrafficPatternTable));
     m_bufferTableHandlerMap.insert(buffer_handler_pair(STATE_PORT_TABLE_NAME, &BufferMgrDynamic::handlePortStateTable));
 
     m_bufferSingleItemHandlerMap.insert(buffer_single_item_handler_pair(CFG_BUFFER_QUEUE_TABLE_NAME, &BufferMgrDynamic::handleSingleBufferQueueEntry));
@@ -599,6 +609,109 @@ bool BufferMgrDynamic::needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo,
 
 // Meta flows which are called by main flows
 void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
+{
+    buffer_headroom_input_t input;
+
+    input.speed = headroom.speed;
+    input.cable_length = headroom.cable_length;
+    input.port_mtu = headroom.port_mtu;
+    input.gearbox_delay = m_identifyGearboxDelay;
+    input.lane_count = headroom.lane_count;
+    input.shp_enabled = isNonZero(m_configuredSharedHeadroomPoolSize) || isNonZero(m_overSubscribeRatio);
+
+    // The headroom only depends on these, so the profiles of ports sharing them don't need to be calculated again
+    string cacheKey = input.speed + "|" + input.cable_length + "|" + input.port_mtu + "|" + input.gearbox_delay + "|"
+                      + to_string(input.lane_count) + "|" + (input.shp_enabled ? "shp" : "");
+
+    auto cached = m_headroomCache.find(cacheKey);
+    if (cached == m_headroomCache.end())
+    {
+        buffer_headroom_t result;
+        bool calculated = false;
+
+        if (m_bufferCalculator && loadHeadroomParams())
+        {
+            calculated = m_bufferCalculator->calculateHeadroom(m_headroomParams, input, result);
+        }
+
+        if (!calculated && !calculateHeadroomByLua(headroom, result))
+        {
+            return;
+        }
+
+        cached = m_headroomCache.emplace(cacheKey, result).first;
+    }
+
+    const auto &result = cached->second;
+    if (!result.xon.empty())
+        headroom.xon = result.xon;
+    if (!result.xoff.empty())
+        headroom.xoff = result.xoff;
+    if (!result.size.empty())
+        headroom.size = result.size;
+    if (!result.xon_offset.empty())
+        headroom.xon_offset = result.xon_offset;
+}
+
+// Drop the calculated headrooms and the parameters of the calculator,
+// once an input which isn't part of the cache key has changed
+void BufferMgrDynamic::invalidateHeadroomCache(const string &reason)
+{
+    if (m_headroomCache.empty() && !m_headroomParamsLoaded)
+    {
+        return;
+    }
+
+    SWSS_LOG_INFO("Headroom cache invalidated due to %s", reason.c_str());
+    m_headroomCache.clear();
+    m_headroomParamsLoaded = false;
+}
+
+// Load the parameters of the in-process headroom calculator
+// They are read again once the cache is invalidated
+bool BufferMgrDynamic::loadHeadroomParams()
+{
+    if (m_headroomParamsLoaded)
+    {
+        return true;
+    }
+
+    vector<string> keys;
+    vector<FieldValueTuple> fvs;
+
+    m_stateAsicTable.getKeys(keys);
+    if (keys.empty() || !m_stateAsicTable.get(keys[0], fvs))
+    {
+        SWSS_LOG_INFO("ASIC table isn't available for calculating headroom");
+        return false;
+    }
+    m_headroomParams.asic_name = keys[0];
+    m_headroomParams.asic.clear();
+    for (auto &fv : fvs)
+    {
+        m_headroomParams.asic[fvField(fv)] = fvValue(fv);
+    }
+
+    keys.clear();
+    fvs.clear();
+    m_cfgLosslessTrafficPatternTable.getKeys(keys);
+    if (keys.empty() || !m_cfgLosslessTrafficPatternTable.get(keys[0], fvs))
+    {
+        SWSS_LOG_INFO("Lossless traffic pattern isn't available for calculating headroom");
+        return false;
+    }
+    m_headroomParams.lossless_traffic.clear();
+    for (auto &fv : fvs)
+    {
+        m_headroomParams.lossless_traffic[fvField(fv)] = fvValue(fv);
+    }
+
+    m_headroomParamsLoaded = true;
+
+    return true;
+}
+
+bool BufferMgrDynamic::calculateHeadroomByLua(const buffer_profile_t &headroom, buffer_headroom_t &result)
 {
     // Call vendor-specific lua plugin to calculate the xon, xoff, xon_offset, size and threshold
     vector<string> keys = {};
@@ -618,7 +731,7 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
         if (ret.empty())
         {
             SWSS_LOG_WARN("Failed to calculate headroom for %s", headroom.name.c_str());
-            return;
+            return false;
         }
 
         // The format of the result:
@@ -632,19 +745,22 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
         {
             auto pairs = tokenize(i, ':');
             if (pairs[0] == "xon")
-                headroom.xon = pairs[1];
+                result.xon = pairs[1];
             if (pairs[0] == "xoff")
-                headroom.xoff = pairs[1];
+                result.xoff = pairs[1];
             if (pairs[0] == "size")
-                headroom.size = pairs[1];
+                result.size = pairs[1];
             if (pairs[0] == "xon_offset")
-                headroom.xon_offset = pairs[1];
+                result.xon_offset = pairs[1];
         }
     }
     catch (...)
     {
         SWSS_LOG_WARN("Lua scripts for headroom calculation were not executed successfully");
+        return false;
     }
+
+    return true;
 }
 
 // This function is designed to fetch the sizes of shared buffer pool and shared headroom pool
@@ -2014,6 +2130,15 @@ bool BufferMgrDynamic::isSharedHeadroomPoolEnabledInSai()
     return true;
 }
 
+task_process_status BufferMgrDynamic::handleLosslessTrafficPatternTable(KeyOpFieldsValuesTuple &tuple)
+{
+    // The lossless MTU and small packet percentage are read by the headroom calculation,
+    // the headrooms calculated from now on take the new values
+    invalidateHeadroomCache("lossless traffic pattern update");
+
+    return task_process_status::task_success;
+}
+
 task_process_status BufferMgrDynamic::handleCableLenTable(KeyOpFieldsValuesTuple &tuple)
 {
     string op = kfvOp(tuple);
@@ -2045,6 +2170,7 @@ task_process_status BufferMgrDynamic::handleCableLenTable(KeyOpFieldsValuesTuple
             }
 
             portInfo.cable_length = cable_length;
+            invalidateHeadroomCache("cable length update");
             if (effectiveSpeed.empty())
             {
                 SWSS_LOG_WARN("Speed for %s hasn't been configured yet, unable to calculate headroom", port.c_str());
@@ -2200,6 +2326,7 @@ task_process_status BufferMgrDynamic::handlePortTable(KeyOpFieldsValuesTuple &tu
                     auto old_mtu = move(portInfo.mtu);
                     mtu_updated = true;
                     portInfo.mtu = fvValue(i);
+                    invalidateHeadroomCache("MTU update");
                     SWSS_LOG_INFO("Port %s: MTU updated from %s to %s", port.c_str(), old_mtu.c_str(), portInfo.mtu.c_str());
                 }
             }
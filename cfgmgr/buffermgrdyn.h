@@ -4,8 +4,10 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "buffercalculator.h"
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -244,6 +246,8 @@ private:
     Table m_cfgDefaultLosslessBufferParam;
     Table m_cfgDeviceMetaDataTable;
     Table m_stateBufferMaximumTable;
+    Table m_stateAsicTable;
+    Table m_cfgLosslessTrafficPatternTable;
 
     Table m_applPortTable;
 
@@ -258,6 +262,16 @@ private:
     std::string m_bufferpoolSha;
     std::string m_checkHeadroomSha;
 
+    // In-process headroom calculator of the vendor, the lua plugin is used if there is none
+    // or if it can't calculate the headroom from the parameters
+    std::unique_ptr<BufferCalculator> m_bufferCalculator;
+    // Parameters of the calculator, loaded once they are available and again after an invalidation
+    buffer_headroom_params_t m_headroomParams;
+    bool m_headroomParamsLoaded;
+    // Calculated headrooms
+    // key: speed, cable length, mtu, gearbox delay, lane count and whether shared headroom pool is enabled
+    std::map<std::string, buffer_headroom_t> m_headroomCache;
+
     // Parameters for headroom generation
     std::string m_mmuSize;
     unsigned long m_mmuSizeNumber;
@@ -292,6 +306,9 @@ private:
     // Meta flows
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
     void calculateHeadroomSize(buffer_profile_t &headroom);
+    bool loadHeadroomParams();
+    void invalidateHeadroomCache(const std::string &reason);
+    bool calculateHeadroomByLua(const buffer_profile_t &headroom, buffer_headroom_t &result);
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
     void recalculateSharedBufferPool();
     task_process_status allocateProfile(const std::string &speed, const std::string &cable, const std::string &mtu, const std::string &threshold, const std::string &gearbox_model, long lane_count, std::string &profile_name);
@@ -321,6 +338,7 @@ private:
     task_process_status handleBufferMaxParam(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleDefaultLossLessBufferParam(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleCableLenTable(KeyOpFieldsValuesTuple &tuple);
+    task_process_status handleLosslessTrafficPatternTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handlePortStateTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handlePortTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleBufferPoolTable(KeyOpFieldsValuesTuple &tuple);
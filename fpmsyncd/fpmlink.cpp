@@ -9,6 +9,11 @@
 using namespace swss;
 using namespace std;
 
+/* Max number of socket reads per readData() call in high-throughput mode */
+#define FPM_DRAIN_READS 32
+/* Socket receive buffer in high-throughput mode, absorbs full-table bursts */
+#define FPM_HIGH_THROUGHPUT_RCVBUF (16 * 1024 * 1024)
+
 void netlink_parse_rtattr(struct rtattr **tb, int max, struct rtattr *rta,
         int len)
 {
@@ -119,7 +124,9 @@ FpmLink::FpmLink(RouteSync *rsync, unsigned short port) :
     MSG_BATCH_SIZE(256),
     m_bufSize(FPM_MAX_MSG_LEN * MSG_BATCH_SIZE),
     m_messageBuffer(NULL),
+    m_start(0),
     m_pos(0),
+    m_highThroughput(false),
     m_connected(false),
     m_server_up(false),
     m_routesync(rsync)
@@ -201,25 +208,71 @@ int FpmLink::getFd()
     return m_connection_socket;
 }
 
+void FpmLink::setHighThroughputMode(bool enabled)
+{
+    m_highThroughput = enabled;
+    if (!enabled)
+    {
+        return;
+    }
+
+    /* Set on the listening socket so that the accepted connection inherits it */
+    int rcvbuf = FPM_HIGH_THROUGHPUT_RCVBUF;
+    if (setsockopt(m_server_socket, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) < 0)
+    {
+        SWSS_LOG_WARN("Failed to set FPM socket receive buffer to %d: %s", rcvbuf, strerror(errno));
+    }
+
+    SWSS_LOG_NOTICE("FPM high-throughput mode enabled");
+}
+
 uint64_t FpmLink::readData()
 {
-    fpm_msg_hdr_t *hdr;
-    size_t msg_len;
-    size_t start = 0, left;
     ssize_t read;
+    int reads = 0;
 
-    read = ::read(m_connection_socket, m_messageBuffer + m_pos, m_bufSize - m_pos);
-    if (read == 0)
-        throw FpmConnectionClosedException();
-    if (read < 0)
-        throw system_error(errno, system_category());
-    m_pos+= (uint32_t)read;
+    do
+    {
+        /*
+         * Messages are parsed in place, so keep room for at least one full
+         * message at the tail: the leftover is only moved back to the start
+         * when the tail runs short, not after every read.
+         */
+        if (m_bufSize - m_pos < FPM_MAX_MSG_LEN)
+        {
+            memmove(m_messageBuffer, m_messageBuffer + m_start, m_pos - m_start);
+            m_pos -= m_start;
+            m_start = 0;
+        }
+
+        /* Only the first read may block, the next ones drain what is already queued */
+        read = ::recv(m_connection_socket, m_messageBuffer + m_pos, m_bufSize - m_pos,
+                      reads ? MSG_DONTWAIT : 0);
+        if (read < 0 && reads && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (read == 0)
+            throw FpmConnectionClosedException();
+        if (read < 0)
+            throw system_error(errno, system_category());
+        m_pos += (uint32_t)read;
+
+        processBufferedMessages();
+    } while (m_highThroughput && ++reads < FPM_DRAIN_READS);
+
+    return 0;
+}
+
+void FpmLink::processBufferedMessages()
+{
+    fpm_msg_hdr_t *hdr;
+    size_t msg_len;
+    size_t left;
 
     /* Check for complete messages */
     while (true)
     {
-        hdr = reinterpret_cast<fpm_msg_hdr_t *>(static_cast<void *>(m_messageBuffer + start));
-        left = m_pos - start;
+        hdr = reinterpret_cast<fpm_msg_hdr_t *>(static_cast<void *>(m_messageBuffer + m_start));
+        left = m_pos - m_start;
         if (left < FPM_MSG_HDR_LEN)
         {
             break;
@@ -239,12 +292,14 @@ uint64_t FpmLink::readData()
 
         processFpmMessage(hdr);
 
-        start += msg_len;
+        m_start += (uint32_t)msg_len;
     }
 
-    memmove(m_messageBuffer, m_messageBuffer + start, m_pos - start);
-    m_pos = m_pos - (uint32_t)start;
-    return 0;
+    if (m_start == m_pos)
+    {
+        m_start = 0;
+        m_pos = 0;
+    }
 }
 
 void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
@@ -260,6 +315,11 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
     /* Read all netlink messages inside FPM message */
     for (; NLMSG_OK (nl_hdr, msg_len); nl_hdr = NLMSG_NEXT(nl_hdr, msg_len))
     {
+        if (m_highThroughput && m_routesync->onRouteMsgDirect(nl_hdr))
+        {
+            continue;
+        }
+
         /*
          * EVPN Type5 Add Routes need to be process in Raw mode as they contain
          * RMAC, VLAN and L3VNI information.
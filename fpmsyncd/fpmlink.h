@@ -44,14 +44,30 @@ public:
 
     void processFpmMessage(fpm_msg_hdr_t* hdr);
 
+    /*
+     * High-throughput mode: drain the socket on each readData() call and
+     * parse plain IP routes without libnl objects.
+     */
+    void setHighThroughputMode(bool enabled);
+
+    bool isHighThroughputMode() const
+    {
+        return m_highThroughput;
+    }
+
     bool send(nlmsghdr* nl_hdr) override;
 
 private:
+    /* Process complete messages buffered in [m_start, m_pos) */
+    void processBufferedMessages();
+
     RouteSync *m_routesync;
     unsigned int m_bufSize;
     char *m_messageBuffer;
     char *m_sendBuffer;
+    unsigned int m_start;
     unsigned int m_pos;
+    bool m_highThroughput;
 
     bool m_connected;
     bool m_server_up;
@@ -1,3 +1,4 @@
+#include <getopt.h>
 #include <iostream>
 #include <inttypes.h>
 #include "logger.h"
@@ -24,6 +25,11 @@ static int gSelectTimeout;
 static int gFlushTimeout = FLUSH_TIMEOUT;
 // consider the traffic is small if pipeline contains < 500 entries
 #define SMALL_TRAFFIC 500
+// flush once this many entries are pending, even if the pipeline was flushed recently
+static size_t gFlushBatch = ROUTE_SYNC_PPL_SIZE;
+static bool gHighThroughput = false;
+// route coalescing window in milliseconds, 0 disables coalescing
+static uint32_t gCoalesceWindow = 0;
 
 /**
  * @brief fpmsyncd invokes redispipeline's flush with a timer
@@ -69,10 +75,77 @@ static bool eoiuFlagsSet(Table &bgpStateTable)
     return true;
 }
 
+static void usage()
+{
+    cout << "Usage: fpmsyncd [-t] [-b flush_batch] [-l flush_latency] [-c coalesce_window]" << endl;
+    cout << "    -t: high-throughput mode, drain the FPM socket on each read and parse" << endl;
+    cout << "        routes straight from the netlink messages" << endl;
+    cout << "    -b flush_batch: flush APPL_DB pipeline once this many entries are pending" << endl;
+    cout << "                    (default " << ROUTE_SYNC_PPL_SIZE << ")" << endl;
+    cout << "    -l flush_latency: max time in milliseconds an entry waits in the pipeline" << endl;
+    cout << "                      (default " << FLUSH_TIMEOUT << ")" << endl;
+    cout << "    -c coalesce_window: hold route updates for up to this many milliseconds and" << endl;
+    cout << "                        write only the last one of each route (default 0, disabled)" << endl;
+    cout << "    -h: print this message" << endl;
+}
+
 int main(int argc, char **argv)
 {
     swss::Logger::linkToDbNative("fpmsyncd");
 
+    int opt;
+    while ((opt = getopt(argc, argv, "tb:l:c:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 't':
+            gHighThroughput = true;
+            break;
+        case 'b':
+        {
+            int batch = atoi(optarg);
+            if (batch <= 0)
+            {
+                cerr << "Invalid flush batch " << optarg << endl;
+                usage();
+                return EXIT_FAILURE;
+            }
+            gFlushBatch = (size_t)batch;
+            break;
+        }
+        case 'l':
+            gFlushTimeout = atoi(optarg);
+            if (gFlushTimeout <= 0)
+            {
+                cerr << "Invalid flush latency " << optarg << endl;
+                usage();
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'c':
+        {
+            int window = atoi(optarg);
+            if (window < 0)
+            {
+                cerr << "Invalid coalesce window " << optarg << endl;
+                usage();
+                return EXIT_FAILURE;
+            }
+            gCoalesceWindow = (uint32_t)window;
+            break;
+        }
+        case 'h':
+            usage();
+            return 0;
+        default: /* '?' */
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    SWSS_LOG_NOTICE("Pipeline flush batch %zu, latency %d ms%s", gFlushBatch, gFlushTimeout,
+                    gHighThroughput ? ", high-throughput mode" : "");
+
     const auto routeResponseChannelName = std::string("APPL_DB_") + APP_ROUTE_TABLE_NAME + "_RESPONSE_CHANNEL";
 
     DBConnector db("APPL_DB", 0);
@@ -108,11 +181,17 @@ int main(int argc, char **argv)
         sync.setSuppressionEnabled(true);
     }
 
+    if (gCoalesceWindow)
+    {
+        sync.setCoalesceWindow(gCoalesceWindow);
+    }
+
     while (true)
     {
         try
         {
             FpmLink fpm(&sync);
+            fpm.setHighThroughputMode(gHighThroughput);
 
             Select s;
             SelectableTimer warmStartTimer(timespec{0, 0});
@@ -125,6 +204,7 @@ int main(int argc, char **argv)
              * Pipeline should be flushed right away to deal with state pending
              * from previous try/catch iterations.
              */
+            sync.flushCoalescedRoutes(true);
             pipeline.flush();
 
             cout << "Waiting for fpm-client connection..." << endl;
@@ -310,7 +390,16 @@ int main(int argc, char **argv)
                 }
                 else if (!warmStartEnabled || sync.getWarmStartHelper().isReconciled())
                 {
+                    int coalesceTimeout = sync.flushCoalescedRoutes();
+
                     flushPipeline(pipeline);
+
+                    // wake up in time to write the next coalesced routes
+                    if (coalesceTimeout != INFINITE &&
+                        (gSelectTimeout == INFINITE || coalesceTimeout < gSelectTimeout))
+                    {
+                        gSelectTimeout = coalesceTimeout;
+                    }
                 }
             }
         }
@@ -336,9 +425,10 @@ void flushPipeline(RedisPipeline& pipeline) {
 
     // flush the pipeline if
     // 1. traffic is not scaled (only prevent fpmsyncd from flushing ppl too frequently in the scaled case)
-    // 2. the idle time since last flush has exceeded gFlushTimeout
-    // 3. idle <= 0, due to system clock drift, should not happen since we already use steady_clock for timing
-    if (remaining < SMALL_TRAFFIC || idle >= gFlushTimeout || idle <= 0) {
+    // 2. a full batch of gFlushBatch entries is pending
+    // 3. the idle time since last flush has exceeded gFlushTimeout
+    // 4. idle <= 0, due to system clock drift, should not happen since we already use steady_clock for timing
+    if (remaining < SMALL_TRAFFIC || remaining >= gFlushBatch || idle >= gFlushTimeout || idle <= 0) {
 
         pipeline.flush();
 
@@ -13,6 +13,7 @@
 #include "macaddress.h"
 #include "converter.h"
 #include <string.h>
+#include <inttypes.h>
 #include <arpa/inet.h>
 #include <linux/nexthop.h>
 
@@ -170,7 +171,14 @@ void RouteSync::setRouteWithWarmRestart(FieldValueTupleWrapperBase & fvw,
 
     if (!warmRestartInProgress)
     {
-        table.set(fvw.KeyOpFieldsValuesTupleVector());
+        if (isCoalesced(table))
+        {
+            coalesceRoute(std::move(fvw.KeyOpFieldsValuesTupleVector()[0]));
+        }
+        else
+        {
+            table.set(fvw.KeyOpFieldsValuesTupleVector());
+        }
     }
     else
     {
@@ -189,12 +197,109 @@ void RouteSync::delWithWarmRestart(FieldValueTupleWrapperBase && fvw,
 				   ProducerStateTable & table) {
     bool warmRestartInProgress = m_warmStartHelper.inProgress();
     if (!warmRestartInProgress) {
-        table.del(fvw.key);
+        if (isCoalesced(table)) {
+            coalesceRoute(fvw.KeyOpFieldsValuesTupleVectorForDel());
+        } else {
+            table.del(fvw.key);
+        }
     } else {
         m_warmStartHelper.insertRefreshMap(fvw.KeyOpFieldsValuesTupleVectorForDel());
     }
 }
 
+void RouteSync::setCoalesceWindow(uint32_t window_ms)
+{
+    SWSS_LOG_ENTER();
+
+    if (window_ms == 0)
+    {
+        flushCoalescedRoutes(true);
+    }
+
+    m_coalesceWindow = chrono::milliseconds(window_ms);
+
+    SWSS_LOG_NOTICE("Route coalescing window is %u ms", window_ms);
+}
+
+bool RouteSync::isCoalesced(const ProducerStateTable &table) const
+{
+    return m_coalesceWindow.count() != 0 && &table == m_routeTable.get();
+}
+
+void RouteSync::coalesceRoute(KeyOpFieldsValuesTuple &&update)
+{
+    const string &key = kfvKey(update);
+    auto it = m_pendingRoutes.find(key);
+    if (it == m_pendingRoutes.end())
+    {
+        m_pendingOrder.push_back(key);
+        PendingRoute &pending = m_pendingRoutes[key];
+        pending.update = std::move(update);
+        pending.since = chrono::steady_clock::now();
+        m_coalesceCounters.buffered++;
+    }
+    else
+    {
+        /* Last writer wins, the route keeps its place and deadline */
+        SWSS_LOG_DEBUG("Route %s %s replaces held %s", key.c_str(), kfvOp(update).c_str(),
+                       kfvOp(it->second.update).c_str());
+        it->second.update = std::move(update);
+        m_coalesceCounters.suppressed++;
+    }
+}
+
+int RouteSync::flushCoalescedRoutes(bool force)
+{
+    auto now = chrono::steady_clock::now();
+    vector<KeyOpFieldsValuesTuple> sets;
+    size_t dels = 0;
+
+    while (!m_pendingOrder.empty())
+    {
+        auto it = m_pendingRoutes.find(m_pendingOrder.front());
+        auto due = it->second.since + m_coalesceWindow;
+        if (!force && due > now)
+        {
+            break;
+        }
+
+        if (kfvOp(it->second.update) == SET_COMMAND)
+        {
+            sets.push_back(std::move(it->second.update));
+        }
+        else
+        {
+            m_routeTable->del(it->first);
+            dels++;
+        }
+
+        m_pendingRoutes.erase(it);
+        m_pendingOrder.pop_front();
+    }
+
+    if (!sets.empty())
+    {
+        m_routeTable->set(sets);
+    }
+
+    if (!sets.empty() || dels)
+    {
+        m_coalesceCounters.flushed += sets.size() + dels;
+        SWSS_LOG_INFO("Flushed %zu coalesced route updates, held %" PRIu64 " suppressed %" PRIu64 " flushed %" PRIu64,
+                      sets.size() + dels, m_coalesceCounters.buffered, m_coalesceCounters.suppressed,
+                      m_coalesceCounters.flushed);
+    }
+
+    if (m_pendingOrder.empty())
+    {
+        return -1;
+    }
+
+    auto due = m_pendingRoutes.find(m_pendingOrder.front())->second.since + m_coalesceWindow;
+    auto wait = chrono::duration_cast<chrono::milliseconds>(due - now).count() + 1;
+    return (int)wait;
+}
+
 char *RouteSync::prefixMac2Str(char *mac, char *buf, int size)
 {
     char *ptr = buf;
@@ -1738,36 +1843,13 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     string mpls_list;
     string weights;
 
-    string nhg_id_key;
     uint32_t nhg_id = rtnl_route_get_nh_id(route_obj);
     if(nhg_id)
     {
-        const auto itg = m_nh_groups.find(nhg_id);
-        if(itg == m_nh_groups.end())
+        if (!fillNextHopGroupFields(fvw, nhg_id, rtnl_route_get_family(route_obj), destipprefix))
         {
-            SWSS_LOG_ERROR("NextHop group id %d not found. Dropping the route %s", nhg_id, destipprefix);
             return;
         }
-        NextHopGroup& nhg = itg->second;
-        if(nhg.group.size() == 0)
-        {
-        // Using route-table only for single next-hop
-        string nexthops = nhg.nexthop.empty() ? (rtnl_route_get_family(route_obj) == AF_INET ? "0.0.0.0" : "::") : nhg.nexthop;
-        string ifnames, weights;
-
-        getNextHopGroupFields(nhg, nexthops, ifnames, weights, rtnl_route_get_family(route_obj));
-
-        fvw.nexthop = std::move(nexthops);
-        fvw.ifname = std::move(ifnames);
-
-        SWSS_LOG_DEBUG("NextHop group id %d is a single nexthop address. Filling the route table %s with nexthop and ifname", nhg_id, destipprefix);
-        }
-        else
-        {
-            nhg_id_key = getNextHopGroupKeyAsString(nhg_id);
-            fvw.nexthop_group = std::move(nhg_id_key);
-            installNextHopGroup(nhg_id);
-        }
     }
     else
     {
@@ -1842,6 +1924,311 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     }
 }
 
+/*
+ * Fill the next hop fields of a route using a next hop group
+ * @arg fvw             Route table entry
+ * @arg nhg_id          Next hop group id
+ * @arg family          Address family of the route
+ * @arg destipprefix    Route key, for logging
+ *
+ * Return false if the group is unknown and the route has to be dropped
+ */
+bool RouteSync::fillNextHopGroupFields(RouteTableFieldValueTupleWrapper &fvw, uint32_t nhg_id,
+                                       uint8_t family, const char *destipprefix)
+{
+    const auto itg = m_nh_groups.find(nhg_id);
+    if(itg == m_nh_groups.end())
+    {
+        SWSS_LOG_ERROR("NextHop group id %d not found. Dropping the route %s", nhg_id, destipprefix);
+        return false;
+    }
+    NextHopGroup& nhg = itg->second;
+    if(nhg.group.size() == 0)
+    {
+        // Using route-table only for single next-hop
+        string nexthops = nhg.nexthop.empty() ? (family == AF_INET ? "0.0.0.0" : "::") : nhg.nexthop;
+        string ifnames, weights;
+
+        getNextHopGroupFields(nhg, nexthops, ifnames, weights, family);
+
+        fvw.nexthop = std::move(nexthops);
+        fvw.ifname = std::move(ifnames);
+
+        SWSS_LOG_DEBUG("NextHop group id %d is a single nexthop address. Filling the route table %s with nexthop and ifname", nhg_id, destipprefix);
+    }
+    else
+    {
+        fvw.nexthop_group = getNextHopGroupKeyAsString(nhg_id);
+        installNextHopGroup(nhg_id);
+    }
+
+    return true;
+}
+
+const string& RouteSync::getProtocolName(uint8_t proto)
+{
+    string &name = m_protocolNames[proto];
+    if (name.empty())
+    {
+        name = getProtocolString(proto);
+    }
+    return name;
+}
+
+/*
+ * appendNextHop() - appends one next hop to the reusable next hop buffers
+ * @arg family        Address family of the route
+ * @arg gw            RTA_GATEWAY attribute of the next hop, may be NULL
+ * @arg if_index      Next hop interface index
+ * @arg weight        Next hop weight, 0 for the default weight
+ *
+ * Return false if the gateway is not an address of the route family
+ */
+bool RouteSync::appendNextHop(int family, struct rtattr *gw, int if_index, uint8_t weight)
+{
+    char gw_ip[MAX_ADDR_SIZE + 1] = {0};
+
+    if (gw)
+    {
+        size_t addr_len = (family == AF_INET) ? IPV4_MAX_BYTE : IPV6_MAX_BYTE;
+        if (RTA_PAYLOAD(gw) != addr_len || !inet_ntop(family, RTA_DATA(gw), gw_ip, MAX_ADDR_SIZE))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        strcpy(gw_ip, (family == AF_INET6) ? "::" : "0.0.0.0");
+    }
+
+    char if_name[IFNAMSIZ] = "0";
+    if (!getIfName(if_index, if_name, IFNAMSIZ))
+    {
+        strcpy(if_name, "unknown");
+    }
+
+    if (!m_gwBuf.empty())
+    {
+        m_gwBuf += NHG_DELIMITER;
+        m_intfBuf += NHG_DELIMITER;
+        m_wtBuf += NHG_DELIMITER;
+    }
+    m_gwBuf += gw_ip;
+    m_intfBuf += if_name;
+    m_wtBuf += to_string(weight ? weight : 1);
+
+    return true;
+}
+
+/*
+ * Handle regular route (include VRF route) straight from the netlink message
+ * @arg h               Netlink message
+ *
+ * Same as onMsg()/onRouteMsg() for IPv4 and IPv6 routes, without converting the
+ * message to a libnl route object: the attributes are read in place and the
+ * next hop lists are built in buffers reused across messages.
+ *
+ * Return false, before any side effect, if the message needs the libnl path:
+ * non IP families, VNET routes, routes without destination or next hops and
+ * routes with MPLS or encapsulated next hops.
+ */
+bool RouteSync::onRouteMsgDirect(struct nlmsghdr *h)
+{
+    if (h->nlmsg_type != RTM_NEWROUTE && h->nlmsg_type != RTM_DELROUTE)
+    {
+        return false;
+    }
+
+    int len = (int)(h->nlmsg_len - NLMSG_LENGTH(sizeof(struct rtmsg)));
+    if (len < 0)
+    {
+        return false;
+    }
+
+    struct rtmsg *rtm = (struct rtmsg *)NLMSG_DATA(h);
+    int family = rtm->rtm_family;
+    if (family != AF_INET && family != AF_INET6)
+    {
+        return false;
+    }
+
+    struct rtattr *tb[RTA_MAX + 1] = {0};
+    netlink_parse_rtattr(tb, RTA_MAX, RTM_RTA(rtm), len);
+
+    size_t addr_len = (family == AF_INET) ? IPV4_MAX_BYTE : IPV6_MAX_BYTE;
+    if (!tb[RTA_DST] || RTA_PAYLOAD(tb[RTA_DST]) != addr_len)
+    {
+        return false;
+    }
+
+    if (tb[RTA_ENCAP] || tb[RTA_ENCAP_TYPE] || tb[RTA_VIA] || tb[RTA_NEWDST])
+    {
+        return false;
+    }
+
+    /* The table id is the index of the master device, 0 for the default vrf */
+    uint32_t table = tb[RTA_TABLE] ? *(uint32_t *)RTA_DATA(tb[RTA_TABLE]) : rtm->rtm_table;
+    char master_name[IFNAMSIZ] = {0};
+    if (table)
+    {
+        getIfName((int)table, master_name, IFNAMSIZ);
+        if (!strncmp(master_name, VNET_PREFIX, strlen(VNET_PREFIX)))
+        {
+            return false;
+        }
+    }
+
+    uint32_t nhg_id = tb[RTA_NH_ID] ? *(uint32_t *)RTA_DATA(tb[RTA_NH_ID]) : 0;
+    bool parse_nexthops = h->nlmsg_type == RTM_NEWROUTE && rtm->rtm_type == RTN_UNICAST && !nhg_id;
+
+    if (parse_nexthops)
+    {
+        m_gwBuf.clear();
+        m_intfBuf.clear();
+        m_wtBuf.clear();
+
+        if (tb[RTA_MULTIPATH])
+        {
+            struct rtnexthop *rtnh = (struct rtnexthop *)RTA_DATA(tb[RTA_MULTIPATH]);
+            int nh_len = (int)RTA_PAYLOAD(tb[RTA_MULTIPATH]);
+            struct rtattr *subtb[RTA_MAX + 1];
+
+            while (nh_len >= (int)sizeof(*rtnh) && rtnh->rtnh_len >= sizeof(*rtnh) && rtnh->rtnh_len <= nh_len)
+            {
+                memset(subtb, 0, sizeof(subtb));
+                netlink_parse_rtattr(subtb, RTA_MAX, RTNH_DATA(rtnh),
+                                     (int)(rtnh->rtnh_len - sizeof(*rtnh)));
+
+                if (subtb[RTA_ENCAP] || subtb[RTA_ENCAP_TYPE] || subtb[RTA_VIA] || subtb[RTA_NEWDST])
+                {
+                    return false;
+                }
+
+                if (!appendNextHop(family, subtb[RTA_GATEWAY], rtnh->rtnh_ifindex, rtnh->rtnh_hops))
+                {
+                    return false;
+                }
+
+                nh_len -= NLMSG_ALIGN(rtnh->rtnh_len);
+                rtnh = RTNH_NEXT(rtnh);
+            }
+        }
+        else if (tb[RTA_GATEWAY] || tb[RTA_OIF])
+        {
+            int if_index = tb[RTA_OIF] ? *(int *)RTA_DATA(tb[RTA_OIF]) : 0;
+            if (!appendNextHop(family, tb[RTA_GATEWAY], if_index, 0))
+            {
+                return false;
+            }
+        }
+
+        if (m_gwBuf.empty())
+        {
+            return false;
+        }
+    }
+
+    /* Same format as nl_addr2str(): no prefix length for host routes */
+    char prefix[MAX_ADDR_SIZE + 1] = {0};
+    inet_ntop(family, RTA_DATA(tb[RTA_DST]), prefix, MAX_ADDR_SIZE);
+    if (rtm->rtm_dst_len != addr_len * 8)
+    {
+        size_t prefix_len = strlen(prefix);
+        snprintf(prefix + prefix_len, sizeof(prefix) - prefix_len, "/%u", rtm->rtm_dst_len);
+    }
+
+    char destipprefix[IFNAMSIZ + MAX_ADDR_SIZE + 2] = {0};
+    if (table)
+    {
+        if (memcmp(master_name, VRF_PREFIX, strlen(VRF_PREFIX)))
+        {
+            if(memcmp(master_name, MGMT_VRF_PREFIX, strlen(MGMT_VRF_PREFIX)))
+            {
+                SWSS_LOG_ERROR("Invalid VRF name %s (ifindex %u)", master_name, table);
+            }
+            else
+            {
+                SWSS_LOG_INFO("Skip routes for Mgmt VRF name %s (ifindex %u) prefix: %s", master_name,
+                        table, prefix);
+            }
+            return true;
+        }
+        snprintf(destipprefix, sizeof(destipprefix), "%s:%s", master_name, prefix);
+    }
+    else
+    {
+        memcpy(destipprefix, prefix, strlen(prefix));
+    }
+
+    if (h->nlmsg_type == RTM_DELROUTE)
+    {
+        SWSS_LOG_INFO("RouteTable del msg: %s", destipprefix);
+        delWithWarmRestart(RouteTableFieldValueTupleWrapper{destipprefix, ""},
+                           *m_routeTable);
+        return true;
+    }
+
+    if (!isSuppressionEnabled())
+    {
+        sendOffloadReply(h);
+    }
+
+    switch (rtm->rtm_type)
+    {
+        case RTN_BLACKHOLE:
+        {
+            SWSS_LOG_INFO("RouteTable set blackhole msg: %s", destipprefix);
+            RouteTableFieldValueTupleWrapper fvw {destipprefix, string(getProtocolName(rtm->rtm_protocol))};
+            fvw.blackhole = "true";
+            setRouteWithWarmRestart(fvw, *m_routeTable);
+            return true;
+        }
+        case RTN_UNICAST:
+            break;
+
+        case RTN_MULTICAST:
+        case RTN_BROADCAST:
+        case RTN_LOCAL:
+            SWSS_LOG_INFO("BUM routes aren't supported yet (%s)", destipprefix);
+            return true;
+
+        default:
+            return true;
+    }
+
+    RouteTableFieldValueTupleWrapper fvw {destipprefix, string(getProtocolName(rtm->rtm_protocol))};
+
+    if (nhg_id)
+    {
+        if (fillNextHopGroupFields(fvw, nhg_id, rtm->rtm_family, destipprefix))
+        {
+            setRouteWithWarmRestart(fvw, *m_routeTable);
+            SWSS_LOG_INFO("RouteTable set msg with NHG: %s nhg_id:%d", destipprefix, nhg_id);
+        }
+        return true;
+    }
+
+    if (m_intfBuf == "eth0" || m_intfBuf == "docker0")
+    {
+        SWSS_LOG_DEBUG("Skip routes to eth0 or docker0: %s %s %s",
+                    destipprefix, m_gwBuf.c_str(), m_intfBuf.c_str());
+        SWSS_LOG_INFO("RouteTable del msg for eth0/docker0 route: %s", destipprefix);
+        delWithWarmRestart(RouteTableFieldValueTupleWrapper{destipprefix, ""},
+                           *m_routeTable);
+        return true;
+    }
+
+    fvw.nexthop = m_gwBuf;
+    fvw.ifname = m_intfBuf;
+    fvw.weight = m_wtBuf;
+
+    setRouteWithWarmRestart(fvw, *m_routeTable);
+    SWSS_LOG_INFO("RouteTable set msg: %s nexthop:%s ifname:%s mpls:na weight:%s",
+                  destipprefix, m_gwBuf.c_str(), m_intfBuf.c_str(), m_wtBuf.c_str());
+
+    return true;
+}
+
 /*
  * Handle Nexthop msg
  * @arg nlmsghdr      Netlink messaged
@@ -2620,6 +3007,9 @@ void RouteSync::markRoutesOffloaded(swss::DBConnector& db)
 {
     SWSS_LOG_ENTER();
 
+    /* Offload state is read back from the table, write held routes first */
+    flushCoalescedRoutes(true);
+
     sendOffloadReply(db, APP_ROUTE_TABLE_NAME);
 }
 
@@ -2632,6 +3022,8 @@ void RouteSync::onWarmStartEnd(DBConnector& applStateDb)
         markRoutesOffloaded(applStateDb);
     }
 
+    flushCoalescedRoutes(true);
+
     if (m_warmStartHelper.inProgress())
     {
         m_warmStartHelper.reconcile();
@@ -2693,6 +3085,9 @@ void RouteSync::deleteNextHopGroup(uint32_t nh_id)
 
     if(nhg.installed)
     {
+        /* Held routes may still refer to the group, write them before it goes away */
+        flushCoalescedRoutes(true);
+
         string key = getNextHopGroupKeyAsString(nh_id);
         SWSS_LOG_DEBUG("NextHopGroup table del: key [%s]", key.c_str());
         m_nexthop_groupTable.del(key);
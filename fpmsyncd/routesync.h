@@ -184,6 +184,13 @@ public:
 
     virtual void onMsgRaw(struct nlmsghdr *obj);
 
+    /*
+     * Handle regular route straight from the netlink message, skipping the
+     * libnl route object. Returns false if the message has to go through
+     * onMsg() instead.
+     */
+    bool onRouteMsgDirect(struct nlmsghdr *h);
+
     void setSuppressionEnabled(bool enabled);
 
     bool isSuppressionEnabled() const
@@ -205,6 +212,35 @@ public:
         FieldValueTupleWrapperBase && fvw,
         ProducerStateTable & table);
 
+    struct CoalesceCounters
+    {
+        // route updates held for coalescing
+        uint64_t buffered;
+        // route updates replaced by a later update of the same route
+        uint64_t suppressed;
+        // coalesced route updates written to the route table
+        uint64_t flushed;
+    };
+
+    /*
+     * Hold route table updates for up to window_ms and write only the last
+     * update of each route (VRF and prefix) once the window expires.
+     * 0 disables coalescing.
+     */
+    void setCoalesceWindow(uint32_t window_ms);
+
+    /*
+     * Write the coalesced route updates held for the whole window, or all of
+     * them if force is set. Returns the time in milliseconds until the next
+     * held update is due, -1 if none is held.
+     */
+    int flushCoalescedRoutes(bool force = false);
+
+    const CoalesceCounters& getCoalesceCounters() const
+    {
+        return m_coalesceCounters;
+    }
+
     void onRouteResponse(const std::string& key, const std::vector<FieldValueTuple>& fieldValues);
 
     void onWarmStartEnd(swss::DBConnector& applStateDb);
@@ -255,9 +291,46 @@ private:
     bool                m_isSuppressionEnabled{false};
     FpmInterface*       m_fpmInterface {nullptr};
 
+    /* Protocol names by protocol number, resolved on first use */
+    array<string, 256>  m_protocolNames;
+    struct PendingRoute
+    {
+        KeyOpFieldsValuesTuple update;
+        chrono::steady_clock::time_point since;
+    };
+
+    /* Route coalescing window, 0 if disabled */
+    chrono::milliseconds m_coalesceWindow{0};
+    /* Last held update by route key */
+    unordered_map<string, PendingRoute> m_pendingRoutes;
+    /* Held route keys, oldest first */
+    deque<string> m_pendingOrder;
+    CoalesceCounters m_coalesceCounters{};
+
+    /* Next hop lists reused across routes by onRouteMsgDirect() */
+    string              m_gwBuf;
+    string              m_intfBuf;
+    string              m_wtBuf;
+
     /* Handle regular route (include VRF route) */
     void onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf);
 
+    /* Whether updates of the table go through coalescing */
+    bool isCoalesced(const ProducerStateTable &table) const;
+
+    /* Hold a route table update until its coalescing window expires */
+    void coalesceRoute(KeyOpFieldsValuesTuple &&update);
+
+    /* Fill route next hop fields from a next hop group */
+    bool fillNextHopGroupFields(RouteTableFieldValueTupleWrapper &fvw, uint32_t nhg_id,
+                                uint8_t family, const char *destipprefix);
+
+    /* Get protocol name from the cache */
+    const string& getProtocolName(uint8_t proto);
+
+    /* Append a next hop to the next hop buffers */
+    bool appendNextHop(int family, struct rtattr *gw, int if_index, uint8_t weight);
+
     /* Handle label route */
     void onLabelRouteMsg(int nlmsg_type, struct nl_object *obj);
 
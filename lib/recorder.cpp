@@ -1,7 +1,7 @@
 #include "recorder.h"
-#include "timestamp.h"
 #include "logger.h"
 #include <cstring>
+#include <time.h>
 
 using namespace swss;
 
@@ -10,6 +10,19 @@ const std::string Recorder::REC_START = "|recording started";
 const std::string Recorder::SWSS_FNAME = "swss.rec";
 const std::string Recorder::SAIREDIS_FNAME = "sairedis.rec";
 const std::string Recorder::RESPPUB_FNAME = "responsepublisher.rec";
+/* Starts with NUL so that it can't be confused with a text record */
+const std::string Recorder::BINARY_MAGIC = std::string("\0SWSSREC", 8);
+
+/*
+ * Binary record layout, integers in little endian:
+ *   tag (1 byte, REC_BINARY_TAG) | tv_sec (8 bytes) | tv_usec (4 bytes) | length (4 bytes) | value
+ * A binary segment starts with Recorder::BINARY_MAGIC each time the file is opened.
+ */
+#define REC_BINARY_TAG 0x01
+#define REC_BINARY_HDR_LEN 17
+
+const size_t RecWriter::ASYNC_FLUSH_COUNT;
+const int RecWriter::ASYNC_FLUSH_INTERVAL_MS;
 
 
 Recorder& Recorder::Instance()
@@ -52,6 +65,94 @@ SaiRedisRec::SaiRedisRec()
 }
 
 
+std::string Recorder::formatTimestamp(const struct timeval &tv)
+{
+    char buffer[64];
+    struct tm tm;
+    time_t sec = tv.tv_sec;
+
+    localtime_r(&sec, &tm);
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &tm);
+    snprintf(&buffer[size], 32, "%06ld", (long)tv.tv_usec);
+
+    return std::string(buffer);
+}
+
+
+static void putLE(char *buf, uint64_t value, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        buf[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+}
+
+
+static uint64_t getLE(const char *buf, size_t len)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(buf[i])) << (8 * i);
+    }
+    return value;
+}
+
+
+bool Recorder::binaryToText(std::istream &in, std::ostream &out)
+{
+    std::vector<char> val;
+
+    while (true)
+    {
+        int c = in.peek();
+        if (c == EOF)
+        {
+            return true;
+        }
+
+        if (c == BINARY_MAGIC[0])
+        {
+            char magic[8];
+            if (!in.read(magic, sizeof(magic)) || BINARY_MAGIC.compare(0, sizeof(magic), magic, sizeof(magic)) != 0)
+            {
+                return false;
+            }
+        }
+        else if (c == REC_BINARY_TAG)
+        {
+            char hdr[REC_BINARY_HDR_LEN];
+            if (!in.read(hdr, sizeof(hdr)))
+            {
+                return false;
+            }
+
+            struct timeval tv;
+            tv.tv_sec = static_cast<time_t>(getLE(hdr + 1, 8));
+            tv.tv_usec = static_cast<suseconds_t>(getLE(hdr + 9, 4));
+            size_t len = static_cast<size_t>(getLE(hdr + 13, 4));
+
+            val.resize(len);
+            if (len > 0 && !in.read(val.data(), static_cast<std::streamsize>(len)))
+            {
+                return false;
+            }
+
+            out << formatTimestamp(tv) << "|";
+            out.write(val.data(), static_cast<std::streamsize>(len));
+            out << "\n";
+        }
+        else
+        {
+            /* Text record */
+            std::string line;
+            std::getline(in, line);
+            out << line << "\n";
+        }
+    }
+}
+
+
 void RecWriter::startRec(bool exit_if_failure)
 {
     if (!isRecord())
@@ -60,7 +161,7 @@ void RecWriter::startRec(bool exit_if_failure)
     }
 
     fname = getLoc() + "/" + getFile();
-    record_ofs.open(fname, std::ofstream::out | std::ofstream::app);
+    record_ofs.open(fname, std::ofstream::out | std::ofstream::app | std::ofstream::binary);
     if (!record_ofs.is_open())
     {
         SWSS_LOG_ERROR("%s Recorder: Failed to open recording file %s: error %s", getName().c_str(), fname.c_str(), strerror(errno));
@@ -73,13 +174,30 @@ void RecWriter::startRec(bool exit_if_failure)
             setRecord(false);
         }
     }
-    record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
-    SWSS_LOG_NOTICE("%s Recorder: Recording started at %s", getName().c_str(), fname.c_str());
+
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    writeHeader();
+    writeEntry(tv, Recorder::REC_START.substr(1));
+    record_ofs.flush();
+
+    if (isAsync() && isRecord())
+    {
+        m_pending.reserve(ASYNC_FLUSH_COUNT);
+        m_writing.reserve(ASYNC_FLUSH_COUNT);
+        m_writerExit = false;
+        m_writer = std::thread(&RecWriter::writerThread, this);
+    }
+
+    SWSS_LOG_NOTICE("%s Recorder: Recording started at %s (%s, %s)", getName().c_str(), fname.c_str(),
+                    isBinary() ? "binary" : "text", isAsync() ? "async" : "sync");
 }
 
 
 RecWriter::~RecWriter()
 {
+    stopWriter();
+
     if (record_ofs.is_open())
     {
         record_ofs.close();      
@@ -93,12 +211,152 @@ void RecWriter::record(const std::string& val)
     {
         return ;
     }
-    if (isRotate())
+
+    push(std::string(val));
+}
+
+
+void RecWriter::record(std::string&& val)
+{
+    if (!isRecord())
+    {
+        return ;
+    }
+
+    push(std::move(val));
+}
+
+
+void RecWriter::push(std::string&& val)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    if (!m_writer.joinable())
+    {
+        if (takeRotate())
+        {
+            logfileReopen();
+        }
+        writeEntry(tv, val);
+        record_ofs.flush();
+        return;
+    }
+
+    /* Stage the record, the writer thread formats and writes it */
+    size_t count;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMtx);
+        m_pending.push_back(RecEntry{tv, std::move(val)});
+        count = m_pending.size();
+    }
+    m_pendingCount.store(count, std::memory_order_relaxed);
+
+    if (count == ASYNC_FLUSH_COUNT)
+    {
+        m_writerCv.notify_one();
+    }
+}
+
+
+void RecWriter::writeHeader()
+{
+    if (isBinary())
+    {
+        record_ofs.write(Recorder::BINARY_MAGIC.data(), static_cast<std::streamsize>(Recorder::BINARY_MAGIC.size()));
+    }
+}
+
+
+void RecWriter::writeEntry(const struct timeval &tv, const std::string &val)
+{
+    if (!isBinary())
+    {
+        record_ofs << Recorder::formatTimestamp(tv) << "|" << val << "\n";
+        return;
+    }
+
+    char hdr[REC_BINARY_HDR_LEN];
+    hdr[0] = REC_BINARY_TAG;
+    putLE(hdr + 1, static_cast<uint64_t>(tv.tv_sec), 8);
+    putLE(hdr + 9, static_cast<uint64_t>(tv.tv_usec), 4);
+    putLE(hdr + 13, static_cast<uint64_t>(val.size()), 4);
+
+    record_ofs.write(hdr, sizeof(hdr));
+    record_ofs.write(val.data(), static_cast<std::streamsize>(val.size()));
+}
+
+
+void RecWriter::writePending()
+{
+    std::lock_guard<std::mutex> lock(m_fileMtx);
+
+    {
+        std::lock_guard<std::mutex> pendingLock(m_pendingMtx);
+        m_pending.swap(m_writing);
+        m_pendingCount.store(0, std::memory_order_relaxed);
+    }
+
+    if (m_writing.empty())
+    {
+        return;
+    }
+
+    if (takeRotate())
     {
-        setRotate(false);
         logfileReopen();
     }
-    record_ofs << swss::getTimestamp() << "|" << val << std::endl;
+
+    for (const auto &entry : m_writing)
+    {
+        writeEntry(entry.tv, entry.val);
+    }
+    m_writing.clear();
+
+    record_ofs.flush();
+}
+
+
+void RecWriter::writerThread()
+{
+    while (!m_writerExit)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_writerMtx);
+            m_writerCv.wait_for(lock, std::chrono::milliseconds(ASYNC_FLUSH_INTERVAL_MS), [&](){
+                return m_writerExit || m_pendingCount.load(std::memory_order_relaxed) >= ASYNC_FLUSH_COUNT;
+            });
+        }
+
+        writePending();
+    }
+
+    writePending();
+}
+
+
+void RecWriter::flush()
+{
+    if (m_writer.joinable())
+    {
+        writePending();
+    }
+}
+
+
+void RecWriter::stopWriter()
+{
+    if (!m_writer.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_writerMtx);
+        m_writerExit = true;
+    }
+    m_writerCv.notify_one();
+    m_writer.join();
 }
 
 
@@ -110,12 +368,13 @@ void RecWriter::logfileReopen()
      * empty file here.
      */
     record_ofs.close();
-    record_ofs.open(fname, std::ofstream::out | std::ofstream::app);
+    record_ofs.open(fname, std::ofstream::out | std::ofstream::app | std::ofstream::binary);
 
     if (!record_ofs.is_open())
     {
         SWSS_LOG_ERROR("%s Recorder: Failed to open file %s: %s", getName().c_str(), fname.c_str(), strerror(errno));
         return;
     }
+    writeHeader();
     SWSS_LOG_INFO("%s Recorder: LogRotate request handled", getName().c_str());
 }
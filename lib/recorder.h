@@ -5,6 +5,12 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <sys/time.h>
 
 namespace swss {
 
@@ -21,13 +27,16 @@ public:
     /* getters */
     bool isRecord()  { return m_recording; }
     bool isRotate()  { return m_rotate; }
+    /* Clear a pending rotate request, returns whether there was one */
+    bool takeRotate()  { return m_rotate.exchange(false); }
     std::string getLoc() { return m_location; }
     std::string getFile() { return m_filename; }
     std::string getName() { return m_name; }
 
 private:
     bool m_recording;
-    bool m_rotate;
+    /* Set by the SIGHUP handler, consumed by the writer */
+    std::atomic<bool> m_rotate{false};
     std::string m_location;
     std::string m_filename;
     std::string m_name;
@@ -35,17 +44,69 @@ private:
 
 class RecWriter : public RecBase {
 public:
+    /* Group flush thresholds of the asynchronous writer */
+    static const size_t ASYNC_FLUSH_COUNT = 1024;
+    static const int ASYNC_FLUSH_INTERVAL_MS = 100;
+
     RecWriter() = default;
     virtual ~RecWriter();
+
+    /*
+     * Asynchronous mode stages records in a buffer and a background thread
+     * writes them out, flushing every ASYNC_FLUSH_COUNT records or
+     * ASYNC_FLUSH_INTERVAL_MS. Binary mode writes compact binary records,
+     * see Recorder::binaryToText(). Both must be set before startRec().
+     */
+    void setAsync(bool async) { m_async = async; }
+    void setBinary(bool binary) { m_binary = binary; }
+    bool isAsync() { return m_async; }
+    bool isBinary() { return m_binary; }
+
     void startRec(bool exit_if_failure);
     void record(const std::string& val);
+    void record(std::string&& val);
+
+    /* Write out all staged records of the asynchronous writer */
+    void flush();
 
 protected:
     void logfileReopen();
 
 private:
+    struct RecEntry
+    {
+        struct timeval tv;
+        std::string val;
+    };
+
+    void push(std::string&& val);
+    void writeEntry(const struct timeval &tv, const std::string &val);
+    void writeHeader();
+    void writePending();
+    void writerThread();
+    void stopWriter();
+
     std::ofstream record_ofs;
     std::string fname;
+
+    bool m_async = false;
+    bool m_binary = false;
+
+    /*
+     * Staged records, in order. The writer swaps them with m_writing, so the
+     * capacity of both buffers is reused and staging a record doesn't allocate.
+     */
+    std::vector<RecEntry> m_pending;
+    std::vector<RecEntry> m_writing;
+    std::mutex m_pendingMtx;
+    std::atomic<size_t> m_pendingCount{0};
+
+    std::thread m_writer;
+    std::mutex m_writerMtx;
+    std::condition_variable m_writerCv;
+    std::atomic<bool> m_writerExit{false};
+    /* Serializes the file between the writer thread and flush() */
+    std::mutex m_fileMtx;
 };
 
 class SwSSRec : public RecWriter {
@@ -73,6 +134,17 @@ public:
     static const std::string SWSS_FNAME;
     static const std::string SAIREDIS_FNAME;
     static const std::string RESPPUB_FNAME;
+    static const std::string BINARY_MAGIC;
+
+    /* Format a record time the same way as swss::getTimestamp() */
+    static std::string formatTimestamp(const struct timeval &tv);
+
+    /*
+     * Convert a recording written in binary mode to the text format.
+     * Text lines found in the input, e.g. written before binary mode was
+     * enabled, are copied as is. Returns false on a truncated record.
+     */
+    static bool binaryToText(std::istream &in, std::ostream &out);
 
     Recorder() = default;
     /* Individual Handlers */
@@ -2,6 +2,7 @@
 #include <limits.h>
 #include <unordered_map>
 #include <algorithm>
+#include <typeinfo>
 #include "aclorch.h"
 #include "logger.h"
 #include "schema.h"
@@ -1377,6 +1378,13 @@ void AclRule::decreaseNextHopRefCount()
     return;
 }
 
+bool AclRule::hasRedirectTarget() const
+{
+    return !m_redirect_target_next_hop.empty() ||
+           !m_redirect_target_next_hop_group.empty() ||
+           m_redirect_target_tun_nh.oid != SAI_NULL_OBJECT_ID;
+}
+
 bool AclRule::isActionSupported(sai_acl_entry_attr_t action) const
 {
     return m_pAclOrch->isAclActionSupported(m_pTable->stage, AclEntryActionToAclAction(action));
@@ -1476,8 +1484,22 @@ bool AclRule::update(const AclRule& updatedRule)
     return true;
 }
 
+bool AclRule::canUpdate(const AclRule& updatedRule) const
+{
+    // Ranges and redirect targets are referenced by the rule when it is parsed or
+    // created, a rule using them is created again
+    return typeid(*this) == typeid(updatedRule) &&
+           m_rangeConfig.empty() && updatedRule.m_rangeConfig.empty() &&
+           !hasRedirectTarget() && !updatedRule.hasRedirectTarget();
+}
+
 bool AclRule::updateCounter(const AclRule& updatedRule)
 {
+    if (m_createCounter == updatedRule.m_createCounter)
+    {
+        return true;
+    }
+
     if (updatedRule.m_createCounter)
     {
         if (!enableCounter())
@@ -1745,6 +1767,11 @@ sai_object_id_t AclRule::getOid() const
     return m_ruleOid;
 }
 
+uint32_t AclRule::getPriority() const
+{
+    return m_priority;
+}
+
 sai_object_id_t AclRule::getCounterOid() const
 {
     return m_counterOid;
@@ -2394,6 +2421,11 @@ bool AclRuleMirror::update(const AclRule& rule)
     return false;
 }
 
+bool AclRuleMirror::canUpdate(const AclRule& updatedRule) const
+{
+    return false;
+}
+
 void AclRuleMirror::onUpdate(SubjectType type, void *cntx)
 {
     if (type != SUBJECT_TYPE_MIRROR_SESSION_CHANGE)
@@ -2523,6 +2555,12 @@ void AclRuleUnderlaySetDscp::onUpdate(SubjectType, void *)
     // Do nothing
 }
 
+bool AclRuleUnderlaySetDscp::canUpdate(const AclRule& updatedRule) const
+{
+    // The DSCP value is also programmed in the EGR_SET_DSCP table rule
+    return false;
+}
+
 AclTable::AclTable(AclOrch *pAclOrch, string id) noexcept : m_pAclOrch(pAclOrch), id(id)
 {
 
@@ -3319,6 +3357,11 @@ bool AclRuleDTelWatchListEntry::update(const AclRule& rule)
     return false;
 }
 
+bool AclRuleDTelWatchListEntry::canUpdate(const AclRule& updatedRule) const
+{
+    return false;
+}
+
 AclRange::AclRange(sai_acl_range_type_t type, sai_object_id_t oid, int min, int max):
     m_oid(oid), m_refCnt(0), m_min(min), m_max(max), m_type(type)
 {
@@ -5486,6 +5529,9 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    // Rules to be created once all tasks are processed
+    vector<pair<SyncMap::iterator, shared_ptr<AclRule>>> newRules;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -5546,6 +5592,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Error while creating ACL rule %s: %s", rule_id.c_str(), e.what());
                 it = consumer.m_toSync.erase(it);
+                createAclRules(consumer, newRules);
                 return;
             }
             bool bHasTCPFlag = false;
@@ -5627,19 +5674,26 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
                 }
             }
 
-            // validate and create ACL rule
+            // validate and create or update ACL rule
             if (bAllAttributesOk && newRule->validate())
             {
-                if (addAclRule(newRule, table_id))
+                // An existing rule is changed by setting the attributes which differ,
+                // so that it stays installed while it is updated
+                auto rule = getAclRule(table_id, rule_id);
+                if (rule && rule->canUpdate(*newRule))
                 {
-                    setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
-                    it = consumer.m_toSync.erase(it);
-                }
-                else
-                {
-                    setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
-                    it++;
+                    if (updateAclRule(newRule))
+                    {
+                        setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
+                        it = consumer.m_toSync.erase(it);
+                        continue;
+                    }
+
+                    SWSS_LOG_WARN("Failed to update ACL rule %s in place, creating it again", key.c_str());
                 }
+
+                newRules.emplace_back(it, newRule);
+                it++;
             }
             else
             {
@@ -5669,6 +5723,41 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
     }
+
+    createAclRules(consumer, newRules);
+}
+
+/*
+ * Creates the new rules of a doAclRuleTask() pass by decreasing priority, so that
+ * traffic is never matched by a new rule while a new rule of higher priority which
+ * overrides it is not installed yet.
+ */
+void AclOrch::createAclRules(Consumer &consumer, vector<pair<SyncMap::iterator, shared_ptr<AclRule>>> &newRules)
+{
+    SWSS_LOG_ENTER();
+
+    stable_sort(newRules.begin(), newRules.end(), [](const auto &a, const auto &b)
+    {
+        return a.second->getPriority() > b.second->getPriority();
+    });
+
+    for (auto &newRule : newRules)
+    {
+        const auto &rule = newRule.second;
+        auto table_id = rule->getTableId();
+
+        if (addAclRule(rule, table_id))
+        {
+            setAclRuleStatus(table_id, rule->getId(), AclObjectStatus::ACTIVE);
+            consumer.m_toSync.erase(newRule.first);
+        }
+        else
+        {
+            setAclRuleStatus(table_id, rule->getId(), AclObjectStatus::PENDING_CREATION);
+        }
+    }
+
+    newRules.clear();
 }
 
 void AclOrch::doAclTableTypeTask(Consumer &consumer)
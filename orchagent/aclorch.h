@@ -323,6 +323,8 @@ public:
 
     virtual bool create();
     virtual bool update(const AclRule& updatedRule);
+    // Whether update() can change the rule to updatedRule without creating it again
+    virtual bool canUpdate(const AclRule& updatedRule) const;
     virtual bool remove();
     virtual void onUpdate(SubjectType, void *) = 0;
     virtual void updateInPorts();
@@ -334,6 +336,7 @@ public:
     string getTableId() const;
     sai_object_id_t getOid() const;
     sai_object_id_t getCounterOid() const;
+    uint32_t getPriority() const;
     bool hasCounter() const;
     vector<sai_object_id_t> getInPorts() const;
     bool getCreateCounter() const;
@@ -367,6 +370,7 @@ protected:
     virtual bool setAttribute(sai_attribute_t attr);
 
     void decreaseNextHopRefCount();
+    bool hasRedirectTarget() const;
 
     bool isActionSupported(sai_acl_entry_attr_t) const;
 
@@ -429,6 +433,7 @@ public:
     bool deactivate();
 
     bool update(const AclRule& updatedRule) override;
+    bool canUpdate(const AclRule& updatedRule) const override;
 protected:
     bool m_state {false};
     string m_sessionName;
@@ -449,6 +454,7 @@ public:
     bool deactivate();
 
     bool update(const AclRule& updatedRule) override;
+    bool canUpdate(const AclRule& updatedRule) const override;
 protected:
     DTelOrch *m_pDTelOrch;
     string m_intSessionId;
@@ -464,6 +470,7 @@ public:
     bool validateAddAction(string attr_name, string attr_value);
     bool validate();
     void onUpdate(SubjectType, void *) override;
+    bool canUpdate(const AclRule& updatedRule) const override;
     uint32_t getDscpValue() const;
     uint32_t getMetadata() const;
 protected:
@@ -646,6 +653,7 @@ private:
     void doTask(Consumer &consumer);
     void doAclTableTask(Consumer &consumer);
     void doAclRuleTask(Consumer &consumer);
+    void createAclRules(Consumer &consumer, vector<pair<SyncMap::iterator, shared_ptr<AclRule>>> &newRules);
     void doAclTableTypeTask(Consumer &consumer);
     void init(vector<TableConnector>& connectors, PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch);
     void initDefaultTableTypes(const string& platform, const string& sub_platform);
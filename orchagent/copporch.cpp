@@ -15,6 +15,7 @@ extern "C" {
 #include "directory.h"
 #include "flow_counter_handler.h"
 #include "timer.h"
+#include "rateengine.h"
 
 #include <inttypes.h>
 #include <sstream>
@@ -1369,7 +1370,8 @@ bool CoppOrch::trapGroupUpdatePolicer (string trap_group_name,
 
 void CoppOrch::initTrapRatePlugin()
 {
-    if (m_trap_rate_plugin_loaded)
+    // Trap rates computed in orchagent don't need the plugin
+    if (m_trap_rate_plugin_loaded || isNativeRatesEnabled())
     {
         return;
     }
@@ -1454,6 +1456,7 @@ bool CoppOrch::bindTrapCounter(sai_object_id_t hostif_trap_id, sai_hostif_trap_t
     vector<FieldValueTuple> nameMapFvs;
     nameMapFvs.emplace_back(trap_name, sai_serialize_object_id(counter_id));
     m_counter_table->set("", nameMapFvs);
+    flex_counters_orch->setNativeRatesObject(COUNTERS_TRAP_NAME_MAP, trap_name, sai_serialize_object_id(counter_id));
 
     auto was_empty = m_pendingAddToFlexCntr.empty();
     m_pendingAddToFlexCntr[counter_id] = trap_name;
@@ -1493,6 +1496,11 @@ void CoppOrch::unbindTrapCounter(sai_object_id_t hostif_trap_id)
 
     // Remove trap from COUNTERS_TRAP_NAME_MAP
     m_counter_table->hdel("", iter->second);
+    auto flex_counters_orch = gDirectory.get<FlexCounterOrch*>();
+    if (flex_counters_orch)
+    {
+        flex_counters_orch->delNativeRatesObject(COUNTERS_TRAP_NAME_MAP, iter->second);
+    }
 
     // Unbind generic counter to trap
     sai_attribute_t trap_attr;
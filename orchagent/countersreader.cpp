@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "logger.h"
+#include "rediscommand.h"
+#include "redisreply.h"
+#include "countersreader.h"
+
+using namespace std;
+using namespace swss;
+
+// Commands sent before their replies are read, which bounds the replies buffered by redis
+#define READ_PIPELINE_SIZE          512
+
+void readEntries(DBConnector *db, const vector<string> &keys, vector<unordered_map<string, string>> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    entries.clear();
+    entries.resize(keys.size());
+
+    redisContext *context = db->getContext();
+
+    for (size_t start = 0; start < keys.size(); start += READ_PIPELINE_SIZE)
+    {
+        size_t end = min(keys.size(), start + READ_PIPELINE_SIZE);
+
+        for (size_t i = start; i < end; i++)
+        {
+            RedisCommand hgetall;
+            hgetall.format("HGETALL %s", keys[i].c_str());
+            if (redisAppendFormattedCommand(context, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+            {
+                throw runtime_error("Failed to append HGETALL " + keys[i] + " to the pipeline");
+            }
+        }
+
+        for (size_t i = start; i < end; i++)
+        {
+            redisReply *reply = nullptr;
+            if (redisGetReply(context, reinterpret_cast<void **>(&reply)) != REDIS_OK || reply == nullptr)
+            {
+                throw runtime_error("Failed to get the reply of HGETALL " + keys[i]);
+            }
+
+            RedisReply r(reply);
+            if (reply->type == REDIS_REPLY_ERROR)
+            {
+                throw runtime_error("HGETALL " + keys[i] + " failed: " + string(reply->str, reply->len));
+            }
+            if (reply->type != REDIS_REPLY_ARRAY)
+            {
+                continue;
+            }
+
+            auto &fields = entries[i];
+            for (size_t e = 0; e + 1 < reply->elements; e += 2)
+            {
+                fields.emplace(string(reply->element[e]->str, reply->element[e]->len),
+                               string(reply->element[e + 1]->str, reply->element[e + 1]->len));
+            }
+        }
+    }
+}
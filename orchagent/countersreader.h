@@ -0,0 +1,18 @@
+#ifndef SWSS_COUNTERSREADER_H
+#define SWSS_COUNTERSREADER_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dbconnector.h"
+
+/*
+ * Reads the fields of many entries of a database with one round trip per chunk of keys,
+ * instead of one synchronous HGETALL per entry. entries[i] holds the fields of keys[i],
+ * and has no field if there is no such entry.
+ */
+void readEntries(swss::DBConnector *db, const std::vector<std::string> &keys,
+        std::vector<std::unordered_map<std::string, std::string>> &entries);
+
+#endif /* SWSS_COUNTERSREADER_H */
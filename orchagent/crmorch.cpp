@@ -7,9 +7,12 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_INCREMENTAL_POLLING "incremental_polling"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
+// Seconds between the full sweeps of incremental polling, hourly by default (12 default polls)
+#define CRM_INCREMENTAL_FULL_SWEEP_INTERVAL (60 * 60)
 #define CRM_THRESHOLD_TYPE_DEFAULT CrmThresholdType::CRM_PERCENTAGE
 #define CRM_THRESHOLD_LOW_DEFAULT 70
 #define CRM_THRESHOLD_HIGH_DEFAULT 85
@@ -491,6 +494,12 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 m_timer->setInterval(interv);
                 m_timer->reset();
             }
+            else if (field == CRM_INCREMENTAL_POLLING)
+            {
+                m_incrementalPolling = (value == "true");
+                m_incrementalPolls = 0;
+                SWSS_LOG_NOTICE("CRM incremental polling %s", m_incrementalPolling ? "enabled" : "disabled");
+            }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
                 auto thresholdType = crmThreshTypeMap.at(value);
@@ -505,6 +514,7 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                     {
                         cnt.second.exceededLogCounter = 0;
                     }
+                    setCheckPending(resource);
                 }
             }
             else if (crmThreshLowResMap.find(field) != crmThreshLowResMap.end())
@@ -513,6 +523,7 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 auto thresholdValue = to_uint<uint32_t>(value);
 
                 m_resourcesMap.at(resourceType).lowThreshold = thresholdValue;
+                setCheckPending(m_resourcesMap.at(resourceType));
             }
             else if (crmThreshHighResMap.find(field) != crmThreshHighResMap.end())
             {
@@ -520,6 +531,7 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 auto thresholdValue = to_uint<uint32_t>(value);
 
                 m_resourcesMap.at(resourceType).highThreshold = thresholdValue;
+                setCheckPending(m_resourcesMap.at(resourceType));
             }
             else
             {
@@ -545,7 +557,7 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
+        getUsedCounter(resource, CRM_COUNTERS_TABLE_KEY).usedCounter++;
     }
     catch (...)
     {
@@ -560,7 +572,7 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
+        getUsedCounter(resource, CRM_COUNTERS_TABLE_KEY).usedCounter--;
     }
     catch (...)
     {
@@ -575,7 +587,7 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
+        getUsedCounter(resource, getCrmAclKey(stage, point)).usedCounter++;
     }
     catch (...)
     {
@@ -590,7 +602,7 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
+        getUsedCounter(resource, getCrmAclKey(stage, point)).usedCounter--;
 
         // remove acl_entry and acl_counter in this acl table
         if (resource == CrmResourceType::CRM_ACL_TABLE)
@@ -629,8 +641,9 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        auto &cnt = getUsedCounter(resource, getCrmAclTableKey(tableId));
+        cnt.usedCounter++;
+        cnt.id = tableId;
     }
     catch (...)
     {
@@ -645,7 +658,7 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
+        getUsedCounter(resource, getCrmAclTableKey(tableId)).usedCounter--;
     }
     catch (...)
     {
@@ -660,7 +673,7 @@ void CrmOrch::incCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter++;
+        getUsedCounter(resource, getCrmP4rtTableKey(table_name)).usedCounter++;
     }
     catch (...)
     {
@@ -675,7 +688,7 @@ void CrmOrch::decCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter--;
+        getUsedCounter(resource, getCrmP4rtTableKey(table_name)).usedCounter--;
     }
     catch (...)
     {
@@ -693,20 +706,20 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getUsedCounter(CrmResourceType::CRM_DASH_IPV4_ACL_RULE, getCrmDashAclGroupKey(tableId));
             rule_cnt.usedCounter = 0;
             rule_cnt.id = tableId;
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getUsedCounter(CrmResourceType::CRM_DASH_IPV6_ACL_RULE, getCrmDashAclGroupKey(tableId));
             rule_cnt.usedCounter = 0;
             rule_cnt.id = tableId;
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getUsedCounter(resource, getCrmDashAclGroupKey(tableId));
             ++rule_cnt.usedCounter;
         }
     }
@@ -737,7 +750,7 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getUsedCounter(resource, getCrmDashAclGroupKey(tableId));
             --rule_cnt.usedCounter;
         }
     }
@@ -752,11 +765,37 @@ void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    // Incremental polling still queries the switch wide resources on every poll, as they share
+    // hardware pools: routes share the LPM, neighbors, next hops and FDB the hash tables.
+    // Only the per table resources are skipped when unchanged. The tables of a stage also share
+    // the ACL hardware, so each of them is queried again on a full sweep
+    uint64_t interval = max<uint64_t>(1, static_cast<uint64_t>(m_pollingInterval.count()));
+    uint64_t sweepPolls = max<uint64_t>(1, CRM_INCREMENTAL_FULL_SWEEP_INTERVAL / interval);
+    m_fullSweep = !m_incrementalPolling || (m_incrementalPolls++ % sweepPolls == 0);
+
     getResAvailableCounters();
     updateCrmCountersTable();
     checkCrmThresholds();
 }
 
+CrmOrch::CrmResourceCounter &CrmOrch::getUsedCounter(CrmResourceType resource, const string &key)
+{
+    auto &cnt = m_resourcesMap.at(resource).countersMap[key];
+
+    // Flag the counter for the next incremental poll
+    cnt.usedChanged = true;
+
+    return cnt;
+}
+
+void CrmOrch::setCheckPending(CrmResourceEntry &res)
+{
+    for (auto &cnt : res.countersMap)
+    {
+        cnt.second.checkPending = true;
+    }
+}
+
 bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
 {
     sai_attribute_t attr;
@@ -846,6 +885,11 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
 
     for (auto &cnt : res.countersMap)
     { 
+        if (!m_fullSweep && !cnt.second.usedChanged)
+        {
+            continue;
+        }
+
         sai_attribute_t attr;
         attr.id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
         attr.value.oid = cnt.second.id;
@@ -996,6 +1040,11 @@ void CrmOrch::getResAvailableCounters()
 
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!m_fullSweep && !cnt.second.usedChanged)
+                    {
+                        continue;
+                    }
+
                     sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
                     if ((status == SAI_STATUS_NOT_SUPPORTED) ||
                         (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -1023,6 +1072,11 @@ void CrmOrch::getResAvailableCounters()
             {
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!m_fullSweep && !cnt.second.usedChanged)
+                    {
+                        continue;
+                    }
+
                     std::string table_name = cnt.first;
                     sai_object_type_t objType = crmResSaiObjAttrMap.at(res.first);
                     sai_attribute_t attr;
@@ -1057,6 +1111,11 @@ void CrmOrch::getResAvailableCounters()
                 SWSS_LOG_ERROR("Failed to get CRM resource type %u. Unknown resource type.\n", static_cast<uint32_t>(res.first));
                 return;
         }
+
+        for (auto &cnt : res.second.countersMap)
+        {
+            cnt.second.usedChanged = false;
+        }
     }
 }
 
@@ -1064,22 +1123,33 @@ void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Fields to write per COUNTERS_DB key. Incremental polling only writes the changed values,
+    // except on a full sweep which publishes every counter again
+    map<string, vector<FieldValueTuple>> updates;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (!m_fullSweep && cnt.second.usedPublished &&
+                    (cnt.second.publishedUsed == cnt.second.usedCounter))
+                {
+                    continue;
+                }
+
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
+                cnt.second.publishedUsed = cnt.second.usedCounter;
+                cnt.second.usedPublished = true;
+                cnt.second.checkPending = true;
             }
         }
         catch(const out_of_range &e)
@@ -1093,17 +1163,24 @@ void CrmOrch::updateCrmCountersTable()
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (!m_fullSweep && cnt.second.availablePublished &&
+                    (cnt.second.publishedAvailable == cnt.second.availableCounter))
+                {
+                    continue;
+                }
+
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
+                cnt.second.publishedAvailable = cnt.second.availableCounter;
+                cnt.second.availablePublished = true;
+                cnt.second.checkPending = true;
             }
         }
         catch(const out_of_range &e)
@@ -1111,6 +1188,19 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    if (updates.empty())
+    {
+        return;
+    }
+
+    m_countersCrmTable->setBuffered(true);
+    for (const auto &update : updates)
+    {
+        m_countersCrmTable->set(update.first, update.second);
+    }
+    m_countersCrmTable->flush();
+    m_countersCrmTable->setBuffered(false);
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -1129,6 +1219,14 @@ void CrmOrch::checkCrmThresholds()
         for (auto &j : i.second.countersMap)
         {
             auto &cnt = j.second;
+
+            // thresholds are only evaluated again once the counters or the thresholds changed
+            if (m_incrementalPolling && !cnt.checkPending)
+            {
+                continue;
+            }
+            cnt.checkPending = false;
+
             uint64_t utilization = 0;
             uint32_t percentageUtil = 0;
             string threshType = "";
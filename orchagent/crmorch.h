@@ -104,6 +104,16 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+
+        // "used" counter changed since the last poll
+        bool usedChanged = true;
+        // values last written to COUNTERS_DB
+        bool usedPublished = false;
+        bool availablePublished = false;
+        uint32_t publishedUsed = 0;
+        uint32_t publishedAvailable = 0;
+        // thresholds need to be checked on the next poll
+        bool checkPending = true;
     };
 
     struct CrmResourceEntry
@@ -122,6 +132,11 @@ private:
     };
 
     std::chrono::seconds m_pollingInterval;
+    // Only query, publish and check the resources that changed since the last poll
+    bool m_incrementalPolling = false;
+    // Polls since incremental polling was enabled, and whether the current poll queries all tables
+    uint64_t m_incrementalPolls = 0;
+    bool m_fullSweep = true;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
@@ -133,6 +148,8 @@ private:
     void getResAvailableCounters();
     void updateCrmCountersTable();
     void checkCrmThresholds();
+    CrmResourceCounter &getUsedCounter(CrmResourceType resource, const std::string &key);
+    void setCheckPending(CrmResourceEntry &res);
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclTableKey(sai_object_id_t id);
     std::string getCrmP4rtTableKey(std::string table_name);
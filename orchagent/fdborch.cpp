@@ -29,7 +29,8 @@ FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> app
     Orch(applDbConnector, appFdbTables),
     m_portsOrch(port),
     m_fdbStateTable(stateDbFdbConnector.first, stateDbFdbConnector.second),
-    m_mclagFdbStateTable(stateDbMclagFdbConnector.first, stateDbMclagFdbConnector.second)
+    m_mclagFdbStateTable(stateDbMclagFdbConnector.first, stateDbMclagFdbConnector.second),
+    m_fdbEventBatch(false)
 {
     for(auto it: appFdbTables)
     {
@@ -73,10 +74,10 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     const Port& port = update.port;
     const MacAddress& mac = entry.mac;
     string portName = port.m_alias;
-    Port vlan;
 
     oldFdbData.origin = FDB_ORIGIN_INVALID;
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    const Port *vlan = m_portsOrch->getPortPtr(entry.bv_id);
+    if (!vlan)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate \
                          vlan port from bv_id 0x%" PRIx64, entry.bv_id);
@@ -84,7 +85,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
 
     // ref: https://github.com/Azure/sonic-swss/blob/master/doc/swss-schema.md#fdb_table
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + mac.to_string();
 
     if (update.add)
     {
@@ -115,7 +116,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
         fdbdata.esi = "";
         fdbdata.vni = 0;
 
-        m_entries[entry] = fdbdata;
+        setFdbEntry(entry, fdbdata);
         SWSS_LOG_INFO("FdbOrch notification: mac %s was inserted in port %s into bv_id 0x%" PRIx64,
                         entry.mac.to_string().c_str(), portName.c_str(), entry.bv_id);
         SWSS_LOG_INFO("m_entries size=%zu mac=%s port=0x%" PRIx64,
@@ -132,7 +133,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
         std::vector<FieldValueTuple> fvs;
         fvs.push_back(FieldValueTuple("port", portName));
         fvs.push_back(FieldValueTuple("type", update.type));
-        m_fdbStateTable.set(key, fvs);
+        setFdbState(key, fvs);
 
         if (!mac_move)
         {
@@ -142,13 +143,15 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
     else
     {
+        size_t erased = 0;
         auto it= m_entries.find(entry);
         if(it != m_entries.end())
         {
             oldFdbData = it->second;
+            eraseFdbEntry(it);
+            erased = 1;
         }
 
-        size_t erased = m_entries.erase(entry);
         SWSS_LOG_DEBUG("FdbOrch notification: mac %s was removed from bv_id 0x%" PRIx64, entry.mac.to_string().c_str(), entry.bv_id);
 
         if (erased == 0)
@@ -167,7 +170,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
                 (oldFdbData.origin == FDB_ORIGIN_PROVISIONED))
         {
             // Remove in StateDb for non advertised mac addresses
-            m_fdbStateTable.del(key);
+            delFdbState(key);
         }
 
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
@@ -175,6 +178,241 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
 }
 
+/*
+adds or updates an entry of m_entries and keeps its indexes in sync
+*/
+void FdbOrch::setFdbEntry(const FdbEntry& entry, const FdbData& fdbData)
+{
+    FdbEntry key;
+    key.mac = entry.mac;
+    key.bv_id = entry.bv_id;
+
+    auto it = m_entries.find(entry);
+    if (it == m_entries.end())
+    {
+        m_entries.emplace(entry, fdbData);
+        m_entriesByBvId[entry.bv_id].insert(key);
+    }
+    else
+    {
+        if (it->second.bridge_port_id != fdbData.bridge_port_id)
+        {
+            auto index = m_entriesByBridgePort.find(it->second.bridge_port_id);
+            if (index != m_entriesByBridgePort.end())
+            {
+                index->second.erase(key);
+                if (index->second.empty())
+                {
+                    m_entriesByBridgePort.erase(index);
+                }
+            }
+        }
+        it->second = fdbData;
+    }
+
+    m_entriesByBridgePort[fdbData.bridge_port_id].insert(key);
+}
+
+/*
+removes an entry of m_entries and of its indexes
+*/
+void FdbOrch::eraseFdbEntry(map<FdbEntry, FdbData>::iterator it)
+{
+    auto unindex = [&it](FdbEntryIndex& indexes, sai_object_id_t id)
+    {
+        auto index = indexes.find(id);
+        if (index != indexes.end())
+        {
+            index->second.erase(it->first);
+            if (index->second.empty())
+            {
+                indexes.erase(index);
+            }
+        }
+    };
+
+    unindex(m_entriesByBridgePort, it->second.bridge_port_id);
+    unindex(m_entriesByBvId, it->first.bv_id);
+    m_entries.erase(it);
+}
+
+/*
+returns the keys of the entries on the bridge port and/or bv_id, from the smallest index
+*/
+vector<FdbEntry> FdbOrch::getFdbEntries(sai_object_id_t bridge_port_id, sai_object_id_t bv_id) const
+{
+    static const set<FdbEntry> empty;
+    const set<FdbEntry> *by_port = nullptr;
+    const set<FdbEntry> *by_bv_id = nullptr;
+
+    if (bridge_port_id != SAI_NULL_OBJECT_ID)
+    {
+        auto index = m_entriesByBridgePort.find(bridge_port_id);
+        by_port = index != m_entriesByBridgePort.end() ? &index->second : &empty;
+    }
+    if (bv_id != SAI_NULL_OBJECT_ID)
+    {
+        auto index = m_entriesByBvId.find(bv_id);
+        by_bv_id = index != m_entriesByBvId.end() ? &index->second : &empty;
+    }
+
+    vector<FdbEntry> entries;
+    if (by_port && by_bv_id)
+    {
+        /* port and VLAN, walk the smallest index and match the other */
+        bool walk_port = by_port->size() <= by_bv_id->size();
+        for (const auto& entry : walk_port ? *by_port : *by_bv_id)
+        {
+            if (walk_port ? entry.bv_id == bv_id : by_port->count(entry) != 0)
+            {
+                entries.push_back(entry);
+            }
+        }
+    }
+    else if (by_port || by_bv_id)
+    {
+        const auto& index = by_port ? *by_port : *by_bv_id;
+        entries.assign(index.begin(), index.end());
+    }
+    return entries;
+}
+
+/*
+queues a learn/age/move event of the current batch of FDB notifications.
+A move storm produces several events per MAC within a batch, only the
+outcome of the last one is applied. Flush events apply to the entries
+learnt before them, so they are handled in order after the queued events.
+*/
+void FdbOrch::queueFdbEvent(sai_fdb_event_t type, const sai_fdb_entry_t& entry,
+                            sai_object_id_t bridge_port_id, sai_fdb_entry_type_t sai_fdb_type)
+{
+    if (type == SAI_FDB_EVENT_FLUSHED)
+    {
+        processFdbEvents();
+        update(type, &entry, bridge_port_id, sai_fdb_type);
+        return;
+    }
+
+    FdbEntry key;
+    key.mac = entry.mac_address;
+    key.bv_id = entry.bv_id;
+
+    auto it = m_fdbEventIndex.find(key);
+    if (it != m_fdbEventIndex.end())
+    {
+        /* An age event saves static entries, it is not superseded by a later learn */
+        auto& event = m_fdbEvents[it->second];
+        if (event.type != SAI_FDB_EVENT_AGED || type == SAI_FDB_EVENT_AGED)
+        {
+            event.type = type;
+            event.bridge_port_id = bridge_port_id;
+            event.sai_fdb_type = sai_fdb_type;
+            event.coalesced = true;
+            return;
+        }
+    }
+
+    m_fdbEventIndex[key] = m_fdbEvents.size();
+    m_fdbEvents.push_back({type, entry, bridge_port_id, sai_fdb_type, false});
+}
+
+/*
+applies the queued learn/age/move events
+*/
+void FdbOrch::processFdbEvents()
+{
+    for (const auto& event : m_fdbEvents)
+    {
+        sai_fdb_event_t type = event.type;
+
+        if (event.coalesced && type != SAI_FDB_EVENT_AGED)
+        {
+            /* The MAC ends up on the event's port: a move if it's known on another port, a learn otherwise */
+            FdbEntry key;
+            key.mac = event.entry.mac_address;
+            key.bv_id = event.entry.bv_id;
+
+            auto existing_entry = m_entries.find(key);
+            if (existing_entry != m_entries.end() && existing_entry->second.bridge_port_id != event.bridge_port_id)
+            {
+                type = SAI_FDB_EVENT_MOVE;
+            }
+            else
+            {
+                type = SAI_FDB_EVENT_LEARNED;
+            }
+        }
+
+        update(type, &event.entry, event.bridge_port_id, event.sai_fdb_type);
+    }
+
+    m_fdbEvents.clear();
+    m_fdbEventIndex.clear();
+}
+
+/*
+writes the STATE_DB changes of the batch in one pipeline and notifies the observers
+*/
+void FdbOrch::flushFdbEventBatch()
+{
+    m_fdbEventBatch = false;
+
+    if (!m_fdbStateWrites.empty())
+    {
+        m_fdbStateTable.setBuffered(true);
+        for (const auto& write : m_fdbStateWrites)
+        {
+            if (write.second.first)
+            {
+                m_fdbStateTable.set(write.first, write.second.second);
+            }
+            else
+            {
+                m_fdbStateTable.del(write.first);
+            }
+        }
+        m_fdbStateTable.flush();
+        m_fdbStateTable.setBuffered(false);
+        m_fdbStateWrites.clear();
+    }
+
+    for (auto& update : m_fdbUpdates)
+    {
+        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    }
+    m_fdbUpdates.clear();
+}
+
+void FdbOrch::setFdbState(const string& key, const vector<FieldValueTuple>& fvs)
+{
+    if (m_fdbEventBatch)
+    {
+        m_fdbStateWrites[key] = make_pair(true, fvs);
+        return;
+    }
+    m_fdbStateTable.set(key, fvs);
+}
+
+void FdbOrch::delFdbState(const string& key)
+{
+    if (m_fdbEventBatch)
+    {
+        m_fdbStateWrites[key] = make_pair(false, vector<FieldValueTuple>());
+        return;
+    }
+    m_fdbStateTable.del(key);
+}
+
+void FdbOrch::notifyFdbChange(FdbUpdate& update)
+{
+    if (m_fdbEventBatch)
+    {
+        m_fdbUpdates.push_back(update);
+        return;
+    }
+    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+}
+
 /*
 clears stateDb and decrements corresponding internal fdb counters
 */
@@ -185,10 +423,10 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
     update.add = false;
 
     /* Fetch Vlan and decrement the counter */
-    Port temp_vlan;
-    if (m_portsOrch->getPort(entry.bv_id, temp_vlan))
+    const Port *temp_vlan = m_portsOrch->getPortPtr(entry.bv_id);
+    if (temp_vlan)
     {
-        m_portsOrch->decrFdbCount(temp_vlan.m_alias, 1);
+        m_portsOrch->decrFdbCount(temp_vlan->m_alias, 1);
     }
 
     /* Decrement port fdb_counter */
@@ -196,7 +434,7 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
 
     /* Remove the FdbEntry from the internal cache, update state DB and CRM counter */
     storeFdbEntryState(update);
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notifyFdbChange(update);
 
     SWSS_LOG_INFO("FdbEntry removed from internal cache, MAC: %s , port: %s, BVID: 0x%" PRIx64,
                    update.entry.mac.to_string().c_str(), update.entry.port_name.c_str(), update.entry.bv_id);
@@ -225,51 +463,21 @@ void FdbOrch::handleSyncdFlushNotif(const sai_object_id_t& bv_id,
             }
         }
     }
-    else if (bv_id == SAI_NULL_OBJECT_ID)
+    else
     {
-        /* FLUSH based on PORT */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        /* FLUSH based on PORT, BV_ID or both, only the entries referring to them are checked */
+        for (const auto& key : getFdbEntries(bridge_port_id, bv_id))
         {
-            auto curr = itr++;
-            if (curr->second.bridge_port_id == bridge_port_id)
+            auto curr = m_entries.find(key);
+            if (curr == m_entries.end())
             {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
-        }
-    }
-    else if (bridge_port_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on BV_ID */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
+                continue;
             }
-        }
-    }
-    else
-    {
-        /* FLUSH based on port and VLAN */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id && curr->second.bridge_port_id == bridge_port_id)
+
+            if (curr->second.sai_fdb_type == sai_fdb_type &&
+                (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
             {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
+                clearFdbEntry(curr->first);
             }
         }
     }
@@ -286,7 +494,8 @@ void FdbOrch::update(sai_fdb_event_t        type,
     update.entry.mac = entry->mac_address;
     update.entry.bv_id = entry->bv_id;
     update.type = "dynamic";
-    Port vlan;
+    /* VLAN of the entry, nullptr if the event has no bv_id */
+    Port *vlan = nullptr;
 
     SWSS_LOG_INFO("FDB event:%d, MAC: %s , BVID: 0x%" PRIx64 " , \
                    bridge port ID: 0x%" PRIx64 ".",
@@ -313,7 +522,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
     }
 
     if (entry->bv_id &&
-        !m_portsOrch->getPort(entry->bv_id, vlan))
+        !(vlan = m_portsOrch->getPortPtr(entry->bv_id)))
     {
         SWSS_LOG_NOTICE("FdbOrch notification type %d: Failed to locate vlan port from bv_id 0x%" PRIx64, type, entry->bv_id);
         return;
@@ -346,8 +555,10 @@ void FdbOrch::update(sai_fdb_event_t        type,
                     {
                         port.m_fdb_count--;
                         m_portsOrch->setPort(port.m_alias, port);
-                        vlan.m_fdb_count--;
-                        m_portsOrch->setPort(vlan.m_alias, vlan);
+                        if (vlan)
+                        {
+                            vlan->m_fdb_count--;
+                        }
                     }
                     // Continue to add (update/move) the MAC
                 }
@@ -388,7 +599,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                     update.add = true;
                     update.type = "dynamic";
                     storeFdbEntryState(update);
-                    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+                    notifyFdbChange(update);
 
                     return;
                 }
@@ -408,11 +619,13 @@ void FdbOrch::update(sai_fdb_event_t        type,
         update.type = "dynamic";
         update.port.m_fdb_count++;
         m_portsOrch->setPort(update.port.m_alias, update.port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        if (vlan)
+        {
+            vlan->m_fdb_count++;
+        }
 
         storeFdbEntryState(update);
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notifyFdbChange(update);
 
         break;
     }
@@ -447,7 +660,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         {
             update.type = "static";
 
-            if (vlan.m_members.find(update.port.m_alias) == vlan.m_members.end())
+            if (!vlan || vlan->m_members.find(update.port.m_alias) == vlan->m_members.end())
             {
                 FdbData fdbData;
                 fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
@@ -457,7 +670,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 fdbData.esi = existing_entry->second.esi;
                 fdbData.vni = existing_entry->second.vni;
                 saved_fdb_entries[update.port.m_alias].push_back(
-                        {existing_entry->first.mac, vlan.m_vlan_info.vlan_id, fdbData});
+                        {existing_entry->first.mac, vlan ? vlan->m_vlan_info.vlan_id : (sai_vlan_id_t)0, fdbData});
             }
             else
             {
@@ -515,7 +728,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
             SWSS_LOG_NOTICE("fdbEvent: MAC age event received, MAC is MCLAG origin, added back"
                 "to HW type %s FDB %s in %s on %s",
                 existing_entry->second.type.c_str(),
-                update.entry.mac.to_string().c_str(), vlan.m_alias.c_str(),
+                update.entry.mac.to_string().c_str(), vlan ? vlan->m_alias.c_str() : "",
                 update.port.m_alias.c_str());
 
             status = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
@@ -523,7 +736,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
             {
                 SWSS_LOG_ERROR("Failed to create %s FDB %s in %s on %s, rv:%d",
                         existing_entry->second.type.c_str(), update.entry.mac.to_string().c_str(),
-                        vlan.m_alias.c_str(), update.port.m_alias.c_str(), status);
+                        vlan ? vlan->m_alias.c_str() : "", update.port.m_alias.c_str(), status);
             }
             return;
         }
@@ -534,14 +747,13 @@ void FdbOrch::update(sai_fdb_event_t        type,
             update.port.m_fdb_count--;
             m_portsOrch->setPort(update.port.m_alias, update.port);
         }
-        if (!vlan.m_alias.empty())
+        if (vlan)
         {
-            vlan.m_fdb_count--;
-            m_portsOrch->setPort(vlan.m_alias, vlan);
+            vlan->m_fdb_count--;
         }
         storeFdbEntryState(update);
 
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notifyFdbChange(update);
 
         notifyTunnelOrch(update.port);
         break;
@@ -616,7 +828,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         update.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
         storeFdbEntryState(update);
 
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notifyFdbChange(update);
 
         notifyTunnelOrch(port_old);
 
@@ -630,8 +842,8 @@ void FdbOrch::update(sai_fdb_event_t        type,
                        bridge_port_id);
 
         string vlanName = "-";
-        if (!vlan.m_alias.empty()) {
-            vlanName = "Vlan" + to_string(vlan.m_vlan_info.vlan_id);
+        if (vlan) {
+            vlanName = "Vlan" + to_string(vlan->m_vlan_info.vlan_id);
         }
 
         SWSS_LOG_INFO("FDB Flush: [ %s , %s ] = { port: %s }", update.entry.mac.to_string().c_str(),
@@ -929,6 +1141,52 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
         return;
     }
 
+    if (&consumer == m_fdbNotificationConsumer)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        consumer.pops(entries);
+
+        /* Handle all the pending FDB notifications as one batch */
+        m_fdbEventBatch = true;
+        for (auto& entry : entries)
+        {
+            if (kfvOp(entry) != "fdb_event")
+            {
+                continue;
+            }
+
+            uint32_t count;
+            sai_fdb_event_notification_data_t *fdbevent = nullptr;
+            sai_fdb_entry_type_t sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+            sai_deserialize_fdb_event_ntf(kfvKey(entry), count, &fdbevent);
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+
+                for (uint32_t j = 0; j < fdbevent[i].attr_count; ++j)
+                {
+                    if (fdbevent[i].attr[j].id == SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID)
+                    {
+                        oid = fdbevent[i].attr[j].value.oid;
+                    }
+                    else if (fdbevent[i].attr[j].id == SAI_FDB_ENTRY_ATTR_TYPE)
+                    {
+                        sai_fdb_type = (sai_fdb_entry_type_t)fdbevent[i].attr[j].value.s32;
+                    }
+                }
+
+                queueFdbEvent(fdbevent[i].event_type, fdbevent[i].fdb_entry, oid, sai_fdb_type);
+            }
+
+            sai_deserialize_free_fdb_event_ntf(count, fdbevent);
+        }
+        processFdbEvents();
+        flushFdbEventBatch();
+        return;
+    }
+
     sai_status_t status;
     std::string op;
     std::string data;
@@ -1045,35 +1303,6 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
             return;
         }
     }
-    else if (&consumer == m_fdbNotificationConsumer && op == "fdb_event")
-    {
-        uint32_t count;
-        sai_fdb_event_notification_data_t *fdbevent = nullptr;
-        sai_fdb_entry_type_t sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
-
-        sai_deserialize_fdb_event_ntf(data, count, &fdbevent);
-
-        for (uint32_t i = 0; i < count; ++i)
-        {
-            sai_object_id_t oid = SAI_NULL_OBJECT_ID;
-
-            for (uint32_t j = 0; j < fdbevent[i].attr_count; ++j)
-            {
-                if (fdbevent[i].attr[j].id == SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID)
-                {
-                    oid = fdbevent[i].attr[j].value.oid;
-                }
-                else if (fdbevent[i].attr[j].id == SAI_FDB_ENTRY_ATTR_TYPE)
-                {
-                    sai_fdb_type = (sai_fdb_entry_type_t)fdbevent[i].attr[j].value.s32;
-                }
-            }
-
-            this->update(fdbevent[i].event_type, &fdbevent[i].fdb_entry, oid, sai_fdb_type);
-        }
-
-        sai_deserialize_free_fdb_event_ntf(count, fdbevent);
-    }
 }
 
 /*
@@ -1133,15 +1362,28 @@ void FdbOrch::flushFDBEntries(sai_object_id_t bridge_port_oid,
     }
 
     if (SAI_STATUS_SUCCESS == rv) {
-        for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
-                it != m_entries.end(); it++)
+        /* entries on the bridge port or on the VLAN */
+        for (auto oid : { bridge_port_oid, vlan_oid })
         {
-            if ((bridge_port_oid != SAI_NULL_OBJECT_ID &&
-                    it->second.bridge_port_id == bridge_port_oid) ||
-                    (vlan_oid != SAI_NULL_OBJECT_ID &&
-                    it->first.bv_id == vlan_oid))
+            if (oid == SAI_NULL_OBJECT_ID)
             {
-                it->second.is_flush_pending = true;
+                continue;
+            }
+
+            auto& indexes = oid == bridge_port_oid ? m_entriesByBridgePort : m_entriesByBvId;
+            auto index = indexes.find(oid);
+            if (index == indexes.end())
+            {
+                continue;
+            }
+
+            for (const auto& key : index->second)
+            {
+                auto it = m_entries.find(key);
+                if (it != m_entries.end())
+                {
+                    it->second.is_flush_pending = true;
+                }
             }
         }
     }
@@ -1181,8 +1423,14 @@ void FdbOrch::notifyObserversFDBFlush(Port &port, sai_object_id_t& bvid)
     FdbFlushUpdate flushUpdate;
     flushUpdate.port = port;
 
-    for (auto itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+    for (const auto& key : getFdbEntries(SAI_NULL_OBJECT_ID, bvid))
     {
+        auto itr = m_entries.find(key);
+        if (itr == m_entries.end())
+        {
+            continue;
+        }
+
         if ((itr->first.port_name == port.m_alias) &&
             (itr->first.bv_id == bvid))
         {
@@ -1563,7 +1811,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         storeFdbData.type = "dynamic";
     }
 
-    m_entries[entry] = storeFdbData;
+    setFdbEntry(entry, storeFdbData);
 
     string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
 
@@ -1718,7 +1966,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
     m_portsOrch->setPort(port.m_alias, port);
     vlan.m_fdb_count--;
     m_portsOrch->setPort(vlan.m_alias, vlan);
-    (void)m_entries.erase(entry);
+    eraseFdbEntry(it);
 
     // Remove in StateDb
     if ((fdbData.origin != FDB_ORIGIN_VXLAN_ADVERTIZED) && (fdbData.origin != FDB_ORIGIN_MCLAG_ADVERTIZED))
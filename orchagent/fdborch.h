@@ -39,6 +39,17 @@ struct FdbUpdate
     sai_fdb_entry_type_t sai_fdb_type;
 };
 
+/* FDB learn/age/move event from the ASIC, queued until the batch of notifications is processed */
+struct FdbEvent
+{
+    sai_fdb_event_t type;
+    sai_fdb_entry_t entry;
+    sai_object_id_t bridge_port_id;
+    sai_fdb_entry_type_t sai_fdb_type;
+    /* later events of the MAC and bv_id were merged into this one */
+    bool coalesced;
+};
+
 struct FdbFlushUpdate
 {
     vector<FdbEntry> entries;
@@ -81,6 +92,9 @@ struct SavedFdbEntry
 
 typedef unordered_map<string, vector<SavedFdbEntry>> fdb_entries_by_port_t;
 
+/* FdbEntryIndex: bridge port or bv_id, keys (mac, bv_id) of the m_entries referring to it */
+typedef unordered_map<sai_object_id_t, set<FdbEntry>> FdbEntryIndex;
+
 class FdbOrch: public Orch, public Subject, public Observer
 {
 public:
@@ -109,6 +123,9 @@ public:
 private:
     PortsOrch *m_portsOrch;
     map<FdbEntry, FdbData> m_entries;
+    /* Indexes of m_entries, only modified through setFdbEntry() and eraseFdbEntry() */
+    FdbEntryIndex m_entriesByBridgePort;
+    FdbEntryIndex m_entriesByBvId;
     fdb_entries_by_port_t saved_fdb_entries;
     vector<Table*> m_appTables;
     Table m_fdbStateTable;
@@ -117,6 +134,13 @@ private:
     NotificationConsumer* m_fdbNotificationConsumer;
     shared_ptr<DBConnector> m_notificationsDb;
 
+    /* Batch of FDB notifications, see queueFdbEvent() */
+    bool m_fdbEventBatch;
+    vector<FdbEvent> m_fdbEvents;
+    map<FdbEntry, size_t> m_fdbEventIndex;
+    map<string, pair<bool, vector<FieldValueTuple>>> m_fdbStateWrites;
+    vector<FdbUpdate> m_fdbUpdates;
+
     void doTask(Consumer& consumer);
     void doTask(NotificationConsumer& consumer);
 
@@ -129,6 +153,17 @@ private:
     bool storeFdbEntryState(const FdbUpdate& update);
     void notifyTunnelOrch(Port& port);
 
+    void setFdbEntry(const FdbEntry&, const FdbData&);
+    void eraseFdbEntry(map<FdbEntry, FdbData>::iterator);
+    vector<FdbEntry> getFdbEntries(sai_object_id_t bridge_port_id, sai_object_id_t bv_id) const;
+
+    void queueFdbEvent(sai_fdb_event_t, const sai_fdb_entry_t&, sai_object_id_t, sai_fdb_entry_type_t);
+    void processFdbEvents();
+    void flushFdbEventBatch();
+    void setFdbState(const string& key, const vector<FieldValueTuple>& fvs);
+    void delFdbState(const string& key);
+    void notifyFdbChange(FdbUpdate& update);
+
     void clearFdbEntry(const FdbEntry&);
     void handleSyncdFlushNotif(const sai_object_id_t&, const sai_object_id_t&, const MacAddress&,
                                const sai_fdb_entry_type_t&);
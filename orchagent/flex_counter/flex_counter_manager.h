@@ -172,11 +172,15 @@ struct CachedObjects
         pending_objects_map[key].emplace(object_id);
     }
 
-    void flush(const std::string &group_name)
+    // Starts the polling of the cached objects, with one call per stats set.
+    // Returns the number of objects
+    size_t flush(const std::string &group_name)
     {
+        size_t count = 0;
+
         if (pending_objects_map.empty())
         {
-            return;
+            return count;
         }
 
         for (const auto& entry : pending_objects_map)
@@ -202,10 +206,13 @@ struct CachedObjects
             counter_keys.pop_back();
 
             startFlexCounterPolling(switch_id, counter_keys, counter_ids, counter_type_it->second);
+            count += pending_sai_objects.size();
         }
 
         /* Clear all cached entries after flush */
         pending_objects_map.clear();
+
+        return count;
     }
 };
 
@@ -222,14 +229,16 @@ class FlexCounterCachedManager : public FlexCounterManager
         {
         }
 
-        virtual void flush()
+        // Returns the number of objects whose polling was started
+        virtual size_t flush()
         {
+            return 0;
         }
 
     protected:
-        void flush(const std::string &group_name, struct CachedObjects &cached_objects)
+        size_t flush(const std::string &group_name, struct CachedObjects &cached_objects)
         {
-            cached_objects.flush(group_name);
+            return cached_objects.flush(group_name);
         }
 
         void setCounterIdList(
@@ -298,9 +307,9 @@ class FlexCounterTaggedCachedManager : public FlexCounterCachedManager
         {
         }
 
-        void flush()
+        size_t flush()
         {
-            FlexCounterCachedManager::flush(group_name, cached_objects);
+            return FlexCounterCachedManager::flush(group_name, cached_objects);
         }
 
         virtual void setCounterIdList(
@@ -339,12 +348,14 @@ class FlexCounterTaggedCachedManager<TagType, typename std::enable_if_t<std::is_
         {
         }
 
-        void flush()
+        size_t flush()
         {
+            size_t count = 0;
             for(auto &it : cached_objects)
             {
-                FlexCounterCachedManager::flush(group_name, it.second);
+                count += FlexCounterCachedManager::flush(group_name, it.second);
             }
+            return count;
         }
 
         void setCounterIdList(
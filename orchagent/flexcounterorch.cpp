@@ -1,5 +1,7 @@
+#include <chrono>
 #include <unordered_map>
 
+#include <converter.h>
 #include <select.h>
 #include <tokenize.h>
 #include <warm_restart.h>
@@ -18,10 +20,13 @@
 #include "switchorch.h"
 #include "debugcounterorch.h"
 #include "fabricportsorch.h"
+#include "intfsorch.h"
+#include "vxlanorch.h"
 
 #include "dash/dashorch.h"
 #include "dash/dashmeterorch.h"
 #include "flex_counter/flowcounterrouteorch.h"
+#include "countersreader.h"
 
 #include "flexcounterorch.h"
 
@@ -90,6 +95,23 @@ unordered_map<string, string> flexCounterGroupMap =
     {SWITCH_KEY, SWITCH_STAT_COUNTER_FLEX_COUNTER_GROUP}
 };
 
+// Rates groups which can be computed in orchagent, with the default poll interval of their counter group
+struct NativeRatesGroup
+{
+    string key;
+    string group;
+    string nameMap;
+    string pollInterval;
+};
+
+static const vector<NativeRatesGroup> nativeRatesGroups =
+{
+    {PORT_KEY, "PORT", COUNTERS_PORT_NAME_MAP, PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS},
+    {RIF_KEY, "RIF", COUNTERS_RIF_NAME_MAP, RIF_FLEX_STAT_COUNTER_POLL_MSECS},
+    {FLOW_CNT_TRAP_KEY, "TRAP", COUNTERS_TRAP_NAME_MAP, "10000"},
+    {TUNNEL_KEY, "TUNNEL", COUNTERS_TUNNEL_NAME_MAP, to_string(TUNNEL_STAT_FLEX_COUNTER_POLLING_INTERVAL_MS)}
+};
+
 
 FlexCounterOrch::FlexCounterOrch(DBConnector *db, vector<string> &tableNames):
     Orch(db, tableNames),
@@ -128,6 +150,11 @@ FlexCounterOrch::FlexCounterOrch(DBConnector *db, vector<string> &tableNames):
     {
         m_delayTimerExpired = true;
     }
+
+    if (isNativeRatesEnabled())
+    {
+        initNativeRates();
+    }
 }
 
 FlexCounterOrch::~FlexCounterOrch(void)
@@ -193,6 +220,7 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                 if (field == POLL_INTERVAL_FIELD)
                 {
                     setFlexCounterGroupPollInterval(flexCounterGroupMap[key], value);
+                    setNativeRatesPollInterval(key, value);
 
                     if (gPortsOrch && gPortsOrch->isGearboxEnabled())
                     {
@@ -333,6 +361,7 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                     }
 
                     setFlexCounterGroupOperation(flexCounterGroupMap[key], value);
+                    setNativeRatesState(key, value == "enable");
 
                     if (gPortsOrch && gPortsOrch->isGearboxEnabled())
                     {
@@ -366,10 +395,19 @@ void FlexCounterOrch::doTask(Consumer &consumer)
     }
 }
 
-void FlexCounterOrch::doTask(SelectableTimer&)
+void FlexCounterOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    for (auto &rates : m_nativeRates)
+    {
+        if (&timer == rates.second.timer)
+        {
+            pollNativeRates(rates.second);
+            return;
+        }
+    }
+
     if (m_delayTimerExpired)
     {
         return;
@@ -462,6 +500,240 @@ void FlexCounterOrch::handleDeviceMetadataTable(Consumer &consumer)
     }
 }
 
+void FlexCounterOrch::initNativeRates()
+{
+    SWSS_LOG_ENTER();
+
+    m_countersDb = make_shared<DBConnector>("COUNTERS_DB", 0);
+    m_countersTable = make_unique<Table>(m_countersDb.get(), COUNTERS_TABLE);
+    m_ratesTable = make_unique<Table>(m_countersDb.get(), RATES_TABLE_NAME);
+    m_applDb = make_shared<DBConnector>("APPL_DB", 0);
+    m_applPortTable = make_unique<Table>(m_applDb.get(), APP_PORT_TABLE_NAME);
+
+    for (const auto &group : nativeRatesGroups)
+    {
+        auto &rates = m_nativeRates[group.key];
+        rates.engine = RateEngine::create(group.group);
+        rates.nameMap = group.nameMap;
+
+        uint32_t pollInterval = to_uint<uint32_t>(group.pollInterval);
+        rates.engine->setPollInterval(pollInterval);
+        auto interv = timespec { .tv_sec = pollInterval / 1000, .tv_nsec = (pollInterval % 1000) * 1000000L };
+        rates.timer = new SelectableTimer(interv);
+        Orch::addExecutor(new ExecutableTimer(rates.timer, this, "NATIVE_RATES_" + group.group));
+
+        SWSS_LOG_NOTICE("%s rates are computed in orchagent", group.group.c_str());
+    }
+}
+
+void FlexCounterOrch::setNativeRatesPollInterval(const string &key, const string &pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_nativeRates.find(key);
+    if (it == m_nativeRates.end())
+    {
+        return;
+    }
+
+    uint32_t interval;
+    try
+    {
+        interval = to_uint<uint32_t>(pollInterval);
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid poll interval %s of %s rates: %s", pollInterval.c_str(), key.c_str(), e.what());
+        return;
+    }
+
+    if (interval == 0)
+    {
+        return;
+    }
+
+    it->second.engine->setPollInterval(interval);
+    auto interv = timespec { .tv_sec = interval / 1000, .tv_nsec = (interval % 1000) * 1000000L };
+    it->second.timer->setInterval(interv);
+    it->second.timer->reset();
+}
+
+void FlexCounterOrch::setNativeRatesState(const string &key, bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_nativeRates.find(key);
+    if (it == m_nativeRates.end())
+    {
+        return;
+    }
+
+    if (enable)
+    {
+        it->second.timer->start();
+    }
+    else
+    {
+        // The counters are not polled anymore, the rates restart from the first sample once enabled again
+        it->second.timer->stop();
+        it->second.engine->clear();
+        for (const auto &object : it->second.objects)
+        {
+            it->second.engine->addObject(object.second);
+        }
+    }
+}
+
+void FlexCounterOrch::pollNativeRates(NativeRates &rates)
+{
+    SWSS_LOG_ENTER();
+
+    auto &engine = *rates.engine;
+    const auto &group = engine.getGroup();
+
+    string alphaValue;
+    double alpha;
+    if (!m_ratesTable->hget(group, group + "_ALPHA", alphaValue))
+    {
+        SWSS_LOG_INFO("Alpha of %s rates is not defined", group.c_str());
+        return;
+    }
+    try
+    {
+        alpha = stod(alphaValue);
+    }
+    catch (...)
+    {
+        SWSS_LOG_WARN("Invalid alpha %s of %s rates", alphaValue.c_str(), group.c_str());
+        return;
+    }
+
+    auto portEngine = dynamic_cast<PortRateEngine *>(&engine);
+    if (portEngine)
+    {
+        updatePortLineRates(*portEngine, rates.objects);
+    }
+
+    // The counters of all objects are read in one pipeline
+    const auto &objects = engine.getObjects();
+    vector<string> keys;
+    for (const auto &key : objects)
+    {
+        keys.push_back(m_countersTable->getKeyName(key));
+    }
+    vector<RateEngine::Counters> entries;
+    readEntries(m_countersDb.get(), keys, entries);
+
+    unordered_map<string, const RateEngine::Counters *> counters;
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        counters.emplace(objects[i], &entries[i]);
+    }
+    auto reader = [&](const string &key) -> const RateEngine::Counters *
+    {
+        auto it = counters.find(key);
+        return it == counters.end() || it->second->empty() ? nullptr : it->second;
+    };
+
+    auto now = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+
+    RateEngine::RatesUpdates updates;
+    engine.poll(static_cast<uint64_t>(now), alpha, reader, updates);
+
+    // All objects of the group are written in a single pipeline
+    m_ratesTable->setBuffered(true);
+    for (const auto &update : updates)
+    {
+        m_ratesTable->set(update.first, update.second);
+    }
+    m_ratesTable->flush();
+    m_ratesTable->setBuffered(false);
+}
+
+FlexCounterOrch::NativeRates *FlexCounterOrch::getNativeRatesByNameMap(const string &nameMap)
+{
+    for (auto &rates : m_nativeRates)
+    {
+        if (rates.second.nameMap == nameMap)
+        {
+            return &rates.second;
+        }
+    }
+    return nullptr;
+}
+
+void FlexCounterOrch::setNativeRatesObject(const string &nameMap, const string &name, const string &oid)
+{
+    SWSS_LOG_ENTER();
+
+    auto rates = getNativeRatesByNameMap(nameMap);
+    if (!rates)
+    {
+        return;
+    }
+
+    auto it = rates->objects.find(name);
+    if (it != rates->objects.end())
+    {
+        if (it->second == oid)
+        {
+            return;
+        }
+        // The name now refers to another object
+        delNativeRatesObject(nameMap, name);
+    }
+
+    rates->objects[name] = oid;
+    rates->engine->addObject(oid);
+}
+
+void FlexCounterOrch::delNativeRatesObject(const string &nameMap, const string &name)
+{
+    SWSS_LOG_ENTER();
+
+    auto rates = getNativeRatesByNameMap(nameMap);
+    if (!rates)
+    {
+        return;
+    }
+
+    auto it = rates->objects.find(name);
+    if (it == rates->objects.end())
+    {
+        return;
+    }
+
+    rates->engine->removeObject(it->second);
+    m_portLaneCount.erase(it->second);
+    rates->objects.erase(it);
+}
+
+void FlexCounterOrch::updatePortLineRates(PortRateEngine &engine, const map<string, string> &names)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &name : names)
+    {
+        const auto &alias = name.first;
+        const auto &key = name.second;
+
+        // The lanes of a port OID don't change, they are read once
+        auto laneCount = m_portLaneCount.find(key);
+        if (laneCount == m_portLaneCount.end())
+        {
+            string lanes;
+            if (!m_applPortTable->hget(alias, "lanes", lanes))
+            {
+                continue;
+            }
+            laneCount = m_portLaneCount.emplace(key, tokenize(lanes, ',').size()).first;
+        }
+
+        const Port *port = gPortsOrch ? gPortsOrch->getPortPtr(alias) : nullptr;
+        engine.setLineRate(key, laneCount->second, port ? port->m_speed : 0);
+    }
+}
+
 bool FlexCounterOrch::bake()
 {
     /*
@@ -4,6 +4,7 @@
 #include "orch.h"
 #include "port.h"
 #include "producertable.h"
+#include "rateengine.h"
 #include "selectabletimer.h"
 #include "table.h"
 
@@ -70,9 +71,29 @@ public:
     bool getWredPortCountersState() const;
     bool isCreateOnlyConfigDbBuffers() const;
     bool bake() override;
+    // Objects of native rates, set by the orchs owning the counters name maps as they update them
+    void setNativeRatesObject(const std::string &nameMap, const std::string &name, const std::string &oid);
+    void delNativeRatesObject(const std::string &nameMap, const std::string &name);
 
 private:
+    // Rates of a counter group computed in orchagent, instead of the rate plugin run by syncd
+    struct NativeRates
+    {
+        std::unique_ptr<RateEngine> engine;
+        // Counters name map of the group, whose OIDs are the objects of the engine
+        std::string nameMap;
+        // OIDs of the name map by name
+        std::map<std::string, std::string> objects;
+        SelectableTimer *timer = nullptr;
+    };
+
     void handleDeviceMetadataTable(Consumer &consumer);
+    void initNativeRates();
+    void setNativeRatesPollInterval(const std::string &key, const std::string &pollInterval);
+    void setNativeRatesState(const std::string &key, bool enable);
+    void pollNativeRates(NativeRates &rates);
+    NativeRates *getNativeRatesByNameMap(const std::string &nameMap);
+    void updatePortLineRates(PortRateEngine &engine, const std::map<std::string, std::string> &names);
     bool m_port_counter_enabled = false;
     bool m_port_buffer_drop_counter_enabled = false;
     bool m_queue_enabled = false;
@@ -91,6 +112,16 @@ private:
     std::unordered_set<std::string> m_groupsWithBulkChunkSize;
 
     bool m_createOnlyConfigDbBuffers = false;
+
+    // Native rates by flex counter group key
+    std::map<std::string, NativeRates> m_nativeRates;
+    std::shared_ptr<swss::DBConnector> m_countersDb;
+    std::unique_ptr<swss::Table> m_countersTable;
+    std::unique_ptr<swss::Table> m_ratesTable;
+    std::shared_ptr<swss::DBConnector> m_applDb;
+    std::unique_ptr<swss::Table> m_applPortTable;
+    // Lane count of the ports by OID, from PORT_TABLE
+    std::unordered_map<std::string, size_t> m_portLaneCount;
 };
 
 #endif
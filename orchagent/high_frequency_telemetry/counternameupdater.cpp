@@ -19,18 +19,12 @@ void CounterNameMapUpdater::setCounterNameMap(const std::string &counter_name, s
 {
     SWSS_LOG_ENTER();
 
-    if (gHFTOrch)
+    notifyCounterNameMap(counter_name, oid);
+
+    if (m_buffered)
     {
-        std::string unified_counter_name = unify_counter_name(counter_name);
-        Message msg{
-            .m_table_name = m_table_name.c_str(),
-            .m_operation = OPERATION::SET,
-            .m_set{
-                .m_counter_name = unified_counter_name.c_str(),
-                .m_oid = oid,
-            },
-        };
-        gHFTOrch->locallyNotify(msg);
+        m_pending.emplace_back(counter_name, sai_serialize_object_id(oid));
+        return;
     }
 
     m_counters_table.hset("", counter_name, sai_serialize_object_id(oid));
@@ -40,19 +34,31 @@ void CounterNameMapUpdater::setCounterNameMap(const std::vector<swss::FieldValue
 {
     SWSS_LOG_ENTER();
 
+    if (counter_name_maps.empty())
+    {
+        return;
+    }
+
     if (gHFTOrch)
     {
         for (const auto& map : counter_name_maps)
         {
-            const std::string& counter_name = fvField(map);
             sai_object_id_t oid = SAI_NULL_OBJECT_ID;
             if (!fvValue(map).empty())
             {
                 sai_deserialize_object_id(fvValue(map), oid);
             }
-            setCounterNameMap(counter_name, oid);
+            notifyCounterNameMap(fvField(map), oid);
         }
     }
+
+    if (m_buffered)
+    {
+        m_pending.insert(m_pending.end(), counter_name_maps.begin(), counter_name_maps.end());
+        return;
+    }
+
+    m_counters_table.set("", counter_name_maps);
 }
 
 void CounterNameMapUpdater::delCounterNameMap(const std::string &counter_name)
@@ -72,9 +78,56 @@ void CounterNameMapUpdater::delCounterNameMap(const std::string &counter_name)
         gHFTOrch->locallyNotify(msg);
     }
 
+    // The name may still be pending
+    flush();
     m_counters_table.hdel("", counter_name);
 }
 
+void CounterNameMapUpdater::setBuffered(bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    if (!buffered)
+    {
+        flush();
+    }
+    m_buffered = buffered;
+}
+
+void CounterNameMapUpdater::flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pending.empty())
+    {
+        return;
+    }
+
+    m_counters_table.set("", m_pending);
+    m_pending.clear();
+}
+
+void CounterNameMapUpdater::notifyCounterNameMap(const std::string &counter_name, sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    if (!gHFTOrch)
+    {
+        return;
+    }
+
+    std::string unified_counter_name = unify_counter_name(counter_name);
+    Message msg{
+        .m_table_name = m_table_name.c_str(),
+        .m_operation = OPERATION::SET,
+        .m_set{
+            .m_counter_name = unified_counter_name.c_str(),
+            .m_oid = oid,
+        },
+    };
+    gHFTOrch->locallyNotify(msg);
+}
+
 std::string CounterNameMapUpdater::unify_counter_name(const std::string &counter_name)
 {
     SWSS_LOG_ENTER();
@@ -47,11 +47,19 @@ public:
     void setCounterNameMap(const std::vector<swss::FieldValueTuple> &counter_name_maps);
     void delCounterNameMap(const std::string &counter_name);
 
+    // When buffered, the names set are kept until flush() writes all of them with one HMSET
+    void setBuffered(bool buffered);
+    void flush();
+
 private:
     std::string m_db_name;
     std::string m_table_name;
     swss::DBConnector m_connector;
     swss::Table m_counters_table;
+    bool m_buffered = false;
+    std::vector<swss::FieldValueTuple> m_pending;
+
+    void notifyCounterNameMap(const std::string &counter_name, sai_object_id_t oid);
 
     std::string unify_counter_name(const std::string &counter_name);
 };
@@ -18,6 +18,8 @@
 #include "directory.h"
 #include "vnetorch.h"
 #include "subscriberstatetable.h"
+#include "rateengine.h"
+#include "flexcounterorch.h"
 
 extern sai_object_id_t gVirtualRouterId;
 extern Directory<Orch*> gDirectory;
@@ -84,8 +86,12 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
 
     try
     {
-        string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
-        rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+        // RIF rates computed in orchagent don't need the plugin
+        if (!isNativeRatesEnabled())
+        {
+            string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
+            rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+        }
     }
     catch (const runtime_error &e)
     {
@@ -110,9 +116,8 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
 
 sai_object_id_t IntfsOrch::getRouterIntfsId(const string &alias)
 {
-    Port port;
-    gPortsOrch->getPort(alias, port);
-    return port.m_rif_id;
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    return port ? port->m_rif_id : SAI_NULL_OBJECT_ID;
 }
 
 bool IntfsOrch::isPrefixSubnet(const IpPrefix &ip_prefix, const string &alias)
@@ -1536,6 +1541,12 @@ void IntfsOrch::addRifToFlexCounter(const string &id, const string &name, const
     m_rifNameTable->set("", rifNameVector);
     m_rifTypeTable->set("", rifTypeVector);
 
+    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+    if (flexCounterOrch)
+    {
+        flexCounterOrch->setNativeRatesObject(COUNTERS_RIF_NAME_MAP, name, id);
+    }
+
     /* update RIF in FLEX_COUNTER_DB */
     string key = getRifFlexCounterTableKey(id);
 
@@ -1559,6 +1570,12 @@ void IntfsOrch::removeRifFromFlexCounter(const string &id, const string &name)
     m_rifNameTable->hdel("", name);
     m_rifTypeTable->hdel("", id);
 
+    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+    if (flexCounterOrch)
+    {
+        flexCounterOrch->delNativeRatesObject(COUNTERS_RIF_NAME_MAP, name);
+    }
+
     /* remove it from FLEX_COUNTER_DB */
     string key = getRifFlexCounterTableKey(id);
 
@@ -1638,15 +1655,15 @@ void IntfsOrch::doTask(SelectableTimer &timer)
 
 bool IntfsOrch::isRemoteSystemPortIntf(string alias)
 {
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            return(port.m_system_lag_info.switch_id != gVoqMySwitchId);
+            return(port->m_system_lag_info.switch_id != gVoqMySwitchId);
         }
 
-        return(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE);
+        return(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE);
     }
     //Given alias is system port alias of the local port/LAG
     return false;
@@ -1654,15 +1671,15 @@ bool IntfsOrch::isRemoteSystemPortIntf(string alias)
 
 bool IntfsOrch::isLocalSystemPortIntf(string alias)
 {
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            return(port.m_system_lag_info.switch_id == gVoqMySwitchId);
+            return(port->m_system_lag_info.switch_id == gVoqMySwitchId);
         }
 
-        return(port.m_system_port_info.type != SAI_SYSTEM_PORT_TYPE_REMOTE);
+        return(port->m_system_port_info.type != SAI_SYSTEM_PORT_TYPE_REMOTE);
     }
     //Given alias is system port alias of the local port/LAG
     return false;
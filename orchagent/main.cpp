@@ -55,6 +55,7 @@ extern size_t gMaxBulkSize;
 extern int gBatchSize;
 
 bool gRingMode = false;
+int gRingSize = RING_SIZE;
 bool gSyncMode = false;
 sai_redis_communication_mode_t gRedisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 string gAsicInstance;
@@ -80,7 +81,7 @@ uint32_t create_switch_timeout = 0;
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-M]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-w record_mode] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-n ring_size] [-M] [-F]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -90,6 +91,10 @@ void usage()
     cout << "                    3: enable both above two records" << endl;
     cout << "                    7: enable sairedis.rec, swss.rec and responsepublisher.rec" << endl;
     cout << "    -d record_location: set record logs folder location (default .)" << endl;
+    cout << "    -w record_mode: write mode of swss.rec and responsepublisher.rec (default sync)" << endl;
+    cout << "                    sync: write and flush each record on the calling thread" << endl;
+    cout << "                    async: write records in groups on a background thread" << endl;
+    cout << "                    binary: as async, in a compact binary format (see swssrecconvert)" << endl;
     cout << "    -b batch_size: set consumer table pop operation batch size (default 128)" << endl;
     cout << "    -m MAC: set switch MAC address" << endl;
     cout << "    -i INST_ID: set the ASIC instance_id in multi-asic platform" << endl;
@@ -104,8 +109,10 @@ void usage()
     cout << "    -v vrf: VRF name (default empty)" << endl;
     cout << "    -I heart_beat_interval: Heart beat interval in millisecond (default 10)" << endl;
     cout << "    -R enable the ring thread feature" << endl;
+    cout << "    -n ring_size: set the ring buffer size of the ring thread feature (default 30)" << endl;
     cout << "    -M enable SAI MACSec POST" << endl;
     cout << "    -D Delay in seconds before flex counter processing begins after orchagent startup (default 0)" << endl;
+    cout << "    -F drain all consumers of all orchs after each event instead of only those with pending tasks" << endl;
 }
 
 void sighup_handler(int signo)
@@ -370,12 +377,14 @@ int main(int argc, char **argv)
     string vrf;
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
+    bool record_async = false;
+    bool record_binary = false;
     long heartBeatInterval = HEART_BEAT_INTERVAL_MSECS_DEFAULT;
 
     // Disable SAI MACSec POST by default. Use option -M to enable it.
     bool macsec_post_enabled = false;
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:t:v:I:R:D:M")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:w:i:hsz:k:q:c:t:v:I:R:n:D:MF")) != -1)
     {
         switch (opt)
         {
@@ -416,6 +425,22 @@ int main(int argc, char **argv)
                 exit(EXIT_FAILURE);
             }
             break;
+        case 'w':
+            if (optarg == string("async"))
+            {
+                record_async = true;
+            }
+            else if (optarg == string("binary"))
+            {
+                record_async = true;
+                record_binary = true;
+            }
+            else if (optarg != string("sync"))
+            {
+                usage();
+                exit(EXIT_FAILURE);
+            }
+            break;
         case 'h':
             usage();
             exit(EXIT_SUCCESS);
@@ -493,10 +518,28 @@ int main(int argc, char **argv)
         case 'R':
             gRingMode = true;
             break;
+        case 'n':
+            if (optarg)
+            {
+                auto size = atoi(optarg);
+                if (size > 1)
+                {
+                    gRingSize = size;
+                    SWSS_LOG_NOTICE("Setting ring buffer size as %d", gRingSize);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for ring buffer size: %d. Use default size: %d", size, gRingSize);
+                }
+            }
+            break;
          case 'M':
             macsec_post_enabled = true;
             break;
         case 'D': { gFlexCounterDelaySec = swss::to_int<int>(optarg); } break;
+        case 'F':
+            Orch::gFullSweep = true;
+            break;
         default: /* '?' */
             exit(EXIT_FAILURE);
         }
@@ -522,6 +565,8 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().swss.setLocation(record_location);
     Recorder::Instance().swss.setFileName(swss_rec_filename);
+    Recorder::Instance().swss.setAsync(record_async);
+    Recorder::Instance().swss.setBinary(record_binary);
     Recorder::Instance().swss.startRec(true);
 
     Recorder::Instance().respub.setRecord(
@@ -530,6 +575,8 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().respub.setLocation(record_location);
     Recorder::Instance().respub.setFileName(responsepublisher_rec_filename);
+    Recorder::Instance().respub.setAsync(record_async);
+    Recorder::Instance().respub.setBinary(record_binary);
     Recorder::Instance().respub.startRec(false);
 
     // Instantiate database connectors
@@ -899,7 +946,7 @@ int main(int argc, char **argv)
 
     if (gRingMode) {
         /* Initialize the ring before OrchDaemon initializing Orchs */
-        orchDaemon->enableRingBuffer();
+        orchDaemon->enableRingBuffer(gRingSize);
     }
 
     if (!orchDaemon->init())
@@ -688,21 +688,19 @@ bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
             {
                 string alias = tokenize(m_recoverySessionMap[name],
                         state_db_key_delimiter, 1)[0];
-                Port member;
-                m_portsOrch->getPort(alias, member);
+                const Port *member = m_portsOrch->getPortPtr(alias);
 
                 SWSS_LOG_NOTICE("Recover mirror session %s with LAG member port %s",
                         name.c_str(), alias.c_str());
-                session.neighborInfo.portId = member.m_port_id;
+                session.neighborInfo.portId = member ? member->m_port_id : SAI_NULL_OBJECT_ID;
             }
             else
             {
                 // Get the first member of the LAG
-                Port member;
                 string first_member_alias = *session.neighborInfo.port.m_members.begin();
-                m_portsOrch->getPort(first_member_alias, member);
+                const Port *member = m_portsOrch->getPortPtr(first_member_alias);
 
-                session.neighborInfo.portId = member.m_port_id;
+                session.neighborInfo.portId = member ? member->m_port_id : SAI_NULL_OBJECT_ID;
             }
 
             return true;
@@ -718,12 +716,11 @@ bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
             {
                 string alias = tokenize(m_recoverySessionMap[name],
                         state_db_key_delimiter, 1)[0];
-                Port member;
-                m_portsOrch->getPort(alias, member);
+                const Port *member = m_portsOrch->getPortPtr(alias);
 
                 SWSS_LOG_NOTICE("Recover mirror session %s with VLAN member port %s",
                         name.c_str(), alias.c_str());
-                session.neighborInfo.portId = member.m_port_id;
+                session.neighborInfo.portId = member ? member->m_port_id : SAI_NULL_OBJECT_ID;
             }
             else
             {
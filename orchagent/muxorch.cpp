@@ -95,109 +95,139 @@ static inline MuxStateChange mux_state_change (MuxState prev, MuxState curr)
     return MuxStateChange::MUX_STATE_UNKNOWN_STATE;
 }
 
-static sai_status_t create_route(IpPrefix &pfx, sai_object_id_t nh)
+static bool create_routes(EntityBulker<sai_route_api_t>& bulker, std::list<MuxRouteBulkContext>& bulk_ctx_list)
 {
-    sai_route_entry_t route_entry;
-    route_entry.switch_id = gSwitchId;
-    route_entry.vr_id = gVirtualRouterId;
-    copy(route_entry.destination, pfx);
-    subnet(route_entry.destination, route_entry.destination);
+    sai_status_t status;
+    bool ret = true;
 
-    sai_attribute_t attr;
-    vector<sai_attribute_t> attrs;
+    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
+    {
+        auto& object_statuses = ctx->object_statuses;
+        sai_route_entry_t route_entry;
+        route_entry.switch_id = gSwitchId;
+        route_entry.vr_id = gVirtualRouterId;
+        copy(route_entry.destination, ctx->pfx);
+        subnet(route_entry.destination, route_entry.destination);
 
-    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
-    attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
-    attrs.push_back(attr);
+        SWSS_LOG_INFO("Adding route entry %s, nh %" PRIx64 " to bulker", ctx->pfx.getIp().to_string().c_str(), ctx->nh);
 
-    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-    attr.value.oid = nh;
-    attrs.push_back(attr);
+        object_statuses.emplace_back();
+        sai_attribute_t attr;
+        vector<sai_attribute_t> attrs;
 
-    sai_status_t status = sai_route_api->create_route_entry(&route_entry, (uint32_t)attrs.size(), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS) {
-            SWSS_LOG_NOTICE("Tunnel route to %s already exists", pfx.to_string().c_str());
-            return SAI_STATUS_SUCCESS;
-        }
-        SWSS_LOG_ERROR("Failed to create tunnel route %s,nh %" PRIx64 " rv:%d",
-                pfx.getIp().to_string().c_str(), nh, status);
-        return status;
-    }
+        attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+        attrs.push_back(attr);
 
-    if (route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
-    {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+        attr.value.oid = ctx->nh;
+        attrs.push_back(attr);
+
+        status = bulker.create_entry(&object_statuses.back(), &route_entry, (uint32_t)attrs.size(), attrs.data());
     }
-    else
+
+    bulker.flush();
+
+    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
-    }
+        auto& object_statuses = ctx->object_statuses;
+        auto it_status = object_statuses.begin();
+        status = *it_status++;
 
-    SWSS_LOG_NOTICE("Created tunnel route to %s ", pfx.to_string().c_str());
-    return status;
-}
+        sai_route_entry_t route_entry;
+        route_entry.switch_id = gSwitchId;
+        route_entry.vr_id = gVirtualRouterId;
+        copy(route_entry.destination, ctx->pfx);
+        subnet(route_entry.destination, route_entry.destination);
 
-static sai_status_t remove_route(IpPrefix &pfx)
-{
-    sai_route_entry_t route_entry;
-    route_entry.switch_id = gSwitchId;
-    route_entry.vr_id = gVirtualRouterId;
-    copy(route_entry.destination, pfx);
-    subnet(route_entry.destination, route_entry.destination);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            if (status == SAI_STATUS_ITEM_ALREADY_EXISTS) {
+                SWSS_LOG_INFO("Tunnel route to %s already exists", ctx->pfx.to_string().c_str());
+                continue;
+            }
+            SWSS_LOG_ERROR("Failed to create tunnel route %s,nh %" PRIx64 " rv:%d",
+                    ctx->pfx.getIp().to_string().c_str(), ctx->nh, status);
+            ret = false;
+            continue;
+        }
 
-    sai_status_t status = sai_route_api->remove_route_entry(&route_entry);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        if (status == SAI_STATUS_ITEM_NOT_FOUND) {
-            SWSS_LOG_NOTICE("Tunnel route to %s already removed", pfx.to_string().c_str());
-            return SAI_STATUS_SUCCESS;
+        if (route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        }
+        else
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
         }
-        SWSS_LOG_ERROR("Failed to remove tunnel route %s, rv:%d",
-                        pfx.getIp().to_string().c_str(), status);
-        return status;
-    }
 
-    if (route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
-    {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
-    }
-    else
-    {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
+        SWSS_LOG_NOTICE("Created tunnel route to %s ", ctx->pfx.to_string().c_str());
     }
 
-    SWSS_LOG_NOTICE("Removed tunnel route to %s ", pfx.to_string().c_str());
-    return status;
+    bulker.clear();
+    return ret;
 }
 
-/**
- * @brief sets the given route to point to the given nexthop
- * @param pfx IpPrefix of the route
- * @param nexthop NextHopKey of the nexthop
- * @return SAI_STATUS_SUCCESS on success
- */
-static sai_status_t set_route(const IpPrefix& pfx, sai_object_id_t next_hop_id)
+static bool remove_routes(EntityBulker<sai_route_api_t>& bulker, std::list<MuxRouteBulkContext>& bulk_ctx_list)
 {
-    /* set route entry to point to nh */
-    sai_route_entry_t route_entry;
-    sai_attribute_t route_attr;
+    sai_status_t status;
+    bool ret = true;
+
+    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
+    {
+        auto& object_statuses = ctx->object_statuses;
+        sai_route_entry_t route_entry;
+        route_entry.switch_id = gSwitchId;
+        route_entry.vr_id = gVirtualRouterId;
+        copy(route_entry.destination, ctx->pfx);
+        subnet(route_entry.destination, route_entry.destination);
 
-    route_entry.vr_id = gVirtualRouterId;
-    route_entry.switch_id = gSwitchId;
-    copy(route_entry.destination, pfx);
+        SWSS_LOG_INFO("Removing route entry %s, nh %" PRIx64 "", ctx->pfx.getIp().to_string().c_str(), ctx->nh);
 
-    route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-    route_attr.value.oid = next_hop_id;
+        object_statuses.emplace_back();
+        status = bulker.remove_entry(&object_statuses.back(), &route_entry);
+    }
 
-    sai_status_t status = sai_route_api->set_route_entry_attribute(&route_entry, &route_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    bulker.flush();
+
+    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
-        SWSS_LOG_ERROR("Failed to set route entry %s nh %" PRIx64 " rv:%d",
-                pfx.to_string().c_str(), next_hop_id, status);
+        auto& object_statuses = ctx->object_statuses;
+        auto it_status = object_statuses.begin();
+        status = *it_status++;
+
+        sai_route_entry_t route_entry;
+        route_entry.switch_id = gSwitchId;
+        route_entry.vr_id = gVirtualRouterId;
+        copy(route_entry.destination, ctx->pfx);
+        subnet(route_entry.destination, route_entry.destination);
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            if (status == SAI_STATUS_ITEM_NOT_FOUND) {
+                SWSS_LOG_INFO("Tunnel route to %s already removed", ctx->pfx.to_string().c_str());
+                continue;
+            }
+            SWSS_LOG_ERROR("Failed to remove tunnel route %s, rv:%d",
+                            ctx->pfx.getIp().to_string().c_str(), status);
+            ret = false;
+            continue;
+        }
+
+        if (route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        }
+        else
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
+        }
+
+        SWSS_LOG_NOTICE("Removed tunnel route to %s ", ctx->pfx.to_string().c_str());
     }
-    return status;
+
+    bulker.clear();
+    return ret;
 }
 
 static sai_object_id_t create_tunnel(
@@ -677,6 +707,7 @@ void MuxCable::updateRoutes()
 {
     MuxNeighbor neighbors = nbr_handler_->getNeighbors();
     string alias = nbr_handler_->getAlias();
+    std::set<IpPrefix> prefixes;
     for (auto nh = neighbors.begin(); nh != neighbors.end(); nh ++)
     {
         std::set<RouteKey> routes;
@@ -687,10 +718,13 @@ void MuxCable::updateRoutes()
             {
                 SWSS_LOG_NOTICE("Checking route %s for multi-mux nexthops",
                               rt->prefix.to_string().c_str());
-                mux_orch_->updateRoute(rt->prefix);
+                prefixes.insert(rt->prefix);
             }
         }
     }
+
+    /* routes shared by several neighbors of the cable are updated once */
+    mux_orch_->updateRoutes(prefixes);
 }
 
 /**
@@ -704,16 +738,19 @@ void MuxCable::updateRoutesForNextHop(NextHopKey nh)
     {
         SWSS_LOG_NOTICE("Updating multi-mux routes with nexthop: %s",
                         nh.ip_address.to_string().c_str());
+        std::set<IpPrefix> prefixes;
         for (auto rt = routes.begin(); rt != routes.end(); rt++)
         {
-            mux_orch_->updateRoute(rt->prefix);
+            prefixes.insert(rt->prefix);
         }
+        mux_orch_->updateRoutes(prefixes);
     }
 }
 
 void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, MuxState state)
 {
     uint32_t num_routes = 0;
+    std::list<MuxRouteBulkContext> route_ctx_list;
 
     SWSS_LOG_INFO("Neigh %s on %s, add %d, state %d",
                    nh.ip_address.to_string().c_str(), nh.alias.c_str(), add, state);
@@ -749,7 +786,8 @@ void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, Mu
             gNeighOrch->decreaseNextHopRefCount(nh, num_routes);
             gNeighOrch->disableNeighbor(nh);
             updateTunnelRoute(nh, true);
-            create_route(pfx, tunnelId);
+            route_ctx_list.push_back(MuxRouteBulkContext(pfx, tunnelId));
+            addRoutes(route_ctx_list);
             break;
         default:
             SWSS_LOG_NOTICE("State '%s' not handled for nbr %s update",
@@ -762,7 +800,8 @@ void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, Mu
         /* if current state is standby, remove the tunnel route */
         if (state == MuxState::MUX_STATE_STANDBY)
         {
-            remove_route(pfx);
+            route_ctx_list.push_back(MuxRouteBulkContext(pfx));
+            removeRoutes(route_ctx_list);
             updateTunnelRoute(nh, false);
         }
         neighbors_.erase(nh.ip_address);
@@ -791,24 +830,30 @@ bool MuxNbrHandler::enable(bool update_rt)
         return false;
     }
 
+    /* Update NHs to point to learned neighbors */
+    std::vector<NextHopRouteUpdate> route_updates;
+    route_updates.reserve(neighbors_.size());
+    for (auto& nbr : neighbors_)
+    {
+        neigh = NeighborEntry(nbr.first, alias_);
+        route_updates.emplace_back(NextHopKey(nbr.first, alias_), nbr.second);
+        nbr.second = gNeighOrch->getLocalNextHopId(neigh);
+    }
+
+    /* Reprogram the routes of all neighbors in one bulk */
+    if (!updateNextHopRoutes(route_updates))
+    {
+        return false;
+    }
+
+    auto route_update = route_updates.begin();
     it = neighbors_.begin();
     while (it != neighbors_.end())
     {
-        /* Update NH to point to learned neighbor */
-        neigh = NeighborEntry(it->first, alias_);
-        it->second = gNeighOrch->getLocalNextHopId(neigh);
-
-        /* Reprogram route */
         NextHopKey nh_key = NextHopKey(it->first, alias_);
-        uint32_t num_routes = 0;
-        if (!gRouteOrch->updateNextHopRoutes(nh_key, num_routes))
-        {
-            SWSS_LOG_INFO("Update route failed for NH %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
 
         /* Increment ref count for new NHs */
-        gNeighOrch->increaseNextHopRefCount(nh_key, num_routes);
+        gNeighOrch->increaseNextHopRefCount(nh_key, (route_update++)->numRoutes);
 
         /*
          * Invalidate current nexthop group and update with new NH
@@ -854,25 +899,31 @@ bool MuxNbrHandler::disable(sai_object_id_t tnh)
     std::list<NeighborContext> neigh_ctx_list;
     std::list<MuxRouteBulkContext> route_ctx_list;
 
-    auto it = neighbors_.begin();
-    while (it != neighbors_.end())
+    /* Update NHs to point to Tunnel nexhtop */
+    std::vector<NextHopRouteUpdate> route_updates;
+    route_updates.reserve(neighbors_.size());
+    for (auto& nbr : neighbors_)
     {
-        SWSS_LOG_INFO("Disabling neigh %s on %s", it->first.to_string().c_str(), alias_.c_str());
+        SWSS_LOG_INFO("Disabling neigh %s on %s", nbr.first.to_string().c_str(), alias_.c_str());
+
+        route_updates.emplace_back(NextHopKey(nbr.first, alias_), nbr.second);
+        nbr.second = tnh;
+    }
 
-        /* Update NH to point to Tunnel nexhtop */
-        it->second = tnh;
+    /* Reprogram the routes of all neighbors in one bulk */
+    if (!updateNextHopRoutes(route_updates))
+    {
+        return false;
+    }
 
-        /* Reprogram route */
+    auto route_update = route_updates.begin();
+    auto it = neighbors_.begin();
+    while (it != neighbors_.end())
+    {
         NextHopKey nh_key = NextHopKey(it->first, alias_);
-        uint32_t num_routes = 0;
-        if (!gRouteOrch->updateNextHopRoutes(nh_key, num_routes))
-        {
-            SWSS_LOG_INFO("Update route failed for NH %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
 
         /* Decrement ref count for old NHs */
-        gNeighOrch->decreaseNextHopRefCount(nh_key, num_routes);
+        gNeighOrch->decreaseNextHopRefCount(nh_key, (route_update++)->numRoutes);
 
         /* Invalidate current nexthop group and update with new NH */
         uint32_t nh_removed, nh_added;
@@ -927,139 +978,32 @@ sai_object_id_t MuxNbrHandler::getNextHopId(const NextHopKey nhKey)
     return SAI_NULL_OBJECT_ID;
 }
 
-bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+bool MuxNbrHandler::updateNextHopRoutes(std::vector<NextHopRouteUpdate>& route_updates)
 {
-    sai_status_t status;
-    bool ret = true;
-
-    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
+    if (gRouteOrch->updateNextHopRoutes(route_updates))
     {
-        auto& object_statuses = ctx->object_statuses;
-        sai_route_entry_t route_entry;
-        route_entry.switch_id = gSwitchId;
-        route_entry.vr_id = gVirtualRouterId;
-        copy(route_entry.destination, ctx->pfx);
-        subnet(route_entry.destination, route_entry.destination);
-
-        SWSS_LOG_INFO("Adding route entry %s, nh %" PRIx64 " to bulker", ctx->pfx.getIp().to_string().c_str(), ctx->nh);
-
-        object_statuses.emplace_back();
-        sai_attribute_t attr;
-        vector<sai_attribute_t> attrs;
-
-        attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
-        attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
-        attrs.push_back(attr);
-
-        attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-        attr.value.oid = ctx->nh;
-        attrs.push_back(attr);
-
-        status = gRouteBulker.create_entry(&object_statuses.back(), &route_entry, (uint32_t)attrs.size(), attrs.data());
+        return true;
     }
 
-    gRouteBulker.flush();
-
-    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
+    /* routes already updated are restored to the previous NHs */
+    SWSS_LOG_INFO("Update route failed for neighbors on %s", alias_.c_str());
+    auto route_update = route_updates.begin();
+    for (auto& nbr : neighbors_)
     {
-        auto& object_statuses = ctx->object_statuses;
-        auto it_status = object_statuses.begin();
-        status = *it_status++;
-
-        sai_route_entry_t route_entry;
-        route_entry.switch_id = gSwitchId;
-        route_entry.vr_id = gVirtualRouterId;
-        copy(route_entry.destination, ctx->pfx);
-        subnet(route_entry.destination, route_entry.destination);
-
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            if (status == SAI_STATUS_ITEM_ALREADY_EXISTS) {
-                SWSS_LOG_INFO("Tunnel route to %s already exists", ctx->pfx.to_string().c_str());
-                continue;
-            }
-            SWSS_LOG_ERROR("Failed to create tunnel route %s,nh %" PRIx64 " rv:%d",
-                    ctx->pfx.getIp().to_string().c_str(), ctx->nh, status);
-            ret = false;
-            continue;
-        }
-
-        if (route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
-        {
-            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
-        }
-        else
-        {
-            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
-        }
-
-        SWSS_LOG_NOTICE("Created tunnel route to %s ", ctx->pfx.to_string().c_str());
+        nbr.second = (route_update++)->rollbackNextHopId;
     }
 
-    gRouteBulker.clear();
-    return ret;
+    return false;
 }
 
-bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
 {
-    sai_status_t status;
-    bool ret = true;
-
-    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
-    {
-        auto& object_statuses = ctx->object_statuses;
-        sai_route_entry_t route_entry;
-        route_entry.switch_id = gSwitchId;
-        route_entry.vr_id = gVirtualRouterId;
-        copy(route_entry.destination, ctx->pfx);
-        subnet(route_entry.destination, route_entry.destination);
-
-        SWSS_LOG_INFO("Removing route entry %s, nh %" PRIx64 "", ctx->pfx.getIp().to_string().c_str(), ctx->nh);
-
-        object_statuses.emplace_back();
-        status = gRouteBulker.remove_entry(&object_statuses.back(), &route_entry);
-    }
-
-    gRouteBulker.flush();
-
-    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
-    {
-        auto& object_statuses = ctx->object_statuses;
-        auto it_status = object_statuses.begin();
-        status = *it_status++;
-
-        sai_route_entry_t route_entry;
-        route_entry.switch_id = gSwitchId;
-        route_entry.vr_id = gVirtualRouterId;
-        copy(route_entry.destination, ctx->pfx);
-        subnet(route_entry.destination, route_entry.destination);
-
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            if (status == SAI_STATUS_ITEM_NOT_FOUND) {
-                SWSS_LOG_INFO("Tunnel route to %s already removed", ctx->pfx.to_string().c_str());
-                continue;
-            }
-            SWSS_LOG_ERROR("Failed to remove tunnel route %s, rv:%d",
-                            ctx->pfx.getIp().to_string().c_str(), status);
-            ret = false;
-            continue;
-        }
-
-        if (route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
-        {
-            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
-        }
-        else
-        {
-            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
-        }
-
-        SWSS_LOG_NOTICE("Removed tunnel route to %s ", ctx->pfx.to_string().c_str());
-    }
+    return create_routes(gRouteBulker, bulk_ctx_list);
+}
 
-    gRouteBulker.clear();
-    return ret;
+bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+{
+    return remove_routes(gRouteBulker, bulk_ctx_list);
 }
 
 void MuxNbrHandler::updateTunnelRoute(NextHopKey nh, bool add)
@@ -1288,95 +1232,194 @@ sai_object_id_t MuxOrch::getTunnelNextHopId()
  */
 void MuxOrch::updateRoute(const IpPrefix &pfx)
 {
-    NextHopGroupKey nhg_key;
-    NextHopGroupEntry nhg_entry;
-
-    /* get nexthop group key from syncd */
-    nhg_key = gRouteOrch->getSyncdRouteNhgKey(gVirtualRouterId, pfx);
+    updateRoutes(std::set<IpPrefix>{ pfx });
+}
 
-    /* check for multi-nh neighbors.
-     * if none are present, ignore
-     */
-    if (nhg_key.getSize() <= 1)
+/**
+ * @brief updates the given routes to point to a single active NH or tunnel
+ *        routes are set in bulk, a route whose active NH can't be set is
+ *        pointed to the tunnel in a second bulk
+ * @param prefixes IpPrefixes of routes to update
+ */
+void MuxOrch::updateRoutes(const std::set<IpPrefix> &prefixes)
+{
+    struct RouteUpdate
     {
-        SWSS_LOG_INFO("Route points to single nexthop, ignoring");
-        return;
-    }
+        const IpPrefix *pfx;
+        sai_route_entry_t entry;
+        sai_object_id_t next_hop_id;
+        sai_status_t status;
+        bool tunnel;
+    };
 
-    std::set<NextHopKey> nextHops;
-    sai_object_id_t next_hop_id;
-    sai_status_t status;
-    bool active_found = false;
-
-    /* get nexthops from nexthop group */
-    nextHops = nhg_key.getNextHops();
+    std::vector<RouteUpdate> updates;
+    sai_attribute_t route_attr;
+    route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
 
-    SWSS_LOG_NOTICE("Updating route %s pointing to Mux nexthops %s",
-                pfx.to_string().c_str(), nhg_key.to_string().c_str());
+    /* The bulker keeps pointers to the entries, no reallocation allowed */
+    updates.reserve(prefixes.size());
 
-    for (auto it = nextHops.begin(); it != nextHops.end(); it++)
+    for (const auto &pfx : prefixes)
     {
-        NextHopKey nexthop = *it;
-        NeighborEntry neighbor;
-        MacAddress mac;
+        /* get nexthop group key from syncd */
+        NextHopGroupKey nhg_key = gRouteOrch->getSyncdRouteNhgKey(gVirtualRouterId, pfx);
 
-        if (!gNeighOrch->getNeighborEntry(nexthop, neighbor, mac))
+        /* check for multi-nh neighbors.
+         * if none are present, ignore
+         */
+        if (nhg_key.getSize() <= 1)
         {
-            // Not able to get neighbor entry, so skip.
-            SWSS_LOG_NOTICE("Neighbor entry for nexthop %s not found.",
-                            nexthop.to_string().c_str());
+            SWSS_LOG_INFO("Route %s points to single nexthop, ignoring", pfx.to_string().c_str());
             continue;
         }
 
-        if (isNeighborActive(neighbor.ip_address, mac, neighbor.alias))
+        SWSS_LOG_NOTICE("Updating route %s pointing to Mux nexthops %s",
+                    pfx.to_string().c_str(), nhg_key.to_string().c_str());
+
+        RouteUpdate update;
+        update.pfx = &pfx;
+        update.next_hop_id = SAI_NULL_OBJECT_ID;
+        update.status = SAI_STATUS_NOT_EXECUTED;
+        update.tunnel = true;
+
+        for (const auto &nexthop : nhg_key.getNextHops())
         {
-            /* Here we pull from local nexthop ID because neighbor update occurs during state change
-             * before nexthopID is updated in neighorch. This ensures that if a neighbor is Active
-             * only that neighbor's nexthop ID is added, and not the tunnel nexthop
-             */
-            next_hop_id = gNeighOrch->getLocalNextHopId(nexthop);
-            /* set route entry to point to nh */
-            status = set_route(pfx, next_hop_id);
-            if (status != SAI_STATUS_SUCCESS)
+            NeighborEntry neighbor;
+            MacAddress mac;
+
+            if (!gNeighOrch->getNeighborEntry(nexthop, neighbor, mac))
             {
-                SWSS_LOG_ERROR("Failed to set route entry %s to nexthop %s",
-                        pfx.to_string().c_str(), neighbor.to_string().c_str());
+                // Not able to get neighbor entry, so skip.
+                SWSS_LOG_NOTICE("Neighbor entry for nexthop %s not found.",
+                                nexthop.to_string().c_str());
                 continue;
             }
-            SWSS_LOG_NOTICE("setting route %s with nexthop %s %" PRIx64 "",
-                pfx.to_string().c_str(), neighbor.to_string().c_str(), next_hop_id);
-            active_found = true;
-            break;
+
+            if (isNeighborActive(neighbor.ip_address, mac, neighbor.alias))
+            {
+                /* Here we pull from local nexthop ID because neighbor update occurs during state change
+                 * before nexthopID is updated in neighorch. This ensures that if a neighbor is Active
+                 * only that neighbor's nexthop ID is added, and not the tunnel nexthop
+                 */
+                update.next_hop_id = gNeighOrch->getLocalNextHopId(nexthop);
+                update.tunnel = false;
+                SWSS_LOG_NOTICE("setting route %s with nexthop %s %" PRIx64 "",
+                    pfx.to_string().c_str(), neighbor.to_string().c_str(), update.next_hop_id);
+                break;
+            }
+        }
+
+        if (update.tunnel)
+        {
+            /* no active nexthop found, point to tunnel */
+            SWSS_LOG_INFO("No Active neighbors found, setting route %s to point to tun",
+                        pfx.getIp().to_string().c_str());
+            update.next_hop_id = getNextHopTunnelId(MUX_TUNNEL, mux_peer_switch_);
         }
+
+        update.entry.vr_id = gVirtualRouterId;
+        update.entry.switch_id = gSwitchId;
+        copy(update.entry.destination, pfx);
+
+        updates.push_back(update);
+        route_attr.value.oid = update.next_hop_id;
+        route_bulker_.set_entry_attribute(&updates.back().status, &updates.back().entry, &route_attr);
     }
 
-    if (!active_found)
+    if (updates.empty())
     {
-        next_hop_id = getNextHopTunnelId(MUX_TUNNEL, mux_peer_switch_);
-        /* no active nexthop found, point to first */
-        SWSS_LOG_INFO("No Active neighbors found, setting route %s to point to tun",
-                    pfx.getIp().to_string().c_str());
-        status = set_route(pfx, next_hop_id);
-        if (status != SAI_STATUS_SUCCESS)
+        return;
+    }
+
+    route_bulker_.flush();
+
+    bool fallback = false;
+    for (auto &update : updates)
+    {
+        if (update.status == SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        SWSS_LOG_ERROR("Failed to set route entry %s nh %" PRIx64 " rv:%d",
+                update.pfx->to_string().c_str(), update.next_hop_id, update.status);
+
+        if (update.tunnel)
         {
             SWSS_LOG_ERROR("Failed to set route entry %s to tunnel",
-                    pfx.getIp().to_string().c_str());
+                    update.pfx->getIp().to_string().c_str());
+            continue;
+        }
+
+        /* active nexthop couldn't be set, fall back to the tunnel */
+        update.next_hop_id = getNextHopTunnelId(MUX_TUNNEL, mux_peer_switch_);
+        update.status = SAI_STATUS_NOT_EXECUTED;
+        update.tunnel = true;
+        route_attr.value.oid = update.next_hop_id;
+        route_bulker_.set_entry_attribute(&update.status, &update.entry, &route_attr);
+        fallback = true;
+    }
+
+    if (!fallback)
+    {
+        return;
+    }
+
+    route_bulker_.flush();
+
+    for (const auto &update : updates)
+    {
+        if (update.tunnel && update.status != SAI_STATUS_SUCCESS && update.status != SAI_STATUS_NOT_EXECUTED)
+        {
+            SWSS_LOG_ERROR("Failed to set route entry %s to tunnel rv:%d",
+                    update.pfx->getIp().to_string().c_str(), update.status);
         }
     }
 }
 
 MuxCable* MuxOrch::findMuxCableInSubnet(IpAddress ip)
 {
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    /* Among the cables with a server subnet containing the address, the first one by port name */
+    const string *port = nullptr;
+    mux_subnet_tb_.forEachCovering(ip, [&port](const IpPrefix&, const std::set<string>& ports)
+    {
+        if (!port || *ports.begin() < *port)
+        {
+            port = &*ports.begin();
+        }
+    });
+
+    if (!port)
+    {
+        return nullptr;
+    }
+
+    return mux_cable_tb_.at(*port).get();
+}
+
+void MuxOrch::addMuxSubnet(const IpPrefix& subnet, const string& port_name)
+{
+    auto ports = mux_subnet_tb_.find(subnet);
+    if (!ports)
     {
-       MuxCable* ptr = it->second.get();
-       if (ptr->isIpInSubnet(ip))
-       {
-           return ptr;
-       }
+        ports = &mux_subnet_tb_.insert(subnet, {});
+    }
+    ports->insert(port_name);
+}
+
+void MuxOrch::removeMuxSubnet(const IpPrefix& subnet, const string& port_name)
+{
+    auto ports = mux_subnet_tb_.find(subnet);
+    if (!ports)
+    {
+        return;
     }
 
-    return nullptr;
+    ports->erase(port_name);
+    if (ports->empty())
+    {
+        mux_subnet_tb_.erase(subnet);
+    }
 }
 
 bool MuxOrch::isNeighborActive(const IpAddress& nbr, const MacAddress& mac, string& alias)
@@ -1527,14 +1570,11 @@ void MuxOrch::updateNeighbor(const NeighborUpdate& update)
         removeStandaloneTunnelRoute(update.entry.ip_address);
     }
 
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    MuxCable* ptr = findMuxCableInSubnet(update.entry.ip_address);
+    if (ptr)
     {
-        MuxCable* ptr = it->second.get();
-        if (ptr->isIpInSubnet(update.entry.ip_address))
-        {
-            ptr->updateNeighbor(update.entry, update.add);
-            return;
-        }
+        ptr->updateNeighbor(update.entry, update.add);
+        return;
     }
 
     string port, old_port;
@@ -1569,7 +1609,6 @@ void MuxOrch::updateNeighbor(const NeighborUpdate& update)
         }
     }
 
-    MuxCable* ptr;
     if (!old_port.empty() && old_port != port && isMuxExists(old_port))
     {
         ptr = getMuxCable(old_port);
@@ -1709,7 +1748,8 @@ MuxOrch::MuxOrch(DBConnector *db, const std::vector<std::string> &tables,
          Orch2(db, tables, request_),
          decap_orch_(decapOrch),
          neigh_orch_(neighOrch),
-         fdb_orch_(fdbOrch)
+         fdb_orch_(fdbOrch),
+         route_bulker_(sai_route_api, gMaxBulkSize)
 {
     handler_map_.insert(handler_pair(CFG_MUX_CABLE_TABLE_NAME, &MuxOrch::handleMuxCfg));
     handler_map_.insert(handler_pair(CFG_PEER_SWITCH_TABLE_NAME, &MuxOrch::handlePeerSwitch));
@@ -1771,6 +1811,8 @@ bool MuxOrch::handleMuxCfg(const Request& request)
 
         mux_cable_tb_[port_name] = std::make_unique<MuxCable>
                                    (MuxCable(port_name, srv_ip, srv_ip6, mux_peer_switch_, cable_type));
+        addMuxSubnet(srv_ip, port_name);
+        addMuxSubnet(srv_ip6, port_name);
         addSkipNeighbors(skip_neighbors);
 
         // Add neighbors that were learned before this mux port was configured.
@@ -1804,6 +1846,8 @@ bool MuxOrch::handleMuxCfg(const Request& request)
         }
 
         removeSkipNeighbors(skip_neighbors);
+        removeMuxSubnet(getMuxCable(port_name)->getServerIpv4(), port_name);
+        removeMuxSubnet(getMuxCable(port_name)->getServerIpv6(), port_name);
         mux_cable_tb_.erase(port_name);
 
         SWSS_LOG_NOTICE("Mux cable for port '%s' was removed", port_name.c_str());
@@ -1926,16 +1970,18 @@ void MuxOrch::createStandaloneTunnelRoute(IpAddress neighborIp)
         SWSS_LOG_NOTICE("%s nexthop not created yet, ignoring tunnel route creation for %s", MUX_TUNNEL, neighborIp.to_string().c_str());
         return;
     }
-    IpPrefix pfx = neighborIp.to_string();
-    create_route(pfx, tunnel_nexthop);
+    std::list<MuxRouteBulkContext> route_ctx_list;
+    route_ctx_list.push_back(MuxRouteBulkContext(neighborIp.to_string(), tunnel_nexthop));
+    create_routes(route_bulker_, route_ctx_list);
     standalone_tunnel_neighbors_.insert(neighborIp);
 }
 
 void MuxOrch::removeStandaloneTunnelRoute(IpAddress neighborIp)
 {
     SWSS_LOG_INFO("Removing standalone tunnel route for neighbor %s", neighborIp.to_string().c_str());
-    IpPrefix pfx = neighborIp.to_string();
-    remove_route(pfx);
+    std::list<MuxRouteBulkContext> route_ctx_list;
+    route_ctx_list.push_back(MuxRouteBulkContext(neighborIp.to_string()));
+    remove_routes(route_bulker_, route_ctx_list);
     standalone_tunnel_neighbors_.erase(neighborIp);
 }
 
@@ -11,6 +11,7 @@
 #include "aclorch.h"
 #include "neighorch.h"
 #include "bulker.h"
+#include "prefixtrie.h"
 
 enum MuxState
 {
@@ -60,6 +61,7 @@ extern sai_route_api_t* sai_route_api;
 class MuxOrch;
 class MuxCableOrch;
 class MuxStateOrch;
+struct NextHopRouteUpdate;
 
 // Mux ACL Handler for adding/removing ACLs
 class MuxAclHandler
@@ -97,6 +99,7 @@ public:
     void clearBulkers() { gRouteBulker.clear(); };
 
 private:
+    bool updateNextHopRoutes(std::vector<NextHopRouteUpdate>& route_updates);
     bool removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list);
     bool addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list);
 
@@ -129,6 +132,8 @@ public:
     bool isStateChangeFailed() { return st_chg_failed_; }
 
     bool isIpInSubnet(IpAddress ip);
+    const IpPrefix& getServerIpv4() const { return srv_ip4_; }
+    const IpPrefix& getServerIpv6() const { return srv_ip6_; }
     void updateNeighbor(NextHopKey nh, bool add);
     void updateRoutes();
     void updateRoutesForNextHop(NextHopKey nh);
@@ -191,6 +196,8 @@ typedef std::map<std::string, MuxCable_T> MuxCableTb;
 typedef std::map<IpAddress, NHTunnel> MuxTunnelNHs;
 typedef std::map<NextHopKey, std::string> NextHopTb;
 typedef std::map<IpPrefix, NextHopKey> MuxRouteTb;
+/* MuxSubnetTb: server subnet, mux cables (port names) with it */
+typedef PrefixTrie<std::set<std::string>> MuxSubnetTb;
 
 class MuxCfgRequest : public Request
 {
@@ -239,6 +246,7 @@ public:
     sai_object_id_t getTunnelNextHopId();
 
     void updateRoute(const IpPrefix &pfx);
+    void updateRoutes(const std::set<IpPrefix> &prefixes);
     bool isStandaloneTunnelRouteInstalled(const IpAddress& neighborIp);
 
     void enableCachingNeighborUpdate()
@@ -262,6 +270,9 @@ private:
     void updateNeighbor(const NeighborUpdate&);
     void updateFdb(const FdbUpdate&);
 
+    void addMuxSubnet(const IpPrefix&, const std::string&);
+    void removeMuxSubnet(const IpPrefix&, const std::string&);
+
     /***
      * Methods for managing tunnel routes for neighbor IPs not associated
      * with a specific mux cable
@@ -286,6 +297,7 @@ private:
     sai_object_id_t mux_tunnel_id_ = SAI_NULL_OBJECT_ID;
 
     MuxCableTb mux_cable_tb_;
+    MuxSubnetTb mux_subnet_tb_;
     MuxTunnelNHs mux_tunnel_nh_;
     NextHopTb mux_nexthop_tb_;
 
@@ -299,6 +311,8 @@ private:
     std::set<IpAddress> standalone_tunnel_neighbors_;
     std::set<IpAddress> skip_neighbors_;
 
+    EntityBulker<sai_route_api_t> route_bulker_;
+
     bool enable_cache_neigh_updates_ = false;
     std::vector<NeighborUpdate> cached_neigh_updates_;
 };
@@ -16,6 +16,7 @@
 
 #include <assert.h>
 #include <iostream>
+#include <iterator>
 #include <vector>
 #include <unordered_map>
 #include <utility>
@@ -42,6 +43,8 @@ extern DebugDumpOrch      *gDebugDumpOrch;
 uint32_t  natTimerTickCntr  = 0;
 bool      gNhTrackingSupported = false;
 
+static uint64_t getTimeSpentMsecs(const struct timespec &begin);
+
 NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_with_pri_t> &tableNames,
          RouteOrch *routeOrch, NeighOrch *neighOrch):
          Orch(appDb, tableNames),
@@ -57,7 +60,8 @@ NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_wit
          m_naptQueryTable(appDb, APP_NAPT_TABLE_NAME),
          m_twiceNatQueryTable(appDb, APP_NAT_TWICE_TABLE_NAME),
          m_twiceNaptQueryTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-         nullIpv4Addr(0)
+         nullIpv4Addr(0),
+         m_countersQueryMsecs(getTimeSpentMsecs)
 {
     /* Set NAT admin mode to disabled */
     admin_mode = "disabled";
@@ -3114,11 +3118,261 @@ void NatOrch::doTask(SelectableTimer &timer)
     }
 }
 
+/* Counters of a bulk of NAT entries of one table, read with a single bulk GET */
+template <typename Key>
+struct NatCountersBulker
+{
+    std::vector<Key>             keys;
+    std::vector<sai_nat_entry_t> entries;
+    std::vector<uint32_t>        attrCount;
+    std::vector<sai_attribute_t> attrList;   // byte and packet count of each entry
+    std::vector<sai_status_t>    statuses;
+
+    NatCountersBulker()
+    {
+        keys.reserve(NAT_COUNTERS_BULK_SIZE);
+        entries.reserve(NAT_COUNTERS_BULK_SIZE);
+        attrCount.reserve(NAT_COUNTERS_BULK_SIZE);
+        attrList.reserve(2 * NAT_COUNTERS_BULK_SIZE);
+        statuses.reserve(NAT_COUNTERS_BULK_SIZE);
+    }
+
+    size_t size() const
+    {
+        return keys.size();
+    }
+
+    void clear()
+    {
+        keys.clear();
+        entries.clear();
+        attrCount.clear();
+        attrList.clear();
+        statuses.clear();
+    }
+
+    void add(const Key &key, const sai_nat_entry_t &entry)
+    {
+        sai_attribute_t attr = {};
+
+        keys.push_back(key);
+        entries.push_back(entry);
+        attrCount.push_back(2);
+        attr.id = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
+        attrList.push_back(attr);
+        attr.id = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
+        attrList.push_back(attr);
+        statuses.push_back(SAI_STATUS_NOT_EXECUTED);
+    }
+
+    void executeGet()
+    {
+        uint32_t count = (uint32_t)entries.size();
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (sai_nat_api->get_nat_entries_attribute)
+        {
+            std::vector<sai_attribute_t *> attrs(count);
+            for (uint32_t idx = 0; idx < count; idx++)
+            {
+                attrs[idx] = &attrList[2 * idx];
+            }
+
+            status = sai_nat_api->get_nat_entries_attribute(count, entries.data(), attrCount.data(), attrs.data(),
+                                                            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+
+        if ((status == SAI_STATUS_NOT_IMPLEMENTED) || (status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            /* Fall back to one GET per entry */
+            for (uint32_t idx = 0; idx < count; idx++)
+            {
+                statuses[idx] = sai_nat_api->get_nat_entry_attribute(&entries[idx], 2, &attrList[2 * idx]);
+            }
+        }
+    }
+
+    uint64_t bytes(size_t idx) const
+    {
+        return (statuses[idx] == SAI_STATUS_SUCCESS) ? attrList[2 * idx].value.u64 : 0;
+    }
+
+    uint64_t packets(size_t idx) const
+    {
+        return (statuses[idx] == SAI_STATUS_SUCCESS) ? attrList[2 * idx + 1].value.u64 : 0;
+    }
+};
+
+static uint64_t getTimeSpentMsecs(const struct timespec &begin)
+{
+    struct timespec time_now, time_spent;
+
+    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
+    {
+        return 0;
+    }
+    time_spent = getTimeDiff(begin, time_now);
+
+    return (uint64_t)time_spent.tv_sec * 1000UL + (uint64_t)time_spent.tv_nsec / 1000000UL;
+}
+
+/* Queries the counters of the entries of the table after the cursor, NAT_COUNTERS_BULK_SIZE entries at a time,
+ * and updates them in the database. Returns false if the time budget of the timer tick ran out before the end
+ * of the table, the cursor then points to the last queried entry. */
+template <typename EntryMap, typename MakeEntry, typename Update>
+static bool queryCountersInBulk(EntryMap &entries, NatQueryCursor<typename EntryMap::key_type> &cursor,
+                                const struct timespec &begin, uint64_t (*timeSpentMsecs)(const struct timespec &),
+                                uint32_t &queried_entries, MakeEntry makeEntry, Update update)
+{
+    NatCountersBulker<typename EntryMap::key_type> bulker;
+    auto it = cursor.valid ? entries.upper_bound(cursor.key) : entries.begin();
+
+    while (it != entries.end())
+    {
+        bulker.clear();
+        for (; (it != entries.end()) && (bulker.size() < NAT_COUNTERS_BULK_SIZE); it++)
+        {
+            if (it->second.addedToHw == false)
+            {
+                continue;
+            }
+            bulker.add(it->first, makeEntry(it->first, it->second));
+        }
+
+        bulker.executeGet();
+
+        /* Failures are logged once per bulk, with the status of the first failed entry */
+        size_t failed = 0;
+        sai_status_t failedStatus = SAI_STATUS_SUCCESS;
+        for (size_t idx = 0; idx < bulker.size(); idx++)
+        {
+            if (bulker.statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                if (failed++ == 0)
+                {
+                    failedStatus = bulker.statuses[idx];
+                }
+            }
+            update(bulker.keys[idx], bulker.packets(idx), bulker.bytes(idx));
+        }
+        if (failed)
+        {
+            SWSS_LOG_ERROR("Failed to get Counters for %zu of %zu NAT entries, rv:%d", failed, bulker.size(), failedStatus);
+        }
+        queried_entries += (uint32_t)bulker.size();
+
+        if ((it != entries.end()) && (timeSpentMsecs(begin) >= NAT_COUNTERS_QUERY_BUDGET))
+        {
+            cursor.key   = std::prev(it)->first;
+            cursor.valid = true;
+            return false;
+        }
+    }
+
+    cursor.valid = false;
+    return true;
+}
+
+static sai_nat_entry_t getNatCountersEntry(const IpAddress &ipAddr, const NatEntryValue &entry)
+{
+    sai_nat_entry_t nat_entry = {};
+
+    nat_entry.vr_id       = gVirtualRouterId;
+    nat_entry.switch_id   = gSwitchId;
+
+    if (entry.nat_type == "dnat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip = ipAddr.getV4Addr();
+        nat_entry.data.mask.dst_ip = 0xffffffff;
+    }
+    else
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        nat_entry.data.key.src_ip = ipAddr.getV4Addr();
+        nat_entry.data.mask.src_ip = 0xffffffff;
+    }
+
+    return nat_entry;
+}
+
+static sai_nat_entry_t getNaptCountersEntry(const NaptEntryKey &naptKey, const NaptEntryValue &entry)
+{
+    sai_nat_entry_t nat_entry = {};
+
+    nat_entry.vr_id       = gVirtualRouterId;
+    nat_entry.switch_id   = gSwitchId;
+
+    if (entry.nat_type == "dnat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip      = naptKey.ip_address.getV4Addr();
+        nat_entry.data.key.l4_dst_port = (uint16_t)(naptKey.l4_port);
+        nat_entry.data.mask.dst_ip      = 0xffffffff;
+        nat_entry.data.mask.l4_dst_port = 0xffff;
+    }
+    else if (entry.nat_type == "snat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        nat_entry.data.key.src_ip      = naptKey.ip_address.getV4Addr();
+        nat_entry.data.key.l4_src_port = (uint16_t)(naptKey.l4_port);
+        nat_entry.data.mask.src_ip      = 0xffffffff;
+        nat_entry.data.mask.l4_src_port = 0xffff;
+    }
+
+    nat_entry.data.key.proto        = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+    nat_entry.data.mask.proto       = 0xff;
+
+    return nat_entry;
+}
+
+static sai_nat_entry_t getTwiceNatCountersEntry(const TwiceNatEntryKey &key, const TwiceNatEntryValue &)
+{
+    sai_nat_entry_t dbl_nat_entry = {};
+
+    dbl_nat_entry.vr_id = gVirtualRouterId;
+    dbl_nat_entry.switch_id = gSwitchId;
+    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
+    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
+
+    return dbl_nat_entry;
+}
+
+static sai_nat_entry_t getTwiceNaptCountersEntry(const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &)
+{
+    sai_nat_entry_t dbl_nat_entry = {};
+
+    dbl_nat_entry.vr_id = gVirtualRouterId;
+    dbl_nat_entry.switch_id = gSwitchId;
+    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
+    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
+    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
+    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
+    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
+    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
+    dbl_nat_entry.data.key.proto = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+    dbl_nat_entry.data.mask.proto = 0xff;
+
+    return dbl_nat_entry;
+}
+
 void NatOrch::queryCounters(void)
 {
     SWSS_LOG_ENTER();
 
     uint32_t         queried_entries = 0;
+    bool             done = true;
     struct timespec  time_now, time_end, time_spent;
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
@@ -3126,41 +3380,74 @@ void NatOrch::queryCounters(void)
         return;
     }
 
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
-    {
-        getNatCounters(natIter);
+    /* The counters are written through a single pipeline per table. If the time budget
+     * runs out, the query resumes from where it stopped on the next timer tick. */
+    m_countersNatTable.setBuffered(true);
+    m_countersNaptTable.setBuffered(true);
+    m_countersTwiceNatTable.setBuffered(true);
+    m_countersTwiceNaptTable.setBuffered(true);
 
-        queried_entries++;
-        natIter++;
+    if (m_countersQueryTable == NAT_COUNTERS_QUERY_NAT)
+    {
+        done = queryCountersInBulk(m_natEntries, m_natCountersCursor, time_now, m_countersQueryMsecs, queried_entries, getNatCountersEntry,
+                                   [this](const IpAddress &key, uint64_t pkts, uint64_t bytes)
+                                   {
+                                       updateNatCounters(key, pkts, bytes);
+                                   });
+        if (done)
+        {
+            m_countersQueryTable = NAT_COUNTERS_QUERY_NAPT;
+        }
     }
 
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+    if (done && (m_countersQueryTable == NAT_COUNTERS_QUERY_NAPT))
     {
-        getNaptCounters(naptIter);
-
-        queried_entries++;
-        naptIter++;
+        done = queryCountersInBulk(m_naptEntries, m_naptCountersCursor, time_now, m_countersQueryMsecs, queried_entries, getNaptCountersEntry,
+                                   [this](const NaptEntryKey &key, uint64_t pkts, uint64_t bytes)
+                                   {
+                                       updateNaptCounters(key.prototype, key.ip_address, key.l4_port, pkts, bytes);
+                                   });
+        if (done)
+        {
+            m_countersQueryTable = NAT_COUNTERS_QUERY_TWICE_NAT;
+        }
     }
-    TwiceNatEntry::iterator tnatIter = m_twiceNatEntries.begin();
-    while (tnatIter != m_twiceNatEntries.end())
-    {
-        getTwiceNatCounters(tnatIter);
 
-        queried_entries++;
-        tnatIter++;
+    if (done && (m_countersQueryTable == NAT_COUNTERS_QUERY_TWICE_NAT))
+    {
+        done = queryCountersInBulk(m_twiceNatEntries, m_twiceNatCountersCursor, time_now, m_countersQueryMsecs, queried_entries, getTwiceNatCountersEntry,
+                                   [this](const TwiceNatEntryKey &key, uint64_t pkts, uint64_t bytes)
+                                   {
+                                       updateTwiceNatCounters(key, pkts, bytes);
+                                   });
+        if (done)
+        {
+            m_countersQueryTable = NAT_COUNTERS_QUERY_TWICE_NAPT;
+        }
     }
 
-    TwiceNaptEntry::iterator tnaptIter = m_twiceNaptEntries.begin();
-    while (tnaptIter != m_twiceNaptEntries.end())
+    if (done && (m_countersQueryTable == NAT_COUNTERS_QUERY_TWICE_NAPT))
     {
-        getTwiceNaptCounters(tnaptIter);
-
-        queried_entries++;
-        tnaptIter++;
+        done = queryCountersInBulk(m_twiceNaptEntries, m_twiceNaptCountersCursor, time_now, m_countersQueryMsecs, queried_entries, getTwiceNaptCountersEntry,
+                                   [this](const TwiceNaptEntryKey &key, uint64_t pkts, uint64_t bytes)
+                                   {
+                                       updateTwiceNaptCounters(key, pkts, bytes);
+                                   });
+        if (done)
+        {
+            m_countersQueryTable = NAT_COUNTERS_QUERY_NAT;
+        }
     }
 
+    m_countersNatTable.flush();
+    m_countersNaptTable.flush();
+    m_countersTwiceNatTable.flush();
+    m_countersTwiceNaptTable.flush();
+    m_countersNatTable.setBuffered(false);
+    m_countersNaptTable.setBuffered(false);
+    m_countersTwiceNatTable.setBuffered(false);
+    m_countersTwiceNaptTable.setBuffered(false);
+
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
     {
         return;
@@ -3169,8 +3456,9 @@ void NatOrch::queryCounters(void)
 
     if (queried_entries)
     {
-        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
+        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs%s",
+                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL),
+                       done ? "" : ", to be continued on the next timer tick");
     }
 }
 
@@ -3503,127 +3791,6 @@ void NatOrch::updateAllConntrackEntries(void)
     }
 }
 
-bool NatOrch::getNatCounters(const NatEntry::iterator &iter)
-{
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   nat_entry = {};
-    sai_status_t      status;
-    uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-
-    nat_entry.vr_id       = gVirtualRouterId;
-    nat_entry.switch_id   = gSwitchId;
-
-    if (entry.nat_type == "dnat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
-        nat_entry.data.key.dst_ip = ipAddr.getV4Addr();   
-        nat_entry.data.mask.dst_ip = 0xffffffff;
-    }
-    else
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
-        nat_entry.data.key.src_ip = ipAddr.getV4Addr();
-        nat_entry.data.mask.src_ip = 0xffffffff;
-    }
-
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
-    if (entry.nat_type == "snat")
-    {
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to get Counters for SNAT entry [src-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "", ipAddr.to_string().c_str(),
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-        }
-        else
-        {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
-        }
-    }
-    else if (entry.nat_type == "dnat")
-    {
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to get Counters for DNAT entry [dst-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "", ipAddr.to_string().c_str(),
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-        }
-        else
-        {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
-        }
-    }
-
-    /* Update the Counter values in the database */
-    updateNatCounters(ipAddr, nat_translations_pkts, nat_translations_bytes);
-
-    return 0;
-}
-
-bool NatOrch::getTwiceNatCounters(const TwiceNatEntry::iterator &iter)
-{
-    const TwiceNatEntryKey   &key = iter->first;
-    TwiceNatEntryValue       &entry  = iter->second;
-    uint32_t          attr_count;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   dbl_nat_entry = {};
-    sai_status_t      status;
-    uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for Twice NAT entry [src ip %s, dst ip %s], as not yet added to HW",
-                        key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to get Counters for Twice NAT entry [src-ip %s, dst-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
-                        key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(),
-                        nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-    }
-    else
-    {
-        nat_translations_bytes = nat_entry_attr[0].value.u64;
-        nat_translations_pkts  = nat_entry_attr[1].value.u64;
-    }
-
-    /* Update the Counter values in the database */
-    updateTwiceNatCounters(key, nat_translations_pkts, nat_translations_bytes);
-
-    return 0;
-}
-
 bool NatOrch::setNatCounters(const NatEntry::iterator &iter)
 {
     const IpAddress   &ipAddr = iter->first;
@@ -3702,146 +3869,6 @@ bool NatOrch::setNatCounters(const NatEntry::iterator &iter)
     return 0;
 }
 
-bool NatOrch::getNaptCounters(const NaptEntry::iterator &iter)
-{
-    const NaptEntryKey &naptKey    = iter->first;
-    NaptEntryValue     &entry      = iter->second;
-    uint8_t            protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    nat_entry = {};
-    sai_status_t       status;
-    uint64_t           nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    nat_entry.vr_id       = gVirtualRouterId;
-    nat_entry.switch_id   = gSwitchId;
-
-    if (entry.nat_type == "dnat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
-        nat_entry.data.key.dst_ip      = naptKey.ip_address.getV4Addr();
-        nat_entry.data.key.l4_dst_port = (uint16_t)(naptKey.l4_port);
-        nat_entry.data.mask.dst_ip      = 0xffffffff;
-        nat_entry.data.mask.l4_dst_port = 0xffff;
-    }
-    else if (entry.nat_type == "snat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
-        nat_entry.data.key.src_ip      = naptKey.ip_address.getV4Addr();
-        nat_entry.data.key.l4_src_port = (uint16_t)(naptKey.l4_port);
-        nat_entry.data.mask.src_ip      = 0xffffffff;
-        nat_entry.data.mask.l4_src_port = 0xffff;
-    }
-
-    nat_entry.data.key.proto        = protoType;
-    nat_entry.data.mask.proto       = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
-
-    if (entry.nat_type == "snat")
-    { 
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to get Counters for SNAPT entry for [proto %s, src-ip %s, src-port %d], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
-                           naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port,
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-        }
-        else
-        {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
-        }
-    }
-    else if (entry.nat_type == "dnat")
-    {
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to get Counters for DNAPT entry for [proto %s, dst-ip %s, dst-port %d], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
-                           naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port,
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-        }
-        else
-        {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
-        }
-    }
-
-    /* Update the Counter values in the database */
-    updateNaptCounters(naptKey.prototype, naptKey.ip_address, naptKey.l4_port,
-                       nat_translations_pkts, nat_translations_bytes);
-    return 0;
-}
-
-bool NatOrch::getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter)
-{
-    const TwiceNaptEntryKey &key    = iter->first;
-    TwiceNaptEntryValue     &entry      = iter->second;
-    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-    uint64_t           nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
-                       key.dst_l4_port);
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("Failed to get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
-                       key.dst_l4_port);
-    }
-    else
-    {
-        nat_translations_bytes = nat_entry_attr[0].value.u64;
-        nat_translations_pkts  = nat_entry_attr[1].value.u64;
-    }
-
-    /* Update the Counter values in the database */
-    updateTwiceNaptCounters(key, nat_translations_pkts, nat_translations_bytes);
-    return 0;
-}
-
 bool NatOrch::setNaptCounters(const NaptEntry::iterator &iter)
 {
     const NaptEntryKey &naptKey    = iter->first;
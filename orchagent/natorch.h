@@ -37,6 +37,8 @@
 #define NAT_HITBIT_N_CNTRS_QUERY_PERIOD   5        // 5 secs
 #define NAT_CONNTRACK_TIMEOUT_PERIOD      86400    // 1 day
 #define NAT_HITBIT_QUERY_MULTIPLE         6        // Hit bits are queried every 30 secs
+#define NAT_COUNTERS_BULK_SIZE            1024     // Entries per counters bulk GET
+#define NAT_COUNTERS_QUERY_BUDGET         200      // Max msecs spent in querying counters per timer tick
 
 struct NatEntryValue
 {
@@ -153,6 +155,23 @@ typedef std::map<TwiceNatEntryKey, TwiceNatEntryValue> TwiceNatEntry;
 
 typedef std::map<TwiceNaptEntryKey, TwiceNaptEntryValue> TwiceNaptEntry;
 
+/* Entry tables, in the order their counters are queried */
+enum NatCountersQueryTable
+{
+    NAT_COUNTERS_QUERY_NAT,
+    NAT_COUNTERS_QUERY_NAPT,
+    NAT_COUNTERS_QUERY_TWICE_NAT,
+    NAT_COUNTERS_QUERY_TWICE_NAPT
+};
+
+/* Last entry of a table whose counters were queried, to resume the query on the next timer tick */
+template <typename Key>
+struct NatQueryCursor
+{
+    bool           valid = false;
+    Key            key;
+};
+
 /* Cache of DNAT entries that are dependent on the 
  * nexthop resolution of the translated destination ip address.
  */
@@ -219,6 +238,14 @@ private:
     IpAddress               nullIpv4Addr;
     DnatPoolEntry           m_dnatPoolEntries;
 
+    NatCountersQueryTable               m_countersQueryTable = NAT_COUNTERS_QUERY_NAT;
+    NatQueryCursor<IpAddress>           m_natCountersCursor;
+    NatQueryCursor<NaptEntryKey>        m_naptCountersCursor;
+    NatQueryCursor<TwiceNatEntryKey>    m_twiceNatCountersCursor;
+    NatQueryCursor<TwiceNaptEntryKey>   m_twiceNaptCountersCursor;
+    /* Msecs spent since the start of a counters query, checked against NAT_COUNTERS_QUERY_BUDGET */
+    uint64_t                          (*m_countersQueryMsecs)(const struct timespec &begin);
+
     std::shared_ptr<NotificationProducer> setTimeoutNotifier;
 
     /* DNAT/DNAPT entry is cached, to delete and re-add it whenever the direct NextHop (connected neighbor)
@@ -304,10 +331,6 @@ private:
     void queryCounters(void);
     void queryHitBits(void);
     bool isNatEnabled(void);
-    bool getNatCounters(const NatEntry::iterator &iter);
-    bool getTwiceNatCounters(const TwiceNatEntry::iterator &iter);
-    bool getNaptCounters(const NaptEntry::iterator &iter);
-    bool getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter);
     bool setNatCounters(const NatEntry::iterator &iter);
     bool setTwiceNatCounters(const TwiceNatEntry::iterator &iter);
     bool setNaptCounters(const NaptEntry::iterator &iter);
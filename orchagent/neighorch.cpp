@@ -97,6 +97,60 @@ void NeighOrch::resolveNeighbor(const NeighborEntry &entry)
     return;
 }
 
+template <typename Index, typename Key>
+static void eraseNeighborIndex(Index &index, const Key &key, const NeighborEntry &entry)
+{
+    auto it = index.find(key);
+    if (it == index.end())
+    {
+        return;
+    }
+
+    it->second.erase(entry);
+    if (it->second.empty())
+    {
+        index.erase(it);
+    }
+}
+
+/*
+ * Adds or updates a synced neighbor, along with its IP, alias and MAC indexes
+ */
+void NeighOrch::setSyncdNeighbor(const NeighborEntry &entry, const NeighborData &data)
+{
+    auto it = m_syncdNeighbors.find(entry);
+    if (it == m_syncdNeighbors.end())
+    {
+        m_syncdNeighbors.emplace(entry, data);
+        m_syncdNeighborsByIp[entry.ip_address].insert(entry);
+        m_syncdNeighborsByAlias[entry.alias].insert(entry);
+    }
+    else
+    {
+        if (it->second.mac != data.mac)
+        {
+            eraseNeighborIndex(m_syncdNeighborsByMac, it->second.mac, entry);
+        }
+        it->second = data;
+    }
+
+    m_syncdNeighborsByMac[data.mac].insert(entry);
+}
+
+void NeighOrch::eraseSyncdNeighbor(const NeighborEntry &entry)
+{
+    auto it = m_syncdNeighbors.find(entry);
+    if (it == m_syncdNeighbors.end())
+    {
+        return;
+    }
+
+    eraseNeighborIndex(m_syncdNeighborsByIp, entry.ip_address, entry);
+    eraseNeighborIndex(m_syncdNeighborsByAlias, entry.alias, entry);
+    eraseNeighborIndex(m_syncdNeighborsByMac, it->second.mac, entry);
+    m_syncdNeighbors.erase(it);
+}
+
 void NeighOrch::clearResolvedNeighborEntry(const NeighborEntry &entry)
 {
     string key, alias = entry.alias;
@@ -137,12 +191,16 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
         // If the FDB entry MAC matches with neighbor/ARP entry MAC,
         // and ARP entry incoming interface matches with VLAN name,
         // flush neighbor/arp entry.
-        for (const auto &neighborEntry : m_syncdNeighbors)
+        auto neighbors = m_syncdNeighborsByMac.find(entry.mac);
+        if (neighbors == m_syncdNeighborsByMac.end())
         {
-            if (neighborEntry.first.alias == vlan.m_alias &&
-                neighborEntry.second.mac == entry.mac)
+            continue;
+        }
+        for (const auto &neighborEntry : neighbors->second)
+        {
+            if (neighborEntry.alias == vlan.m_alias)
             {
-                resolveNeighborEntry(neighborEntry.first, neighborEntry.second.mac);
+                resolveNeighborEntry(neighborEntry, entry.mac);
             }
         }
     }
@@ -800,25 +858,28 @@ bool NeighOrch::getNeighborEntry(const NextHopKey &nexthop, NeighborEntry &neigh
         assert(inbp.m_alias.length());
     }
 
-    for (const auto &entry : m_syncdNeighbors)
+    auto neighbors = m_syncdNeighborsByIp.find(nexthop.ip_address);
+    if (neighbors == m_syncdNeighborsByIp.end())
     {
-        if (entry.first.ip_address == nexthop.ip_address)
+        return false;
+    }
+
+    for (const auto &entry : neighbors->second)
+    {
+        if (m_intfsOrch->isRemoteSystemPortIntf(entry.alias))
+        {
+            //For remote system ports, nexthops are always on inband.
+            nbr_alias = inbp.m_alias;
+        }
+        else
         {
-           if (m_intfsOrch->isRemoteSystemPortIntf(entry.first.alias))
-           {
-               //For remote system ports, nexthops are always on inband.
-               nbr_alias = inbp.m_alias;
-           }
-           else
-           {
-               nbr_alias = entry.first.alias;
-           }
-           if (nbr_alias == nexthop.alias)
-           {
-              neighborEntry = entry.first;
-              macAddress = entry.second.mac;
-              return true;
-           }
+            nbr_alias = entry.alias;
+        }
+        if (nbr_alias == nexthop.alias)
+        {
+            neighborEntry = entry;
+            macAddress = m_syncdNeighbors.find(entry)->second.mac;
+            return true;
         }
     }
 
@@ -1013,19 +1074,35 @@ void NeighOrch::getMuxNeighborsForPort(string port_name, NeighborTable& m_neighb
 
     MuxOrch* mux_orch = gDirectory.get<MuxOrch*>();
     string mux_port_name;
-    for (const auto &entry : m_syncdNeighbors)
+    for (const auto &neighbors : m_syncdNeighborsByAlias)
     {
-        // Check if mux port exists for given neighbor entry
-        mux_port_name = "";
-        if (!mux_orch->getMuxPort(entry.second.mac, entry.first.alias, mux_port_name) || mux_port_name.empty())
+        // Mux neighbors are on VLAN interfaces, look up the interface once for all its neighbors
+        Port rif;
+        if (!m_portsOrch->getPort(neighbors.first, rif) || rif.m_type != Port::VLAN)
         {
             continue;
         }
 
-        // Add to m_neighbors if entry found
-        if (mux_port_name == port_name)
+        // Neighbors sharing a MAC address (e.g. IPv4 and IPv6) are on the same mux port
+        unordered_map<MacAddress, bool, NeighborMacHash> on_port;
+        for (const auto &entry : neighbors.second)
         {
-            m_neighbors.insert(entry);
+            const auto &neighbor = *m_syncdNeighbors.find(entry);
+            auto found = on_port.find(neighbor.second.mac);
+            if (found == on_port.end())
+            {
+                // Check if mux port exists for given neighbor entry
+                mux_port_name = "";
+                bool on = mux_orch->getMuxPort(neighbor.second.mac, entry.alias, mux_port_name) &&
+                          !mux_port_name.empty() && mux_port_name == port_name;
+                found = on_port.emplace(neighbor.second.mac, on).first;
+            }
+
+            // Add to m_neighbors if entry found
+            if (found->second)
+            {
+                m_neighbors.insert(neighbor);
+            }
         }
     }
 }
@@ -1225,7 +1302,7 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
         SWSS_LOG_NOTICE("Updated neighbor %s on %s", macAddress.to_string().c_str(), alias.c_str());
     }
 
-    m_syncdNeighbors[neighborEntry] = { macAddress, hw_config };
+    setSyncdNeighbor(neighborEntry, { macAddress, hw_config });
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
@@ -1374,7 +1451,7 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
         return true;
     }
 
-    m_syncdNeighbors.erase(neighborEntry);
+    eraseSyncdNeighbor(neighborEntry);
 
     NeighborUpdate update = { neighborEntry, MacAddress(), false };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
@@ -1488,7 +1565,7 @@ bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
         }
     }
 
-    m_syncdNeighbors[neighborEntry] = { macAddress, true };
+    setSyncdNeighbor(neighborEntry, { macAddress, true });
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
@@ -2395,7 +2472,7 @@ bool NeighOrch::addZeroMacTunnelRoute(const NeighborEntry& entry, const MacAddre
     mux_orch->update(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
     if (mux_orch->isStandaloneTunnelRouteInstalled(entry.ip_address))
     {
-        m_syncdNeighbors[entry] = { mac, false };
+        setSyncdNeighbor(entry, { mac, false });
         return true;
     }
 
@@ -2408,14 +2485,15 @@ bool NeighOrch::ifChangeInformRemoteNextHop(const string &alias, bool if_up)
     bool rc = true;
     Port inbp;
     gPortsOrch->getInbandPort(inbp);
-    for (auto nbr = m_syncdNeighbors.begin(); nbr != m_syncdNeighbors.end(); ++nbr)
+    auto neighbors = m_syncdNeighborsByAlias.find(alias);
+    if (neighbors == m_syncdNeighborsByAlias.end())
     {
-        if (nbr->first.alias != alias)
-        {
-            continue;
-        }
-        SWSS_LOG_INFO("Found remote Neighbor %s on %s", nbr->first.ip_address.to_string().c_str(), alias.c_str());
-        NextHopKey nhop = { nbr->first.ip_address, inbp.m_alias };
+        return rc;
+    }
+    for (const auto &nbr : neighbors->second)
+    {
+        SWSS_LOG_INFO("Found remote Neighbor %s on %s", nbr.ip_address.to_string().c_str(), alias.c_str());
+        NextHopKey nhop = { nbr.ip_address, inbp.m_alias };
 
         if (if_up)
         {
@@ -37,6 +37,42 @@ typedef map<NeighborEntry, NeighborData> NeighborTable;
 /* NextHopTable: NextHopKey, NextHopEntry */
 typedef map<NextHopKey, NextHopEntry> NextHopTable;
 
+struct NeighborIpHash
+{
+    size_t operator()(const IpAddress &ip) const
+    {
+        const auto &addr = ip.getIp();
+        size_t hash = addr.family;
+        if (ip.isV4())
+        {
+            return hash * 31 + addr.ip_addr.ipv4_addr;
+        }
+        for (auto byte : addr.ip_addr.ipv6_addr)
+        {
+            hash = hash * 31 + byte;
+        }
+        return hash;
+    }
+};
+
+struct NeighborMacHash
+{
+    size_t operator()(const MacAddress &mac) const
+    {
+        size_t hash = 0;
+        for (int i = 0; i < 6; i++)
+        {
+            hash = hash * 31 + mac.getMac()[i];
+        }
+        return hash;
+    }
+};
+
+/* NeighborIndex: IP address, alias or MAC address, NeighborEntry set of the neighbors with it */
+typedef unordered_map<IpAddress, set<NeighborEntry>, NeighborIpHash> NeighborIpIndex;
+typedef unordered_map<string, set<NeighborEntry>> NeighborAliasIndex;
+typedef unordered_map<MacAddress, set<NeighborEntry>, NeighborMacHash> NeighborMacIndex;
+
 struct NeighborUpdate
 {
     NeighborEntry entry;
@@ -120,6 +156,10 @@ private:
     ProducerStateTable m_appNeighResolveProducer;
 
     NeighborTable m_syncdNeighbors;
+    /* Indexes of m_syncdNeighbors, only modified through setSyncdNeighbor() and eraseSyncdNeighbor() */
+    NeighborIpIndex m_syncdNeighborsByIp;
+    NeighborAliasIndex m_syncdNeighborsByAlias;
+    NeighborMacIndex m_syncdNeighborsByMac;
     NextHopTable m_syncdNextHops;
 
     std::set<NextHopKey> m_neighborToResolve;
@@ -153,6 +193,8 @@ private:
     void updateNextHop(const BfdUpdate&);
 
     bool resolveNeighborEntry(const NeighborEntry &, const MacAddress &);
+    void setSyncdNeighbor(const NeighborEntry &, const NeighborData &);
+    void eraseSyncdNeighbor(const NeighborEntry &);
     void clearResolvedNeighborEntry(const NeighborEntry &);
 
     bool addZeroMacTunnelRoute(const NeighborEntry &, const MacAddress &);
@@ -2,8 +2,14 @@
 #define SWSS_NEXTHOPGROUPKEY_H
 
 #include "nexthopkey.h"
+#include <memory>
 #include <boost/functional/hash.hpp>
 
+/*
+ * The next hop set is shared between copies of a key and copied on the first
+ * modification, so that the keys of the routes and of m_syncdNextHopGroups
+ * don't each own a copy of the same set.
+ */
 class NextHopGroupKey
 {
 public:
@@ -18,7 +24,7 @@ public:
         auto nhv = tokenize(nexthops, NHG_DELIMITER);
         for (const auto &nh : nhv)
         {
-            m_nexthops.insert(nh);
+            mutableNextHops().insert(nh);
         }
     }
 
@@ -34,7 +40,7 @@ public:
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                mutableNextHops().insert(nh);
             }
         }
         else if (srv6_nh)
@@ -46,7 +52,7 @@ public:
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                mutableNextHops().insert(nh);
                 if (nh.isSrv6Vpn())
                 {
                     m_srv6_vpn = true;
@@ -67,30 +73,37 @@ public:
         {
             NextHopKey nh(nhv[i]);
             nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
-            m_nexthops.insert(nh);
+            mutableNextHops().insert(nh);
         }
     }
 
     inline const std::set<NextHopKey> &getNextHops() const
     {
-        return m_nexthops;
+        return m_nexthops ? *m_nexthops : emptyNextHops();
     }
 
     inline size_t getSize() const
     {
-        return m_nexthops.size();
+        return m_nexthops ? m_nexthops->size() : 0;
     }
 
     inline bool operator<(const NextHopGroupKey &o) const
     {
-        if (m_nexthops < o.m_nexthops)
+        if (m_nexthops == o.m_nexthops)
+        {
+            return false;
+        }
+
+        const auto &nexthops = getNextHops();
+        const auto &o_nexthops = o.getNextHops();
+        if (nexthops < o_nexthops)
         {
             return true;
         }
-        else if (m_nexthops == o.m_nexthops)
+        else if (nexthops == o_nexthops)
         {
-            auto it1 = m_nexthops.begin();
-            for (auto& it2 : o.m_nexthops)
+            auto it1 = nexthops.begin();
+            for (auto& it2 : o_nexthops)
             {
                 if (it1->weight < it2.weight)
                 {
@@ -108,12 +121,19 @@ public:
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
-        if (m_nexthops != o.m_nexthops)
+        if (m_nexthops == o.m_nexthops)
+        {
+            return true;
+        }
+
+        const auto &nexthops = getNextHops();
+        const auto &o_nexthops = o.getNextHops();
+        if (nexthops != o_nexthops)
         {
             return false;
         }
-        auto it1 = m_nexthops.begin();
-        for (auto& it2 : o.m_nexthops)
+        auto it1 = nexthops.begin();
+        for (auto& it2 : o_nexthops)
         {
             if (it2.weight != it1->weight)
             {
@@ -131,33 +151,36 @@ public:
 
     void add(const std::string &ip, const std::string &alias)
     {
-        m_nexthops.emplace(ip, alias);
+        mutableNextHops().emplace(ip, alias);
     }
 
     void add(const std::string &nh)
     {
-        m_nexthops.insert(nh);
+        mutableNextHops().insert(nh);
     }
 
     void add(const NextHopKey &nh)
     {
-        m_nexthops.insert(nh);
+        mutableNextHops().insert(nh);
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
     {
         NextHopKey nh(ip, alias);
-        return m_nexthops.find(nh) != m_nexthops.end();
+        const auto &nexthops = getNextHops();
+        return nexthops.find(nh) != nexthops.end();
     }
 
     bool contains(const std::string &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        const auto &nexthops = getNextHops();
+        return nexthops.find(nh) != nexthops.end();
     }
 
     bool contains(const NextHopKey &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        const auto &nexthops = getNextHops();
+        return nexthops.find(nh) != nexthops.end();
     }
 
     bool contains(const NextHopGroupKey &nhs) const
@@ -174,7 +197,7 @@ public:
 
     bool hasIntfNextHop() const
     {
-        for (const auto &nh : m_nexthops)
+        for (const auto &nh : getNextHops())
         {
             if (nh.isIntfNextHop())
             {
@@ -187,26 +210,27 @@ public:
     void remove(const std::string &ip, const std::string &alias)
     {
         NextHopKey nh(ip, alias);
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     void remove(const std::string &nh)
     {
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     void remove(const NextHopKey &nh)
     {
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     const std::string to_string() const
     {
         string nhs_str;
+        const auto &nexthops = getNextHops();
 
-        for (auto it = m_nexthops.begin(); it != m_nexthops.end(); ++it)
+        for (auto it = nexthops.begin(); it != nexthops.end(); ++it)
         {
-            if (it != m_nexthops.begin())
+            if (it != nexthops.begin())
             {
                 nhs_str += NHG_DELIMITER;
             }
@@ -237,11 +261,36 @@ public:
 
     void clear()
     {
-        m_nexthops.clear();
+        m_nexthops.reset();
+    }
+
+    /* Number of keys sharing the next hop set, 0 if the key is empty */
+    inline long getShareCount() const
+    {
+        return m_nexthops.use_count();
     }
 
 private:
-    std::set<NextHopKey> m_nexthops;
+    std::set<NextHopKey> &mutableNextHops()
+    {
+        if (!m_nexthops)
+        {
+            m_nexthops = std::make_shared<std::set<NextHopKey>>();
+        }
+        else if (m_nexthops.use_count() > 1)
+        {
+            m_nexthops = std::make_shared<std::set<NextHopKey>>(*m_nexthops);
+        }
+        return *m_nexthops;
+    }
+
+    static const std::set<NextHopKey> &emptyNextHops()
+    {
+        static const std::set<NextHopKey> empty;
+        return empty;
+    }
+
+    std::shared_ptr<std::set<NextHopKey>> m_nexthops;
     bool m_overlay_nexthops = false;
     bool m_srv6_nexthops = false;
     bool m_srv6_vpn = false;
@@ -255,7 +304,8 @@ namespace std {
     template <>
     struct hash<NextHopGroupKey> {
         size_t operator()(const NextHopGroupKey& obj) const {
-            return boost::hash_range(obj.m_nexthops.begin(), obj.m_nexthops.end());
+            const auto &nexthops = obj.getNextHops();
+            return boost::hash_range(nexthops.begin(), nexthops.end());
         }
     };
 }
@@ -22,6 +22,9 @@ public:
         {
             m_orch->doTask(*notificationConsumer);
         }
+
+        // Leftover notifications are picked up by the next orch sweep
+        setPending(notificationConsumer->hasData());
     }
 
     void drain() override
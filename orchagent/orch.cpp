@@ -1,4 +1,5 @@
 #include <inttypes.h>
+#include <algorithm>
 #include <stdexcept>
 #include <sys/time.h>
 #include "timestamp.h"
@@ -19,12 +20,90 @@ int gBatchSize = 0;
 
 std::shared_ptr<RingBuffer> Orch::gRingBuffer = nullptr;
 std::shared_ptr<RingBuffer> Executor::gRingBuffer = nullptr;
+bool Orch::gFullSweep = false;
 
-RingBuffer::RingBuffer(int size): buffer(size)
+LatencyHistogram::LatencyHistogram()
+{
+    for (auto &bucket : m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(uint64_t usecs)
+{
+    // bucket 0 is below 1us, bucket i covers [2^(i-1), 2^i) us
+    size_t bucket = usecs == 0 ? 0 : static_cast<size_t>(64 - __builtin_clzll(usecs));
+    if (bucket >= BUCKETS)
+    {
+        bucket = BUCKETS - 1;
+    }
+
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count(size_t bucket) const
+{
+    if (bucket >= BUCKETS)
+    {
+        return 0;
+    }
+
+    return m_buckets[bucket].load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::total() const
+{
+    uint64_t sum = 0;
+    for (const auto &bucket : m_buckets)
+    {
+        sum += bucket.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+string LatencyHistogram::dump() const
+{
+    string s;
+    for (size_t i = 0; i < BUCKETS; i++)
+    {
+        uint64_t n = count(i);
+        if (n == 0)
+        {
+            continue;
+        }
+
+        if (!s.empty())
+        {
+            s += " ";
+        }
+
+        if (i == BUCKETS - 1)
+        {
+            s += ">=" + to_string(1ULL << (i - 1)) + "us:" + to_string(n);
+        }
+        else
+        {
+            s += "<" + to_string(1ULL << i) + "us:" + to_string(n);
+        }
+    }
+    return s;
+}
+
+RingBuffer::RingBuffer(int size)
 {
     if (size <= 1) {
         throw std::invalid_argument("Buffer size must be greater than 1");
     }
+
+    // Keep the capacity of the original ring, which kept one slot unused
+    slots = static_cast<uint64_t>(size);
+    capacity = slots - 1;
+    buffer.reset(new Slot[slots]);
+    for (uint64_t i = 0; i < slots; i++)
+    {
+        buffer[i].sequence.store(i, std::memory_order_relaxed);
+    }
 }
 
 void RingBuffer::pauseThread()
@@ -39,47 +118,208 @@ void RingBuffer::notify()
     bool task_pending = !IsEmpty() && IsIdle();
 
     if (thread_exited || task_pending)
+    {
+        // take the lock so the wakeup can't fall between the predicate check and the wait
+        std::lock_guard<std::mutex> lock(mtx);
         cv.notify_all();
+    }
+}
+
+void RingBuffer::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(idle_mtx);
+    while (!(IsEmpty() && IsIdle()) && !thread_exited)
+    {
+        notify();
+        idle_cv.wait(lock, [&](){ return (IsEmpty() && IsIdle()) || thread_exited; });
+    }
+}
+
+void RingBuffer::exitThread()
+{
+    thread_exited = true;
+
+    // notify under the locks so no waiter can miss the flag between its check and its wait
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        cv.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock(idle_mtx);
+        idle_cv.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock(space_mtx);
+        space_cv.notify_all();
+    }
 }
 
 void RingBuffer::setIdle(bool idle)
 {
-    idle_status = idle;
+    if (!idle)
+    {
+        idle_status.store(false, std::memory_order_seq_cst);
+        return;
+    }
+
+    // signal under the lock so waitIdle() can't miss the transition
+    std::lock_guard<std::mutex> lock(idle_mtx);
+    idle_status.store(true, std::memory_order_seq_cst);
+    idle_cv.notify_all();
 }
 
 bool RingBuffer::IsIdle() const
 {
-    return idle_status;
+    return idle_status.load(std::memory_order_seq_cst);
 }
 
 bool RingBuffer::IsFull() const
 {
-    return (tail + 1) % static_cast<int>(buffer.size()) == head;
+    return tail.load(std::memory_order_seq_cst) - head.load(std::memory_order_seq_cst) >= capacity;
 }
 
 bool RingBuffer::IsEmpty() const
 {
-    return tail == head;
+    return tail.load(std::memory_order_seq_cst) == head.load(std::memory_order_seq_cst);
+}
+
+bool RingBuffer::tryPush(AnyTask& ringEntry)
+{
+    uint64_t pos = tail.load(std::memory_order_relaxed);
+    Slot *slot;
+
+    while (true)
+    {
+        // bound the occupancy, pos may be stale and behind head
+        int64_t used = static_cast<int64_t>(pos - head.load(std::memory_order_seq_cst));
+        if (used >= static_cast<int64_t>(capacity))
+        {
+            return false;
+        }
+
+        slot = &buffer[pos % slots];
+        uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(seq - pos);
+
+        if (diff == 0)
+        {
+            // the slot is free at this position, try to claim it
+            if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the slot still holds the task from the previous lap
+            return false;
+        }
+        else
+        {
+            // another producer claimed this position
+            pos = tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->task = std::move(ringEntry);
+    slot->enqueued = std::chrono::steady_clock::now();
+    // publish the task to the consumer
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
 }
 
 bool RingBuffer::push(AnyTask ringEntry)
 {
-    if (IsFull())
+    auto tstart = std::chrono::steady_clock::now();
+
+    if (!tryPush(ringEntry))
+    {
         return false;
-    buffer[tail] = std::move(ringEntry);
-    tail = (tail + 1) % static_cast<int>(buffer.size());
+    }
+
+    m_enqueueLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - tstart).count());
+    return true;
+}
+
+bool RingBuffer::pushWait(AnyTask ringEntry)
+{
+    auto tstart = std::chrono::steady_clock::now();
+
+    if (!tryPush(ringEntry))
+    {
+        std::unique_lock<std::mutex> lock(space_mtx);
+        space_waiters.fetch_add(1, std::memory_order_seq_cst);
+
+        while (true)
+        {
+            // nothing drains the ring anymore, don't wait for it again
+            if (thread_exited)
+            {
+                space_waiters.fetch_sub(1, std::memory_order_seq_cst);
+                return false;
+            }
+
+            if (tryPush(ringEntry))
+            {
+                break;
+            }
+
+            // make sure the ring thread is draining before waiting on it
+            notify();
+            space_cv.wait(lock, [&](){ return !IsFull() || thread_exited; });
+        }
+
+        space_waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    m_enqueueLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - tstart).count());
     return true;
 }
 
 bool RingBuffer::pop(AnyTask& ringEntry)
 {
-    if (IsEmpty())
+    uint64_t pos = head.load(std::memory_order_relaxed);
+    Slot &slot = buffer[pos % slots];
+
+    // empty, or the producer has claimed the slot but not published it yet
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+    {
         return false;
-    ringEntry = std::move(buffer[head]);
-    head = (head + 1) % static_cast<int>(buffer.size());
+    }
+
+    ringEntry = std::move(slot.task);
+    slot.task = nullptr;
+    m_dequeueLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - slot.enqueued).count());
+
+    // release the slot to the producer of the next lap
+    slot.sequence.store(pos + slots, std::memory_order_release);
+    head.store(pos + 1, std::memory_order_seq_cst);
+
+    if (space_waiters.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(space_mtx);
+        space_cv.notify_all();
+    }
+
     return true;
 }
 
+void RingBuffer::dumpStats()
+{
+    uint64_t enqueued = m_enqueueLatency.total();
+    if (enqueued == m_lastEnqueued)
+    {
+        return;
+    }
+    m_lastEnqueued = enqueued;
+
+    SWSS_LOG_INFO("RingBuffer capacity %" PRIu64 " enqueue latency: %s", capacity, m_enqueueLatency.dump().c_str());
+    SWSS_LOG_INFO("RingBuffer capacity %" PRIu64 " dequeue latency: %s", capacity, m_dequeueLatency.dump().c_str());
+}
+
 void RingBuffer::addExecutor(Executor* executor)
 {
     m_consumerSet.insert(executor->getName());
@@ -147,24 +387,82 @@ vector<Selectable *> Orch::getSelectables()
     return selectables;
 }
 
+/*
+ * Merge the fields of a SET task into the fields of a pending SET task.
+ * Updated fields are removed from their old position and appended in the
+ * order of the update, the last value wins for fields repeated in the update.
+ */
+static void mergeFieldValues(vector<FieldValueTuple> &existing, const vector<FieldValueTuple> &update)
+{
+    /* Small updates are matched by scanning, larger ones through a field index */
+    const size_t small_update = 8;
+
+    if (update.size() <= small_update)
+    {
+        auto updated = [&](const FieldValueTuple &fv) {
+            for (const auto &u : update)
+            {
+                if (fvField(u) == fvField(fv))
+                    return true;
+            }
+            return false;
+        };
+        existing.erase(std::remove_if(existing.begin(), existing.end(), updated), existing.end());
+
+        for (size_t i = 0; i < update.size(); i++)
+        {
+            bool repeated = false;
+            for (size_t j = i + 1; j < update.size() && !repeated; j++)
+            {
+                repeated = fvField(update[j]) == fvField(update[i]);
+            }
+            if (!repeated)
+                existing.push_back(update[i]);
+        }
+        return;
+    }
+
+    /* field name -> index of its last occurrence in the update */
+    unordered_map<string, size_t> index;
+    index.reserve(update.size());
+    for (size_t i = 0; i < update.size(); i++)
+    {
+        index[fvField(update[i])] = i;
+    }
+
+    existing.erase(std::remove_if(existing.begin(), existing.end(),
+                [&](const FieldValueTuple &fv) { return index.find(fvField(fv)) != index.end(); }),
+            existing.end());
+
+    for (size_t i = 0; i < update.size(); i++)
+    {
+        if (index[fvField(update[i])] == i)
+            existing.push_back(update[i]);
+    }
+}
+
 void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
 {
     SWSS_LOG_ENTER();
 
-    string key = kfvKey(entry);
-    string op  = kfvOp(entry);
+    const string &key = kfvKey(entry);
+    const string &op  = kfvOp(entry);
 
     /* Record incoming tasks */
-    Recorder::Instance().swss.record(dumpTuple(entry));
+    if (Recorder::Instance().swss.isRecord())
+    {
+        Recorder::Instance().swss.record(dumpTuple(entry));
+    }
 
     /*
-    * m_toSync is a multimap which will allow one key with multiple values,
-    * Also, the order of the key-value pairs whose keys compare equivalent
-    * is the order of insertion and does not change. (since C++11)
+    * m_toSync keeps multiple values per key in insertion order. We maintain
+    * maximum two values per key: a DEL, a SET, or a DEL followed by a SET.
+    * The hash index of m_toSync gives the pending tasks of the key directly.
     */
+    auto slots = m_toSync.slots(key);
 
     /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
-    if (m_toSync.find(key) == m_toSync.end())
+    if (slots == nullptr)
     {
         m_toSync.emplace(key, entry);
     }
@@ -175,59 +473,20 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
         m_toSync.erase(key);
         m_toSync.emplace(key, entry);
     }
-    else
-    {
-        /*
-        * Now we are trying to add the key-value with SET.
-        * We maintain maximum two values per key.
-        * In case there is one key-value, it should be DEL or SET
-        * In case there are two key-value pairs, it should be DEL then SET
-        * The code logic is following:
-        * We iterate the values with the key, we skip the value with DEL and then
-        * check if that was the only one (I,E, the iter pointer now points to end or next key),
-        * in such case, we insert the key-value with SET.
-        * If there was a SET already (I,E, the pointer still points to the same key), we combine the kfv.
-        */
-        auto ret = m_toSync.equal_range(key);
-        auto iter = ret.first;
-        for (; iter != ret.second; ++iter)
-        {
-            auto old_op = kfvOp(iter->second);
-            if (old_op == SET_COMMAND)
-                break;
-        }
-        if (iter == ret.second)
-        {
-            m_toSync.emplace(key, entry);
-        }
-        else
-        {
-            KeyOpFieldsValuesTuple existing_data = iter->second;
-
-            auto new_values = kfvFieldsValues(entry);
-            auto existing_values = kfvFieldsValues(existing_data);
 
+    /* A SET after a pending DEL only, keep the DEL then SET order */
+    else if (!slots->hasSet)
+    {
+        m_toSync.emplace(key, entry);
+    }
 
-            for (auto it : new_values)
-            {
-                string field = fvField(it);
-                string value = fvValue(it);
-
-                auto iu = existing_values.begin();
-                while (iu != existing_values.end())
-                {
-                    string ofield = fvField(*iu);
-                    if (field == ofield)
-                        iu = existing_values.erase(iu);
-                    else
-                        iu++;
-                }
-                existing_values.push_back(FieldValueTuple(field, value));
-            }
-            iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
-        }
+    /* A SET after a pending SET, merge the fields in place */
+    else
+    {
+        mergeFieldValues(kfvFieldsValues(slots->set->second), kfvFieldsValues(entry));
     }
 
+    setPending(true);
 }
 
 size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries)
@@ -306,11 +565,17 @@ size_t ConsumerBase::refillToSync()
 
 string ConsumerBase::dumpTuple(const KeyOpFieldsValuesTuple &tuple)
 {
-    string s = getTableName() + getConsumerTable()->getTableNameSeparator() + kfvKey(tuple)
-               + "|" + kfvOp(tuple);
+    string s = getTableName();
+    s += getConsumerTable()->getTableNameSeparator();
+    s += kfvKey(tuple);
+    s += "|";
+    s += kfvOp(tuple);
     for (auto i = kfvFieldsValues(tuple).begin(); i != kfvFieldsValues(tuple).end(); i++)
     {
-        s += "|" + fvField(*i) + ":" + fvValue(*i);
+        s += "|";
+        s += fvField(*i);
+        s += ":";
+        s += fvValue(*i);
     }
 
     return s;
@@ -345,6 +610,24 @@ void Consumer::execute()
     );
 }
 
+void Executor::setPending(bool pending)
+{
+    if (m_pending == pending || m_orch == nullptr)
+    {
+        return;
+    }
+
+    m_pending = pending;
+    if (pending)
+    {
+        m_orch->addPendingExecutor(this);
+    }
+    else
+    {
+        m_orch->removePendingExecutor(this);
+    }
+}
+
 void Executor::processAnyTask(AnyTask&& task)
 {
     // if either gRingBuffer isn't initialized or the ring thread isn't created
@@ -360,11 +643,9 @@ void Executor::processAnyTask(AnyTask&& task)
     else if (!gRingBuffer->serves(getName()))
     {
         // this executor should execute the input task in the main thread
-        // but to avoid thread issue, it should wait when the ring buffer is actively working
-        while (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle()) {
-            gRingBuffer->notify();
-            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
-        }
+        // but to avoid thread issue, it should wait when the ring buffer is actively working.
+        // The ring thread signals when it drains the ring and becomes idle
+        gRingBuffer->waitIdle();
         // execute task()
         task();
     }
@@ -372,10 +653,11 @@ void Executor::processAnyTask(AnyTask&& task)
     {
         // if this executor is served by ring buffer, 
         // push the task to gRingBuffer
-        // this task would be executed in the ring thread, not here
-        while (!gRingBuffer->push(task)) {
-            gRingBuffer->notify();
-            SWSS_LOG_WARN("ring is full...push again");
+        // this task would be executed in the ring thread, not here.
+        // When the ring is full, block until the ring thread frees a slot
+        if (!gRingBuffer->pushWait(std::move(task))) {
+            SWSS_LOG_ERROR("Ring thread exited, drop task of %s", getName().c_str());
+            return;
         }
         gRingBuffer->notify();
     }
@@ -385,6 +667,9 @@ void Consumer::drain()
 {
     if (!m_toSync.empty())
         ((Orch *)m_orch)->doTask((Consumer&)*this);
+
+    // Entries left behind (e.g. task_need_retry) keep the consumer in the sweep
+    setPending(!m_toSync.empty());
 }
 
 size_t Orch::addExistingData(const string& tableName)
@@ -663,9 +948,47 @@ string Orch::objectReferenceInfo(
 
 void Orch::doTask()
 {
-    for (auto &it : m_consumerMap)
+    if (gFullSweep)
+    {
+        for (auto &it : m_consumerMap)
+        {
+            it.second->drain();
+        }
+        return;
+    }
+
+    /*
+     * Only drain executors with pending tasks. drain() may add or remove
+     * pending executors, hence look up the next one by name after each drain
+     * to keep the same order as a full walk of m_consumerMap.
+     */
+    auto it = m_pendingExecutors.begin();
+    while (it != m_pendingExecutors.end())
+    {
+        string name = it->first;
+        it->second->drain();
+        it = m_pendingExecutors.upper_bound(name);
+    }
+}
+
+void Orch::addPendingExecutor(Executor *executor)
+{
+    // Only track executors owned by this orch, so the pointer stays valid
+    auto it = m_consumerMap.find(executor->getName());
+    if (it == m_consumerMap.end() || it->second.get() != executor)
+    {
+        return;
+    }
+
+    m_pendingExecutors[executor->getName()] = executor;
+}
+
+void Orch::removePendingExecutor(Executor *executor)
+{
+    auto it = m_pendingExecutors.find(executor->getName());
+    if (it != m_pendingExecutors.end() && it->second == executor)
     {
-        it.second->drain();
+        m_pendingExecutors.erase(it);
     }
 }
 
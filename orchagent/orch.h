@@ -7,6 +7,10 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <condition_variable>
 
 extern "C" {
@@ -26,6 +30,7 @@ extern "C" {
 #include "response_publisher.h"
 #include "recorder.h"
 #include "schema.h"
+#include "syncmap.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -52,7 +57,6 @@ const char state_db_key_delimiter  = '|';
 #define VLAN_SUB_INTERFACE_SEPARATOR "."
 
 #define RING_SIZE 30
-#define SLEEP_MSECONDS 500
 
 const int default_orch_pri = 0;
 
@@ -84,10 +88,6 @@ typedef std::map<std::string, std::shared_ptr<object_reference_map>> type_map;
 typedef std::map<std::string, sai_object_id_t> object_map;
 typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 
-// Use multimap to support multiple OpFieldsValues for the same key (e,g, DEL and SET)
-// The order of the key-value pairs whose keys compare equivalent is the order of
-// insertion and does not change. (since C++11)
-typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> SyncMap;
 
 typedef std::pair<std::string, int> table_name_with_pri_t;
 
@@ -137,10 +137,17 @@ public:
     static std::shared_ptr<RingBuffer> gRingBuffer;
     void processAnyTask(AnyTask&& func);
 
+    // Mark whether this executor has work left for the next orch sweep
+    void setPending(bool pending);
+    bool isPending() const { return m_pending; }
+
 protected:
     swss::Selectable *m_selectable;
     Orch *m_orch;
 
+    // Whether this executor is registered in its orch's pending set
+    bool m_pending = false;
+
     // Name for Executor
     std::string m_name;
 
@@ -184,38 +191,102 @@ public:
     size_t refillToSync(swss::Table* table);
 };
 
+/* Latency histogram with power of two buckets in microseconds, safe for concurrent updates */
+class LatencyHistogram
+{
+public:
+    static const size_t BUCKETS = 24;
+
+    LatencyHistogram();
+
+    void record(uint64_t usecs);
+    uint64_t count(size_t bucket) const;
+    uint64_t total() const;
+
+    // Format as "<1us:n <2us:n ... >=Nus:n", skipping empty buckets
+    std::string dump() const;
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> m_buckets;
+};
+
+/*
+ * Bounded lock-free task queue between the main thread (producers) and the
+ * ring thread (single consumer). Each slot carries a sequence number which
+ * tells whether the slot is free for the producer at a given position or
+ * holds a published task for the consumer at that position.
+ */
 class RingBuffer
 {
 private:
-    std::vector<AnyTask> buffer;
-    int head = 0;
-    int tail = 0;
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence;
+        AnyTask task;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    std::unique_ptr<Slot[]> buffer;
+    uint64_t slots;
+    uint64_t capacity;
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
     std::set<std::string> m_consumerSet;
 
+    // wakes up the ring thread when tasks are pushed
     std::condition_variable cv;
     std::mutex mtx;
-    bool idle_status = true;
+    std::atomic<bool> idle_status{true};
+
+    // wakes up threads waiting for the ring thread to become idle
+    std::condition_variable idle_cv;
+    std::mutex idle_mtx;
+
+    // wakes up producers blocked on a full ring
+    std::condition_variable space_cv;
+    std::mutex space_mtx;
+    std::atomic<int> space_waiters{0};
+
+    LatencyHistogram m_enqueueLatency;
+    LatencyHistogram m_dequeueLatency;
+    uint64_t m_lastEnqueued = 0;
+
+    bool tryPush(AnyTask& entry);
 
 public:
+    // The ring holds up to size - 1 tasks
     RingBuffer(int size=RING_SIZE);
-    bool thread_created = false;
+    std::atomic<bool> thread_created{false};
     std::atomic<bool> thread_exited{false};
 
     // pause the ring thread if the buffer is empty
     void pauseThread();
     // wake up the ring thread in case it's locked but not empty
     void notify();
+    // block until the ring is empty and the ring thread is idle
+    void waitIdle();
+    // mark the ring thread as exited and wake up every thread waiting on it
+    void exitThread();
 
     bool IsFull() const;
     bool IsEmpty() const;
     bool IsIdle() const;
 
+    // non-blocking, returns false if the ring is full
     bool push(AnyTask entry);
+    // blocks while the ring is full, returns false if the ring thread exited
+    bool pushWait(AnyTask entry);
     bool pop(AnyTask& entry);
 
     void addExecutor(Executor* executor);
     bool serves(const std::string& tableName);
     void setIdle(bool idle);
+
+    size_t getCapacity() const { return static_cast<size_t>(capacity); }
+    const LatencyHistogram& getEnqueueLatency() const { return m_enqueueLatency; }
+    const LatencyHistogram& getDequeueLatency() const { return m_dequeueLatency; }
+    // log the latency histograms if tasks were pushed since the last dump
+    void dumpStats();
 };
 
 class Consumer : public ConsumerBase {
@@ -287,7 +358,7 @@ public:
     // otherwise fallback to cold start
     virtual bool bake();
 
-    /* Iterate all consumers in m_consumerMap and run doTask(Consumer) */
+    /* Iterate consumers with pending tasks and run doTask(Consumer) */
     virtual void doTask();
 
     /* Run doTask against a specific executor */
@@ -307,6 +378,14 @@ public:
 
     void dumpPendingTasks(std::vector<std::string> &ts);
 
+    /* Track executors which have pending tasks, see Executor::setPending() */
+    void addPendingExecutor(Executor *executor);
+    void removePendingExecutor(Executor *executor);
+    bool hasPendingTasks() const { return !m_pendingExecutors.empty(); }
+
+    /* Drain every executor in doTask() instead of only the pending ones */
+    static bool gFullSweep;
+
     /**
      * @brief Flush pending responses
      */
@@ -314,6 +393,9 @@ public:
 protected:
     ConsumerMap m_consumerMap;
 
+    /* Executors with pending tasks, ordered by name as in m_consumerMap */
+    std::map<std::string, Executor *> m_pendingExecutors;
+
     Orch();
     ref_resolve_status resolveFieldRefValue(type_map&, const std::string&, const std::string&, swss::KeyOpFieldsValuesTuple&, sai_object_id_t&, std::string&);
     std::set<std::string> generateIdListFromMap(unsigned long idsMap, sai_uint32_t maxId);
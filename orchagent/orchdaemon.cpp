@@ -2,6 +2,7 @@
 #include <unordered_map>
 #include <chrono>
 #include <limits.h>
+#include <inttypes.h>
 #include "orchdaemon.h"
 #include "logger.h"
 #include <sairedis.h>
@@ -94,8 +95,7 @@ OrchDaemon::~OrchDaemon()
     // Stop the ring thread before delete orch pointers
     if (ring_thread.joinable()) {
         // notify the ring_thread to exit
-        gRingBuffer->thread_exited = true;
-        gRingBuffer->notify();
+        gRingBuffer->exitThread();
         // wait for the ring_thread to exit
         ring_thread.join();
         disableRingBuffer();
@@ -143,16 +143,19 @@ void OrchDaemon::popRingBuffer()
 
         gRingBuffer->setIdle(true);
     }
+
+    // producers blocked on a full ring would never be woken up by a pop anymore
+    gRingBuffer->exitThread();
 }
 
 /**
  * This function initializes gRingBuffer, otherwise it's nullptr.
  */
-void OrchDaemon::enableRingBuffer() {
-    gRingBuffer = std::make_shared<RingBuffer>();
+void OrchDaemon::enableRingBuffer(int size) {
+    gRingBuffer = std::make_shared<RingBuffer>(size);
     Executor::gRingBuffer = gRingBuffer;
     Orch::gRingBuffer = gRingBuffer;
-    SWSS_LOG_NOTICE("RingBuffer created at %p!", (void *)gRingBuffer.get());
+    SWSS_LOG_NOTICE("RingBuffer created at %p with capacity %zu!", (void *)gRingBuffer.get(), gRingBuffer->getCapacity());
 }
 
 void OrchDaemon::disableRingBuffer() {
@@ -901,6 +904,51 @@ void OrchDaemon::logRotate() {
 }
 
 
+void OrchDaemon::sweep()
+{
+    auto tstart = std::chrono::steady_clock::now();
+
+    for (Orch *o : m_orchList)
+    {
+        /* With Orch::gFullSweep every orch is visited, as before the pending set */
+        if (!Orch::gFullSweep && !o->hasPendingTasks())
+        {
+            m_sweepCounters.orchsSkipped++;
+            continue;
+        }
+
+        o->doTask();
+        m_sweepCounters.orchsDrained++;
+    }
+
+    auto tend = std::chrono::steady_clock::now();
+    m_sweepCounters.sweeps++;
+    m_sweepCounters.usecs += std::chrono::duration_cast<std::chrono::microseconds>(tend - tstart).count();
+}
+
+void OrchDaemon::dumpSweepCounters()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sweepCounters.sweeps == m_lastSweepCounters.sweeps)
+    {
+        return;
+    }
+
+    uint64_t sweeps = m_sweepCounters.sweeps - m_lastSweepCounters.sweeps;
+    uint64_t usecs = m_sweepCounters.usecs - m_lastSweepCounters.usecs;
+
+    SWSS_LOG_INFO("Orch sweep (%s): %" PRIu64 " sweeps, %" PRIu64 " orchs drained, %" PRIu64 " orchs skipped, %" PRIu64 " us total, %" PRIu64 " us per sweep",
+                  Orch::gFullSweep ? "full" : "pending",
+                  sweeps,
+                  m_sweepCounters.orchsDrained - m_lastSweepCounters.orchsDrained,
+                  m_sweepCounters.orchsSkipped - m_lastSweepCounters.orchsSkipped,
+                  usecs,
+                  usecs / sweeps);
+
+    m_lastSweepCounters = m_sweepCounters;
+}
+
 void OrchDaemon::start(long heartBeatInterval)
 {
     SWSS_LOG_ENTER();
@@ -958,11 +1006,16 @@ void OrchDaemon::start(long heartBeatInterval)
                 }
                 else
                 {
-                    for (Orch *o : m_orchList)
-                        o->doTask();
+                    sweep();
                 }
             }
 
+            dumpSweepCounters();
+            if (gRingBuffer)
+            {
+                gRingBuffer->dumpStats();
+            }
+
             continue;
         }
 
@@ -982,8 +1035,7 @@ void OrchDaemon::start(long heartBeatInterval)
 
         if (!gRingBuffer || (gRingBuffer->IsEmpty() && gRingBuffer->IsIdle()))
         {
-            for (Orch *o : m_orchList)
-                o->doTask();
+            sweep();
         }
         /*
          * Asked to check warm restart readiness.
@@ -999,11 +1051,7 @@ void OrchDaemon::start(long heartBeatInterval)
                 // but should finish data that already in the ring
                 if (gRingBuffer)
                 {
-                    while (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle())
-                    {
-                        gRingBuffer->notify();
-                        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
-                    }
+                    gRingBuffer->waitIdle();
                 }
 
                 // Should sleep here or continue handling timers and etc.??
@@ -98,7 +98,7 @@ public:
      * and populate this ring's pointer to the producers [Orch, Consumer], to make sure that
      * they are connected to the same ring.
      */
-    void enableRingBuffer();
+    void enableRingBuffer(int size = RING_SIZE);
     void disableRingBuffer();
     /**
      * This method describes how the ring consumer consumes this ring.
@@ -109,6 +109,20 @@ public:
 
     std::thread ring_thread;
 
+    /* Cost of the orch sweeps that follow each select event */
+    struct SweepCounters
+    {
+        uint64_t sweeps = 0;
+        uint64_t orchsDrained = 0;
+        uint64_t orchsSkipped = 0;
+        uint64_t usecs = 0;
+    };
+
+    const SweepCounters& getSweepCounters() const
+    {
+        return m_sweepCounters;
+    }
+
 protected:
     DBConnector *m_applDb;
     DBConnector *m_configDb;
@@ -126,6 +140,13 @@ protected:
 
     void flush();
 
+    /* Run doTask() of every orch which has pending tasks */
+    void sweep();
+    void dumpSweepCounters();
+
+    SweepCounters m_sweepCounters;
+    SweepCounters m_lastSweepCounters;
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent, long interval);
 
     void freezeAndHeartBeat(unsigned int duration, long interval);
@@ -33,4 +33,12 @@ bool FlexCounterOrch::getPortBufferDropCountersState() const
 bool FlexCounterOrch::bake()
 {
     return true;
-}
\ No newline at end of file
+}
+
+void FlexCounterOrch::setNativeRatesObject(const std::string &nameMap, const std::string &name, const std::string &oid)
+{
+}
+
+void FlexCounterOrch::delNativeRatesObject(const std::string &nameMap, const std::string &name)
+{
+}
@@ -79,7 +79,7 @@ bool PortsOrch::setBridgePortLearningFDB(Port &port, sai_bridge_port_fdb_learnin
     return true;
 }
 
-bool PortsOrch::getPort(string alias, Port &port)
+bool PortsOrch::getPort(const string &alias, Port &port)
 {
     if (m_portList.find(alias) == m_portList.end())
     {
@@ -115,7 +115,43 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
     return true;
 }
 
-void PortsOrch::setPort(string alias, Port port)
+Port *PortsOrch::getPortPtr(const string &alias)
+{
+    auto it = m_portList.find(alias);
+    return it == m_portList.end() ? nullptr : &it->second;
+}
+
+Port *PortsOrch::getPortPtr(sai_object_id_t id)
+{
+    for (auto &p : m_portList)
+    {
+        if (p.second.m_port_id == id)
+        {
+            return &p.second;
+        }
+    }
+    return nullptr;
+}
+
+const Port *PortsOrch::getPortPtr(const string &alias) const
+{
+    auto it = m_portList.find(alias);
+    return it == m_portList.end() ? nullptr : &it->second;
+}
+
+const Port *PortsOrch::getPortPtr(sai_object_id_t id) const
+{
+    for (const auto &p : m_portList)
+    {
+        if (p.second.m_port_id == id)
+        {
+            return &p.second;
+        }
+    }
+    return nullptr;
+}
+
+void PortsOrch::setPort(const string &alias, const Port &port)
 {
     m_portList[alias] = port;
 }
@@ -196,7 +232,8 @@ void PortsOrch::generateQueueMap(std::map<string, FlexCounterQueueStates> queues
 {
 }
 
-void PortsOrch::generateQueueMapPerPort(const Port &port, FlexCounterQueueStates &queuesState, bool voq)
+void PortsOrch::generateQueueMapPerPort(const Port &port, FlexCounterQueueStates &queuesState, bool voq,
+                                        BufferCounterMaps &maps)
 {
 }
 
@@ -212,7 +249,7 @@ void PortsOrch::generatePriorityGroupMap(std::map<string, FlexCounterPgStates> p
 {
 }
 
-void PortsOrch::generatePriorityGroupMapPerPort(const Port &port, FlexCounterPgStates &pgsState)
+void PortsOrch::generatePriorityGroupMapPerPort(const Port &port, FlexCounterPgStates &pgsState, BufferCounterMaps &maps)
 {
 }
 
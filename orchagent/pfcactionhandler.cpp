@@ -353,13 +353,13 @@ PfcWdAclHandler::PfcWdAclHandler(sai_object_id_t port, sai_object_id_t queue,
 
     if (shared_egress_acl_table)
     {
-        Port p;
-        if (!gPortsOrch->getPort(port, p))
+        const Port *p = gPortsOrch->getPortPtr(port);
+        if (!p)
         {
             SWSS_LOG_ERROR("Failed to get port structure from port oid 0x%" PRIx64, port);
             return;
         }
-        m_strEgressRule = "Egress_Rule_PfcWdAclHandler_" + p.m_alias + "_" + queuestr;
+        m_strEgressRule = "Egress_Rule_PfcWdAclHandler_" + p->m_alias + "_" + queuestr;
         m_strEgressTable = "EgressTable_PfcWdAclHandler";
         found = m_aclTables.find(m_strEgressTable);
         if (found == m_aclTables.end())
@@ -626,14 +626,14 @@ bool PfcWdLossyHandler::getHwCounters(PfcWdHwStats& counters)
     }
 
     // PG counters not yet supported in Mellanox platform
-    Port portInstance;
-    if (!gPortsOrch->getPort(getPort(), portInstance))
+    const Port *portInstance = gPortsOrch->getPortPtr(getPort());
+    if (!portInstance)
     {
         SWSS_LOG_ERROR("Cannot get port by ID 0x%" PRIx64, getPort());
         return false;
     }
 
-    sai_object_id_t pg = portInstance.m_priority_group_ids[static_cast <size_t> (getQueueId())];
+    sai_object_id_t pg = portInstance->m_priority_group_ids[static_cast <size_t> (getQueueId())];
     vector<uint64_t> pgStats;
     pgStats.resize(pgStatIds.size());
 
@@ -663,14 +663,14 @@ PfcWdZeroBufferHandler::PfcWdZeroBufferHandler(sai_object_id_t port,
 {
     SWSS_LOG_ENTER();
 
-    Port portInstance;
-    if (!gPortsOrch->getPort(port, portInstance))
+    Port *portInstance = gPortsOrch->getPortPtr(port);
+    if (!portInstance)
     {
         SWSS_LOG_ERROR("Cannot get port by ID 0x%" PRIx64, port);
         return;
     }
 
-    setQueueLockFlag(portInstance, true);
+    setQueueLockFlag(*portInstance, true);
 
     sai_attribute_t attr;
     attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
@@ -716,14 +716,14 @@ PfcWdZeroBufferHandler::~PfcWdZeroBufferHandler(void)
         return;
     }
 
-    Port portInstance;
-    if (!gPortsOrch->getPort(getPort(), portInstance))
+    Port *portInstance = gPortsOrch->getPortPtr(getPort());
+    if (!portInstance)
     {
         SWSS_LOG_ERROR("Cannot get port by ID 0x%" PRIx64, getPort());
         return;
     }
 
-    setQueueLockFlag(portInstance, false);
+    setQueueLockFlag(*portInstance, false);
 }
 
 void PfcWdZeroBufferHandler::setQueueLockFlag(Port& port, bool isLocked) const
@@ -736,7 +736,6 @@ void PfcWdZeroBufferHandler::setQueueLockFlag(Port& port, bool isLocked) const
             port.m_queue_lock[i] = isLocked;
         }
     }
-    gPortsOrch->setPort(port.m_alias, port);
 }
 
 PfcWdZeroBufferHandler::ZeroBufferProfile::ZeroBufferProfile(void)
@@ -0,0 +1,557 @@
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+
+#include "orch.h"
+#include "pfcwddetector.h"
+
+using namespace std;
+using namespace swss;
+
+#define PFC_WD_STATUS_OPERATIONAL   "operational"
+#define PFC_WD_ACTION_ALERT         "alert"
+#define PFC_WD_DEBUG_STORM_ENABLED  "enabled"
+#define PFC_WD_TIME_STAMP_KEY       "TIME_STAMP"
+#define PFC_WD_PORT_TIME_STAMP      "PFC_WD_Port_Counter_time_stamp"
+
+unique_ptr<PfcWdDetector> PfcWdDetector::create(const string &platform, uint32_t pollInterval)
+{
+    if (platform == VS_PLATFORM_SUBSTRING)
+    {
+        return unique_ptr<PfcWdDetector>(new PfcWdVsDetector(pollInterval));
+    }
+    else if (platform == MLNX_PLATFORM_SUBSTRING)
+    {
+        return unique_ptr<PfcWdDetector>(new PfcWdMellanoxDetector(pollInterval));
+    }
+    else if (platform == BRCM_PLATFORM_SUBSTRING)
+    {
+        return unique_ptr<PfcWdDetector>(new PfcWdBroadcomDetector(pollInterval));
+    }
+
+    return nullptr;
+}
+
+PfcWdDetector::PfcWdDetector(uint32_t pollInterval)
+{
+    setPollInterval(pollInterval);
+}
+
+void PfcWdDetector::addQueue(const string &queueKey, const string &portKey, uint8_t index)
+{
+    QueueState &queue = m_queues[queueKey];
+    queue.portKey = portKey;
+    queue.index = index;
+}
+
+void PfcWdDetector::removeQueue(const string &queueKey)
+{
+    m_queues.erase(queueKey);
+}
+
+void PfcWdDetector::setPollInterval(uint32_t pollInterval)
+{
+    m_pollTime = static_cast<double>(pollInterval) * 1000;
+}
+
+vector<string> PfcWdDetector::getCountersKeys() const
+{
+    vector<string> keys = { PFC_WD_TIME_STAMP_KEY };
+    set<string> ports;
+
+    for (const auto &it : m_queues)
+    {
+        keys.push_back(it.first);
+        if (ports.insert(it.second.portKey).second)
+        {
+            keys.push_back(it.second.portKey);
+        }
+    }
+
+    return keys;
+}
+
+void PfcWdDetector::poll(uint64_t now, uint64_t wallTime, const CountersReader &reader, const Counters &debugStorm,
+        PollResult &result)
+{
+    // Poll time of the PFC watchdog port counters, as recorded by syncd
+    double portTimestamp;
+    const Counters *timestamps = reader(PFC_WD_TIME_STAMP_KEY);
+    bool portTimestampValid = timestamps && getNumber(*timestamps, PFC_WD_PORT_TIME_STAMP, portTimestamp);
+
+    m_portTimestampAdvanced = portTimestampValid && (!m_portTimestampValid || portTimestamp > m_portTimestamp);
+    m_portIntervalValid = m_portTimestampAdvanced && m_portTimestampValid;
+    if (m_portIntervalValid)
+    {
+        m_portInterval = (portTimestamp - m_portTimestamp) / 1000;
+    }
+    m_portTimestampValid = portTimestampValid;
+    m_portTimestamp = portTimestampValid ? portTimestamp : 0;
+
+    m_debugStormEnabled = getField(debugStorm, "enabled") == "true";
+    m_debugStormThresholdValid = getNumber(debugStorm, "threshold", m_debugStormThreshold);
+
+    static const Counters noCounters;
+
+    for (auto &it : m_queues)
+    {
+        const Counters *queueCounters = reader(it.first);
+        if (queueCounters == nullptr)
+        {
+            continue;
+        }
+
+        const Counters *portCounters = reader(it.second.portKey);
+        if (!sampleQueue(it.second, *queueCounters, portCounters ? *portCounters : noCounters, now, wallTime))
+        {
+            continue;
+        }
+
+        // The detection and the restoration apply to queues in different states, so that
+        // running both of them in a single pass is the same as running the plugins in sequence
+        detectQueue(it.first, it.second, *queueCounters, portCounters ? *portCounters : noCounters, result);
+        restoreQueue(it.first, it.second, *queueCounters, portCounters ? *portCounters : noCounters, result);
+    }
+}
+
+bool PfcWdDetector::sampleQueue(QueueState &queue, const Counters &queueCounters, const Counters &portCounters,
+        uint64_t now, uint64_t wallTime)
+{
+    string counters;
+    for (const auto &field : { "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "SAI_QUEUE_STAT_PACKETS", "SAI_QUEUE_ATTR_PAUSE_STATUS" })
+    {
+        counters += getField(queueCounters, field) + ",";
+    }
+    for (const auto &suffix : { "RX_PKTS", "RX_PAUSE_DURATION_US", "ON2OFF_RX_PKTS" })
+    {
+        counters += getField(portCounters, portPfcField(queue, suffix)) + ",";
+    }
+
+    // syncd polls the counters on its own timer. When it records the time stamp of the counters,
+    // they are new once it advanced. Otherwise counters that did not change since the previous
+    // evaluation are most likely not polled yet, unless they were for a while
+    if (queue.sampled)
+    {
+        if (now <= queue.time)
+        {
+            return false;
+        }
+        if (m_portTimestampValid ? !m_portTimestampAdvanced :
+            (counters == queue.countersLast && static_cast<double>(now - queue.time) < 2 * m_pollTime))
+        {
+            return false;
+        }
+    }
+
+    queue.elapsedLastValid = queue.sampled && queue.wallTimeLastValid;
+    queue.elapsedLast = queue.elapsed;
+    queue.elapsed = queue.sampled ? static_cast<double>(now - queue.time) : m_pollTime;
+    queue.interval = m_portIntervalValid ? m_portInterval : queue.elapsed;
+
+    queue.wallTimeLastValid = queue.sampled;
+    queue.wallTimeLast = queue.wallTime;
+    queue.wallTime = wallTime;
+
+    queue.sampled = true;
+    queue.countersLast = move(counters);
+    queue.time = now;
+
+    return true;
+}
+
+void PfcWdDetector::detectQueue(const string &queueKey, QueueState &queue, const Counters &queueCounters,
+        const Counters &portCounters, PollResult &result)
+{
+    if (queueCounters.count("BIG_RED_SWITCH_MODE"))
+    {
+        return;
+    }
+
+    if (getField(queueCounters, "PFC_WD_STATUS") != PFC_WD_STATUS_OPERATIONAL &&
+        getField(queueCounters, "PFC_WD_ACTION") != PFC_WD_ACTION_ALERT)
+    {
+        return;
+    }
+
+    double detectionTime;
+    if (!getNumber(queueCounters, "PFC_WD_DETECTION_TIME", detectionTime))
+    {
+        return;
+    }
+
+    double timeLeft = queue.detectionTimeLeftValid ? queue.detectionTimeLeft : detectionTime;
+
+    if (detect(queueKey, queue, queueCounters, portCounters, timeLeft, detectionTime, result))
+    {
+        queue.detectionTimeLeftValid = true;
+        queue.detectionTimeLeft = timeLeft;
+    }
+}
+
+// Model of pfc_restore.lua
+void PfcWdDetector::restoreQueue(const string &queueKey, QueueState &queue, const Counters &queueCounters,
+        const Counters &portCounters, PollResult &result)
+{
+    if (queueCounters.count("BIG_RED_SWITCH_MODE"))
+    {
+        return;
+    }
+
+    if (getField(queueCounters, "PFC_WD_STATUS") == PFC_WD_STATUS_OPERATIONAL ||
+        getField(queueCounters, "PFC_WD_ACTION") == PFC_WD_ACTION_ALERT)
+    {
+        return;
+    }
+
+    double restorationTime;
+    if (!getNumber(queueCounters, "PFC_WD_RESTORATION_TIME", restorationTime))
+    {
+        return;
+    }
+
+    double timeLeft = queue.restorationTimeLeftValid ? queue.restorationTimeLeft : restorationTime;
+
+    int64_t pfcRxPackets;
+    if (!getCounter(portCounters, portPfcField(queue, "RX_PKTS"), pfcRxPackets))
+    {
+        return;
+    }
+
+    if (queue.pfcRxPacketsLast.valid)
+    {
+        // Check actual condition of queue being restored from PFC storm
+        if (pfcRxPackets - queue.pfcRxPacketsLast.value == 0 &&
+            getField(queueCounters, "DEBUG_STORM") != PFC_WD_DEBUG_STORM_ENABLED)
+        {
+            if (timeLeft <= queue.interval)
+            {
+                result.events.push_back({ queueKey, "restore", {} });
+                timeLeft = restorationTime;
+            }
+            else
+            {
+                timeLeft = timeLeft - queue.interval;
+            }
+        }
+        else
+        {
+            timeLeft = restorationTime;
+        }
+    }
+
+    queue.restorationTimeLeftValid = true;
+    queue.restorationTimeLeft = timeLeft;
+    queue.pfcRxPacketsLast.set(pfcRxPackets);
+}
+
+bool PfcWdDetector::getNumber(const Counters &counters, const string &field, double &value)
+{
+    auto it = counters.find(field);
+    if (it == counters.end() || it->second.empty())
+    {
+        return false;
+    }
+
+    char *end = nullptr;
+    value = strtod(it->second.c_str(), &end);
+    return *end == '\0';
+}
+
+bool PfcWdDetector::getCounter(const Counters &counters, const string &field, int64_t &value)
+{
+    auto it = counters.find(field);
+    if (it == counters.end() || it->second.empty())
+    {
+        return false;
+    }
+
+    char *end = nullptr;
+    value = strtoll(it->second.c_str(), &end, 10);
+    return *end == '\0';
+}
+
+string PfcWdDetector::getField(const Counters &counters, const string &field)
+{
+    auto it = counters.find(field);
+    return it == counters.end() ? "" : it->second;
+}
+
+string PfcWdDetector::formatNumber(double value)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.14g", value);
+    return buffer;
+}
+
+string PfcWdDetector::portPfcField(const QueueState &queue, const string &suffix)
+{
+    return "SAI_PORT_STAT_PFC_" + to_string(queue.index) + "_" + suffix;
+}
+
+void PfcWdDetector::restoreAlert(const string &queueKey, const Counters &queueCounters, PollResult &result)
+{
+    if (getField(queueCounters, "PFC_WD_ACTION") == PFC_WD_ACTION_ALERT &&
+        getField(queueCounters, "PFC_WD_STATUS") != PFC_WD_STATUS_OPERATIONAL)
+    {
+        result.events.push_back({ queueKey, "restore", {} });
+    }
+}
+
+bool PfcWdVsDetector::detect(const string &queueKey, QueueState &queue, const Counters &queueCounters,
+        const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result)
+{
+    int64_t occupancyBytes, packets, pfcRxPackets, pfcDuration;
+    if (!getCounter(queueCounters, "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", occupancyBytes) ||
+        !getCounter(queueCounters, "SAI_QUEUE_STAT_PACKETS", packets) ||
+        !getCounter(portCounters, portPfcField(queue, "RX_PKTS"), pfcRxPackets) ||
+        !getCounter(portCounters, portPfcField(queue, "RX_PAUSE_DURATION_US"), pfcDuration))
+    {
+        return false;
+    }
+
+    bool isDeadlock = false;
+
+    // If this is not a first run, then we have last values available
+    if (queue.packetsLast.valid && queue.pfcRxPacketsLast.valid && queue.pfcStormLast.valid)
+    {
+        bool stormCondition = static_cast<double>(pfcDuration - queue.pfcStormLast.value) > (queue.interval * 0.8);
+        bool noTraffic = packets - queue.packetsLast.value == 0;
+
+        // Check actual condition of queue being in PFC storm
+        if ((occupancyBytes > 0 && noTraffic && pfcRxPackets - queue.pfcRxPacketsLast.value > 0) ||
+            getField(queueCounters, "DEBUG_STORM") == PFC_WD_DEBUG_STORM_ENABLED ||
+            (occupancyBytes == 0 && noTraffic && stormCondition))
+        {
+            if (timeLeft <= queue.interval)
+            {
+                queue.pfcRxPacketsLast.clear();
+                queue.pfcStormLast.clear();
+                result.events.push_back({ queueKey, "storm", {} });
+                isDeadlock = true;
+                timeLeft = detectionTime;
+            }
+            else
+            {
+                timeLeft = timeLeft - queue.interval;
+            }
+        }
+        else
+        {
+            restoreAlert(queueKey, queueCounters, result);
+            timeLeft = detectionTime;
+        }
+    }
+
+    // Save values for next run
+    queue.packetsLast.set(packets);
+    if (!isDeadlock)
+    {
+        queue.pfcRxPacketsLast.set(pfcRxPackets);
+        queue.pfcStormLast.set(pfcDuration);
+    }
+
+    return true;
+}
+
+bool PfcWdMellanoxDetector::detect(const string &queueKey, QueueState &queue, const Counters &queueCounters,
+        const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result)
+{
+    int64_t occupancyBytes, packets, pfcRxPackets, pfcDuration;
+    if (!getCounter(queueCounters, "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", occupancyBytes) ||
+        !getCounter(queueCounters, "SAI_QUEUE_STAT_PACKETS", packets) ||
+        !getCounter(portCounters, portPfcField(queue, "RX_PKTS"), pfcRxPackets) ||
+        !getCounter(portCounters, portPfcField(queue, "RX_PAUSE_DURATION_US"), pfcDuration))
+    {
+        return false;
+    }
+
+    const string debugPrefix = "Port ID " + queue.portKey + " Queue index " + to_string(queue.index);
+
+    // The counters of all queues are published while storms are debugged
+    if (m_debugStormEnabled)
+    {
+        result.debugMessages.push_back(debugPrefix +
+                " occupancy " + getField(queueCounters, "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES") +
+                " packets " + getField(queueCounters, "SAI_QUEUE_STAT_PACKETS") +
+                " pfc rx " + getField(portCounters, portPfcField(queue, "RX_PKTS")) +
+                " pfc duration " + getField(portCounters, portPfcField(queue, "RX_PAUSE_DURATION_US")) +
+                " effective poll time " + formatNumber(queue.interval) + "(global " + formatNumber(queue.elapsed) + ")");
+    }
+
+    bool isDeadlock = false;
+
+    // If this is not a first run, then we have last values available
+    if (queue.packetsLast.valid && queue.pfcRxPacketsLast.valid && queue.pfcStormLast.valid)
+    {
+        double pfcDurationDelta = static_cast<double>(pfcDuration - queue.pfcStormLast.value);
+        bool stormCondition = pfcDurationDelta > (queue.interval * 0.99);
+
+        // As well as the ones of queues paused for more than the threshold percentage of the poll time
+        if (m_debugStormThresholdValid && pfcDurationDelta > (queue.interval * m_debugStormThreshold / 100))
+        {
+            result.debugMessages.push_back(debugPrefix +
+                    " occupancy " + formatNumber(static_cast<double>(occupancyBytes)) +
+                    " packets " + formatNumber(static_cast<double>(packets)) +
+                    " pfc rx " + formatNumber(static_cast<double>(pfcRxPackets)) +
+                    " pfc duration " + formatNumber(static_cast<double>(pfcDuration)) +
+                    " effective poll time " + formatNumber(queue.interval) +
+                    ", triggered by threshold " + formatNumber(m_debugStormThreshold) + "%");
+        }
+
+        // Check actual condition of queue being in PFC storm
+        if ((occupancyBytes > 0 && packets - queue.packetsLast.value == 0 && stormCondition) ||
+            getField(queueCounters, "DEBUG_STORM") == PFC_WD_DEBUG_STORM_ENABLED)
+        {
+            if (timeLeft <= queue.interval)
+            {
+                vector<FieldValueTuple> info = {
+                    { "occupancy", to_string(occupancyBytes) },
+                    { "packets", to_string(packets) },
+                    { "packets_last", to_string(queue.packetsLast.value) },
+                    { "pfc_rx_packets", to_string(pfcRxPackets) },
+                    { "pfc_rx_packets_last", to_string(queue.pfcRxPacketsLast.value) },
+                    { "pfc_duration", to_string(pfcDuration) },
+                    { "pfc_duration_last", to_string(queue.pfcStormLast.value) },
+                    { "timestamp", formatNumber(static_cast<double>(queue.wallTime) / 1000000) },
+                    { "timestamp_last", formatNumber(static_cast<double>(queue.wallTimeLast) / 1000000) },
+                    { "effective_poll_time", formatNumber(queue.interval) }
+                };
+                if (queue.elapsedLastValid)
+                {
+                    info.emplace_back("effective_pfcwd_poll_time_last", formatNumber(queue.elapsedLast));
+                }
+
+                queue.pfcRxPacketsLast.clear();
+                queue.pfcStormLast.clear();
+                result.events.push_back({ queueKey, "storm", info });
+                isDeadlock = true;
+                timeLeft = detectionTime;
+            }
+            else
+            {
+                timeLeft = timeLeft - queue.interval;
+            }
+        }
+        else
+        {
+            restoreAlert(queueKey, queueCounters, result);
+            timeLeft = detectionTime;
+        }
+    }
+
+    // Save values for next run
+    queue.packetsLast.set(packets);
+    if (!isDeadlock)
+    {
+        queue.pfcRxPacketsLast.set(pfcRxPackets);
+        queue.pfcStormLast.set(pfcDuration);
+    }
+
+    return true;
+}
+
+bool PfcWdBroadcomDetector::detect(const string &queueKey, QueueState &queue, const Counters &queueCounters,
+        const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result)
+{
+    int64_t occupancyBytes, packets, pfcRxPackets, pfcOn2Off;
+    auto queuePauseStatus = queueCounters.find("SAI_QUEUE_ATTR_PAUSE_STATUS");
+    if (!getCounter(queueCounters, "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", occupancyBytes) ||
+        !getCounter(queueCounters, "SAI_QUEUE_STAT_PACKETS", packets) ||
+        !getCounter(portCounters, portPfcField(queue, "RX_PKTS"), pfcRxPackets) ||
+        !getCounter(portCounters, portPfcField(queue, "ON2OFF_RX_PKTS"), pfcOn2Off) ||
+        queuePauseStatus == queueCounters.end())
+    {
+        return false;
+    }
+
+    const string &pauseStatus = queuePauseStatus->second;
+
+    // If this is not a first run, then we have last values available
+    if (queue.packetsLast.valid && queue.pfcRxPacketsLast.valid && queue.pfcStormLast.valid && queue.pauseStatusLastValid)
+    {
+        // Check actual condition of queue being in PFC storm
+        if ((pfcRxPackets - queue.pfcRxPacketsLast.value > 0 && pfcOn2Off - queue.pfcStormLast.value == 0 &&
+             queue.pauseStatusLast == "true" && pauseStatus == "true") ||
+            getField(queueCounters, "DEBUG_STORM") == PFC_WD_DEBUG_STORM_ENABLED)
+        {
+            if (timeLeft <= queue.interval)
+            {
+                result.events.push_back({ queueKey, "storm", {} });
+                timeLeft = detectionTime;
+            }
+            else
+            {
+                timeLeft = timeLeft - queue.interval;
+            }
+        }
+        else
+        {
+            restoreAlert(queueKey, queueCounters, result);
+            timeLeft = detectionTime;
+        }
+
+        // Estimate history
+        if (getField(queueCounters, "PFC_STAT_HISTORY") == "enable")
+        {
+            bool wasPaused = queue.pauseStatusLast == "true";
+            bool nowPaused = pauseStatus == "true";
+
+            // Activity has occured
+            if (pfcRxPackets > queue.pfcRxPacketsLast.value)
+            {
+                // Fresh recent pause period
+                bool recentRestarted = false;
+                if (!wasPaused && queue.wallTimeLastValid)
+                {
+                    auto &portUpdates = result.updates[queue.portKey];
+                    portUpdates.emplace_back("EST_PORT_STAT_PFC_" + to_string(queue.index) + "_RECENT_PAUSE_TIMESTAMP",
+                                             formatNumber(static_cast<double>(queue.wallTimeLast)));
+                    recentRestarted = true;
+                }
+                // Estimate entire interval paused if there was pfc activity
+                updateTimePaused(queue, portCounters, recentRestarted, result.updates);
+            }
+            else if (nowPaused && wasPaused)
+            {
+                // Queue paused entire interval without activity
+                updateTimePaused(queue, portCounters, false, result.updates);
+            }
+        }
+    }
+
+    // Save values for next run
+    queue.pauseStatusLastValid = true;
+    queue.pauseStatusLast = pauseStatus;
+    queue.packetsLast.set(packets);
+    queue.pfcRxPacketsLast.set(pfcRxPackets);
+    queue.pfcStormLast.set(pfcOn2Off);
+
+    return true;
+}
+
+void PfcWdBroadcomDetector::updateTimePaused(const QueueState &queue, const Counters &portCounters, bool recentRestarted,
+        CountersUpdates &updates)
+{
+    // Estimate that queue paused for entire poll duration
+    const string prefix = "EST_PORT_STAT_PFC_" + to_string(queue.index);
+    auto &portUpdates = updates[queue.portKey];
+
+    double recentPauseTime = 0;
+    if (!recentRestarted && !getNumber(portCounters, prefix + "_RECENT_PAUSE_TIME_US", recentPauseTime))
+    {
+        recentPauseTime = 0;
+    }
+
+    // Only estimate total time when no SAI support
+    if (!portCounters.count(portPfcField(queue, "RX_PAUSE_DURATION_US")))
+    {
+        double totalPauseTime;
+        if (!getNumber(portCounters, prefix + "_RX_PAUSE_DURATION_US", totalPauseTime))
+        {
+            totalPauseTime = 0;
+        }
+        portUpdates.emplace_back(prefix + "_RX_PAUSE_DURATION_US", formatNumber(totalPauseTime + queue.interval));
+    }
+
+    portUpdates.emplace_back(prefix + "_RECENT_PAUSE_TIME_US", formatNumber(recentPauseTime + queue.interval));
+}
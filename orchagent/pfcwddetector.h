@@ -0,0 +1,196 @@
+#ifndef PFC_WATCHDOG_DETECTOR_H
+#define PFC_WATCHDOG_DETECTOR_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "table.h"
+
+/*
+ * In-process implementation of the pfc_detect_<platform>.lua and pfc_restore.lua
+ * plugins, which syncd runs in redis after each poll of the PFC watchdog counters.
+ *
+ * The detector reads the fields of each queue and port entry of COUNTERS_DB once per poll,
+ * and keeps the previous values and the time left of the queues in memory instead of
+ * the *_last and *_LEFT fields of COUNTERS_DB. Storm and restore events are the ones
+ * the plugins publish on the PFC_WD_ACTION channel.
+ *
+ * Unlike the plugins, the detector doesn't run right after syncd polled the counters.
+ * A queue is only evaluated on counters of a new poll, and the detection and restoration
+ * times are counted down by the measured time between its evaluations.
+ */
+class PfcWdDetector
+{
+public:
+    // Fields of a COUNTERS_DB entry
+    typedef std::unordered_map<std::string, std::string> Counters;
+    // Returns the fields of the COUNTERS_DB entry of the key, nullptr if there is none
+    typedef std::function<const Counters *(const std::string &key)> CountersReader;
+    // Fields to be written to COUNTERS_DB, by key
+    typedef std::map<std::string, std::vector<swss::FieldValueTuple>> CountersUpdates;
+
+    struct Event
+    {
+        std::string queueKey;
+        std::string event;
+        std::vector<swss::FieldValueTuple> info;
+    };
+
+    struct PollResult
+    {
+        std::vector<Event> events;
+        CountersUpdates updates;
+        // Messages published on the PFC_WD_DEBUG channel
+        std::vector<std::string> debugMessages;
+    };
+
+    virtual ~PfcWdDetector() = default;
+
+    // Detector of the platform, nullptr if the platform only has lua plugins
+    static std::unique_ptr<PfcWdDetector> create(const std::string &platform, uint32_t pollInterval);
+
+    void addQueue(const std::string &queueKey, const std::string &portKey, uint8_t index);
+    void removeQueue(const std::string &queueKey);
+    void setPollInterval(uint32_t pollInterval);
+
+    // Keys of the COUNTERS table read by a poll, for the caller to fetch them ahead of it
+    std::vector<std::string> getCountersKeys() const;
+
+    // Runs the detection and the restoration of all queues on the counters of a poll.
+    // now is a monotonic time in microseconds, from which the intervals are measured, and
+    // wallTime the time of the poll in microseconds since the epoch, as published in the events.
+    // debugStorm holds the fields of the DEBUG_STORM entry of COUNTERS_DB
+    void poll(uint64_t now, uint64_t wallTime, const CountersReader &reader, const Counters &debugStorm,
+            PollResult &result);
+
+protected:
+    // Previous value of a counter, as the *_last fields of the plugins
+    struct Snapshot
+    {
+        bool valid = false;
+        int64_t value = 0;
+
+        void set(int64_t v) { valid = true; value = v; }
+        void clear() { valid = false; }
+    };
+
+    struct QueueState
+    {
+        std::string portKey;
+        uint8_t index = 0;
+
+        // Counters of the last evaluation, and its time on the monotonic clock and the wall clock
+        bool sampled = false;
+        std::string countersLast;
+        uint64_t time = 0;
+        uint64_t wallTime = 0;
+        bool wallTimeLastValid = false;
+        uint64_t wallTimeLast = 0;
+        // Time between the counters of this evaluation and the previous one, from the time stamps
+        // of the counters if syncd records them, and the time elapsed since the previous evaluation,
+        // in microseconds
+        double interval = 0;
+        double elapsed = 0;
+        bool elapsedLastValid = false;
+        double elapsedLast = 0;
+
+        bool detectionTimeLeftValid = false;
+        double detectionTimeLeft = 0;
+        bool restorationTimeLeftValid = false;
+        double restorationTimeLeft = 0;
+
+        Snapshot packetsLast;
+        Snapshot pfcRxPacketsLast;
+        // PFC pause duration or on to off transitions, depending on the platform
+        Snapshot pfcStormLast;
+        bool pauseStatusLastValid = false;
+        std::string pauseStatusLast;
+    };
+
+    explicit PfcWdDetector(uint32_t pollInterval);
+
+    // Detection of pfc_detect_<platform>.lua on a queue, which updates the detection time left.
+    // Returns false if the counters of the queue are not available yet
+    virtual bool detect(const std::string &queueKey, QueueState &queue, const Counters &queueCounters,
+            const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result) = 0;
+
+    static bool getNumber(const Counters &counters, const std::string &field, double &value);
+    static bool getCounter(const Counters &counters, const std::string &field, int64_t &value);
+    static std::string getField(const Counters &counters, const std::string &field);
+    // Number as converted to string by lua
+    static std::string formatNumber(double value);
+    // Name of the PFC counter of the queue priority on the port, SAI_PORT_STAT_PFC_<index>_<suffix>
+    static std::string portPfcField(const QueueState &queue, const std::string &suffix);
+    // Publishes restore for a queue in storm with the alert action, as the detection plugins do
+    static void restoreAlert(const std::string &queueKey, const Counters &queueCounters, PollResult &result);
+
+    // Poll time interval in microseconds
+    double m_pollTime;
+
+    // Global debug settings of the DEBUG_STORM entry, for the current poll
+    bool m_debugStormEnabled = false;
+    bool m_debugStormThresholdValid = false;
+    double m_debugStormThreshold = 0;
+
+private:
+    // Returns false if the counters of the queue are the ones of its previous evaluation
+    bool sampleQueue(QueueState &queue, const Counters &queueCounters, const Counters &portCounters,
+            uint64_t now, uint64_t wallTime);
+    void detectQueue(const std::string &queueKey, QueueState &queue, const Counters &queueCounters,
+            const Counters &portCounters, PollResult &result);
+    void restoreQueue(const std::string &queueKey, QueueState &queue, const Counters &queueCounters,
+            const Counters &portCounters, PollResult &result);
+
+    std::map<std::string, QueueState> m_queues;
+
+    // Time stamp of the PFC watchdog port counters recorded by syncd, in nanoseconds, if there is one
+    bool m_portTimestampValid = false;
+    double m_portTimestamp = 0;
+    // For the current poll, whether the time stamp advanced and by how long, in microseconds
+    bool m_portTimestampAdvanced = false;
+    bool m_portIntervalValid = false;
+    double m_portInterval = 0;
+};
+
+// Model of pfc_detect_vs.lua
+class PfcWdVsDetector : public PfcWdDetector
+{
+public:
+    explicit PfcWdVsDetector(uint32_t pollInterval) : PfcWdDetector(pollInterval) {}
+
+protected:
+    bool detect(const std::string &queueKey, QueueState &queue, const Counters &queueCounters,
+            const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result) override;
+};
+
+// Model of pfc_detect_mellanox.lua
+class PfcWdMellanoxDetector : public PfcWdDetector
+{
+public:
+    explicit PfcWdMellanoxDetector(uint32_t pollInterval) : PfcWdDetector(pollInterval) {}
+
+protected:
+    bool detect(const std::string &queueKey, QueueState &queue, const Counters &queueCounters,
+            const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result) override;
+};
+
+// Model of pfc_detect_broadcom.lua
+class PfcWdBroadcomDetector : public PfcWdDetector
+{
+public:
+    explicit PfcWdBroadcomDetector(uint32_t pollInterval) : PfcWdDetector(pollInterval) {}
+
+protected:
+    bool detect(const std::string &queueKey, QueueState &queue, const Counters &queueCounters,
+            const Counters &portCounters, double &timeLeft, double detectionTime, PollResult &result) override;
+
+private:
+    void updateTimePaused(const QueueState &queue, const Counters &portCounters, bool recentRestarted,
+            CountersUpdates &updates);
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <inttypes.h>
+#include <chrono>
 #include <unordered_map>
 #include "pfcwdorch.h"
 #include "sai_serialize.h"
@@ -10,6 +11,7 @@
 #include "notifier.h"
 #include "schema.h"
 #include "subscriberstatetable.h"
+#include "countersreader.h"
 
 #define PFC_WD_GLOBAL                   "GLOBAL"
 #define PFC_WD_ACTION                   "action"
@@ -18,6 +20,8 @@
 #define PFC_STAT_HISTORY                "pfc_stat_history"
 #define BIG_RED_SWITCH_FIELD            "BIG_RED_SWITCH"
 #define PFC_WD_IN_STORM                 "storm"
+#define PFC_WD_DETECTOR                 "detector"
+#define PFC_WD_DETECTOR_NATIVE          "native"
 
 #define PFC_WD_DETECTION_TIME_MAX       (5 * 1000)
 #define PFC_WD_DETECTION_TIME_MIN       100
@@ -354,12 +358,17 @@ task_process_status PfcWdSwOrch<DropHandler, ForwardHandler>::createEntry(const
             if (field == POLL_INTERVAL_FIELD)
             {
                 this->m_pfcwdFlexCounterManager->updateGroupPollingInterval(stoi(value));
+                setDetectorPollInterval(stoi(value));
             }
             else if (field == BIG_RED_SWITCH_FIELD)
             {
                 SWSS_LOG_NOTICE("Receive brs mode set, %s", value.c_str());
                 setBigRedSwitchMode(value);
             }
+            else if (field == PFC_WD_DETECTOR)
+            {
+                SWSS_LOG_NOTICE("PFC watchdog detector %s takes effect on orchagent restart", value.c_str());
+            }
         }
     }
     else
@@ -595,6 +604,10 @@ bool PfcWdSwOrch<DropHandler, ForwardHandler>::registerInWdDb(const Port& port,
 
         // Create internal entry
         m_entryMap.emplace(queueId, PfcWdQueueEntry(action, port.m_port_id, i, port.m_alias));
+        if (m_detector)
+        {
+            m_detector->addQueue(queueIdStr, sai_serialize_object_id(port.m_port_id), i);
+        }
 
         // Initialize PFC WD related counters
         PfcWdActionHandler::initWdCounters(
@@ -663,6 +676,10 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::unregisterFromWdDb(const Port& po
         }
 
         m_entryMap.erase(queueId);
+        if (m_detector)
+        {
+            m_detector->removeQueue(sai_serialize_object_id(queueId));
+        }
 
         // Clean up
         string countersKey = this->getCountersTable()->getTableName() + this->getCountersTable()->getTableNameSeparator() + sai_serialize_object_id(queueId);
@@ -700,22 +717,42 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
         restorePluginName = "pfc_restore.lua";
     }
 
-    try
+    // The native detector is selected by the PFC_WD|GLOBAL detector field on platforms having one,
+    // syncd then only polls the counters and runs no plugin
+    string detector;
+    Table cfgPfcWdTable(db, CFG_PFC_WD_TABLE_NAME);
+    if (cfgPfcWdTable.hget(PFC_WD_GLOBAL, PFC_WD_DETECTOR, detector) && detector == PFC_WD_DETECTOR_NATIVE)
     {
-        string detectLuaScript = swss::loadLuaScript(detectPluginName);
-        detectSha = swss::loadRedisScript(
-                this->getCountersDb().get(),
-                detectLuaScript);
-
-        string restoreLuaScript = swss::loadLuaScript(restorePluginName);
-        restoreSha = swss::loadRedisScript(
-                this->getCountersDb().get(),
-                restoreLuaScript);
-        plugins = detectSha + "," + restoreSha;
+        m_detector = PfcWdDetector::create(this->m_platform, static_cast<uint32_t>(m_pollInterval));
+        if (m_detector == nullptr)
+        {
+            SWSS_LOG_WARN("No native PFC watchdog detector on platform %s, using lua plugins", this->m_platform.c_str());
+        }
     }
-    catch (...)
+
+    if (m_detector)
     {
-        SWSS_LOG_WARN("Lua scripts and polling interval for PFC watchdog were not set successfully");
+        SWSS_LOG_NOTICE("PFC watchdog storms are detected in orchagent on platform %s", this->m_platform.c_str());
+    }
+    else
+    {
+        try
+        {
+            string detectLuaScript = swss::loadLuaScript(detectPluginName);
+            detectSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    detectLuaScript);
+
+            string restoreLuaScript = swss::loadLuaScript(restorePluginName);
+            restoreSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    restoreLuaScript);
+            plugins = detectSha + "," + restoreSha;
+        }
+        catch (...)
+        {
+            SWSS_LOG_WARN("Lua scripts and polling interval for PFC watchdog were not set successfully");
+        }
     }
 
     this->m_pfcwdFlexCounterManager = make_shared<FlexCounterTaggedCachedManager<sai_object_type_t>>(
@@ -733,6 +770,15 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
     Orch::addExecutor(executor);
     timer->start();
 
+    if (m_detector)
+    {
+        auto detectorInterv = timespec { .tv_sec = m_pollInterval / 1000, .tv_nsec = (m_pollInterval % 1000) * 1000000L };
+        m_detectorTimer = new SelectableTimer(detectorInterv);
+        auto detectorExecutor = new ExecutableTimer(m_detectorTimer, this, "PFC_WD_DETECTOR_POLL");
+        Orch::addExecutor(detectorExecutor);
+        m_detectorTimer->start();
+    }
+
     auto ssTable = new swss::SubscriberStateTable(
             m_applDb.get(), APP_PFC_WD_TABLE_NAME, TableConsumable::DEFAULT_POP_BATCH_SIZE, default_orch_pri);
     auto ssConsumer = new Consumer(ssTable, this, APP_PFC_WD_TABLE_NAME);
@@ -897,6 +943,15 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(swss::NotificationConsumer
 
     wdNotification.pop(queueIdStr, event, values);
 
+    handleWdEvent(queueIdStr, event, values);
+}
+
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::handleWdEvent(const string &queueIdStr, const string &event,
+        const vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
     string info;
     for (auto &fv : values)
     {
@@ -921,6 +976,12 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    if (&timer == m_detectorTimer)
+    {
+        pollDetector();
+        return;
+    }
+
     for (auto& handlerPair : m_entryMap)
     {
         if (handlerPair.second.handler != nullptr)
@@ -931,6 +992,86 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 
 }
 
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::pollDetector()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_bigRedSwitchFlag)
+    {
+        return;
+    }
+
+    // The entries of COUNTERS_DB the detector needs are read in one pipeline, ports are shared by their queues
+    auto countersKeys = m_detector->getCountersKeys();
+    vector<string> keys;
+    for (const auto &key : countersKeys)
+    {
+        keys.push_back(this->getCountersTable()->getKeyName(key));
+    }
+    keys.push_back("DEBUG_STORM");
+
+    vector<PfcWdDetector::Counters> entries;
+    readEntries(this->getCountersDb().get(), keys, entries);
+
+    unordered_map<string, const PfcWdDetector::Counters *> counters;
+    for (size_t i = 0; i < countersKeys.size(); i++)
+    {
+        counters.emplace(countersKeys[i], &entries[i]);
+    }
+    auto reader = [&](const string &key) -> const PfcWdDetector::Counters *
+    {
+        auto it = counters.find(key);
+        return it == counters.end() || it->second->empty() ? nullptr : it->second;
+    };
+
+    // Intervals are measured on the monotonic clock, the wall clock only dates the events
+    auto now = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    auto wallTime = chrono::duration_cast<chrono::microseconds>(chrono::system_clock::now().time_since_epoch()).count();
+
+    PfcWdDetector::PollResult result;
+    m_detector->poll(static_cast<uint64_t>(now), static_cast<uint64_t>(wallTime), reader, entries.back(), result);
+
+    if (!result.updates.empty())
+    {
+        auto countersTable = this->getCountersTable();
+        countersTable->setBuffered(true);
+        for (const auto &update : result.updates)
+        {
+            countersTable->set(update.first, update.second);
+        }
+        countersTable->flush();
+        countersTable->setBuffered(false);
+    }
+
+    for (const auto &message : result.debugMessages)
+    {
+        this->getCountersDb()->publish("PFC_WD_DEBUG", message);
+    }
+
+    for (const auto &event : result.events)
+    {
+        handleWdEvent(event.queueKey, event.event, event.info);
+    }
+}
+
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::setDetectorPollInterval(int pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_detector)
+    {
+        return;
+    }
+
+    m_detector->setPollInterval(static_cast<uint32_t>(pollInterval));
+
+    auto interv = timespec { .tv_sec = pollInterval / 1000, .tv_nsec = (pollInterval % 1000) * 1000000L };
+    m_detectorTimer->setInterval(interv);
+    m_detectorTimer->reset();
+}
+
 template <typename DropHandler, typename ForwardHandler>
 void PfcWdSwOrch<DropHandler, ForwardHandler>::report_pfc_storm(
         sai_object_id_t id, const PfcWdQueueEntry *entry, const string &info)
@@ -4,6 +4,7 @@
 #include "orch.h"
 #include "port.h"
 #include "pfcactionhandler.h"
+#include "pfcwddetector.h"
 #include "producertable.h"
 #include "notificationconsumer.h"
 #include "timer.h"
@@ -124,6 +125,9 @@ private:
             uint32_t detectionTime, uint32_t restorationTime, PfcWdAction action, string pfcStatHistory);
     void unregisterFromWdDb(const Port& port);
     void doTask(swss::NotificationConsumer &wdNotification);
+    void handleWdEvent(const string &queueIdStr, const string &event, const vector<swss::FieldValueTuple> &values);
+    void pollDetector();
+    void setDetectorPollInterval(int pollInterval);
 
     unordered_set<string> filterPfcCounters(const unordered_set<string> &counters, set<uint8_t>& losslessTc);
     string getFlexCounterTableKey(string s);
@@ -144,6 +148,10 @@ private:
     bool m_bigRedSwitchFlag = false;
     int m_pollInterval;
 
+    // In-process storm detection, instead of the lua plugins run by syncd
+    unique_ptr<PfcWdDetector> m_detector;
+    SelectableTimer *m_detectorTimer = nullptr;
+
     shared_ptr<DBConnector> m_applDb = nullptr;
     // Track queues in storm
     shared_ptr<Table> m_applTable = nullptr;
@@ -38,6 +38,7 @@
 #include "switchorch.h"
 #include "stringutility.h"
 #include "subscriberstatetable.h"
+#include "rateengine.h"
 #include "warm_restart.h"
 
 #include "saitam.h"
@@ -742,8 +743,12 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         string pgLuaScript = swss::loadLuaScript(pgWmPluginName);
         pgWmSha = swss::loadRedisScript(m_counter_db.get(), pgLuaScript);
 
-        string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
-        portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
+        // Port rates computed in orchagent don't need the plugin
+        if (!isNativeRatesEnabled())
+        {
+            string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
+            portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
+        }
 
         string nvdaPortTrimLuaScript = swss::loadLuaScript(nvdaPortTrimPluginName);
         nvdaPortTrimSha = swss::loadRedisScript(m_counter_db.get(), nvdaPortTrimLuaScript);
@@ -1667,40 +1672,69 @@ unordered_set<string>& PortsOrch::getAllVlans()
     return m_vlanPorts;
 }
 
-bool PortsOrch::getPort(string alias, Port &p)
+bool PortsOrch::getPort(const string &alias, Port &p)
 {
     SWSS_LOG_ENTER();
 
-    if (m_portList.find(alias) == m_portList.end())
+    const Port *port = getPortPtr(alias);
+    if (!port)
     {
         return false;
     }
-    else
-    {
-        p = m_portList[alias];
-        return true;
-    }
+
+    p = *port;
+    return true;
 }
 
 bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
-    auto itr = saiOidToAlias.find(id);
-    if (itr == saiOidToAlias.end())
+    const Port *p = getPortPtr(id);
+    if (!p)
     {
         return false;
     }
-    else
+
+    port = *p;
+    return true;
+}
+
+Port *PortsOrch::getPortPtr(const string &alias)
+{
+    return const_cast<Port *>(static_cast<const PortsOrch *>(this)->getPortPtr(alias));
+}
+
+Port *PortsOrch::getPortPtr(sai_object_id_t id)
+{
+    return const_cast<Port *>(static_cast<const PortsOrch *>(this)->getPortPtr(id));
+}
+
+const Port *PortsOrch::getPortPtr(const string &alias) const
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
     {
-        if (!getPort(itr->second, port))
-        {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
-        }
-        return true;
+        return nullptr;
     }
 
-    return false;
+    return &itr->second;
+}
+
+const Port *PortsOrch::getPortPtr(sai_object_id_t id) const
+{
+    auto itr = saiOidToAlias.find(id);
+    if (itr == saiOidToAlias.end())
+    {
+        return nullptr;
+    }
+
+    const Port *port = getPortPtr(itr->second);
+    if (!port)
+    {
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
+    }
+    return port;
 }
 
 void PortsOrch::increasePortRefCount(const string &alias)
@@ -2061,7 +2095,7 @@ void PortsOrch::updateChildPortsMtu(const Port &p, const uint32_t mtu)
     }
 }
 
-void PortsOrch::setPort(string alias, Port p)
+void PortsOrch::setPort(const string &alias, const Port &p)
 {
     m_portList[alias] = p;
 }
@@ -3938,6 +3972,9 @@ bool PortsOrch::initPortsBulk(std::vector<Port>& ports)
         status = false;
     }
 
+    /* The port names of the bulk are written to the Counter DB at once */
+    m_counterNameMapUpdater->setBuffered(true);
+
     for (auto& p: ports)
     {
         const auto& alias = p.m_alias;
@@ -3952,6 +3989,8 @@ bool PortsOrch::initPortsBulk(std::vector<Port>& ports)
         SWSS_LOG_NOTICE("Initialized port %s", alias.c_str());
     }
 
+    m_counterNameMapUpdater->setBuffered(false);
+
     return status;
 }
 
@@ -3988,6 +4027,7 @@ void PortsOrch::registerPort(Port &p)
 
     // Install a flex counter for this port to track stats
     auto flex_counters_orch = gDirectory.get<FlexCounterOrch*>();
+    flex_counters_orch->setNativeRatesObject(COUNTERS_PORT_NAME_MAP, p.m_alias, sai_serialize_object_id(p.m_port_id));
     /* Delay installing the counters if they are yet enabled
     If they are enabled, install the counters immediately */
     if (flex_counters_orch->getPortCountersState())
@@ -4061,6 +4101,7 @@ void PortsOrch::deInitPort(string alias, sai_object_id_t port_id)
 
     /* remove port name map from counter table */
     m_counterNameMapUpdater->delCounterNameMap(alias);
+    flex_counters_orch->delNativeRatesObject(COUNTERS_PORT_NAME_MAP, alias);
 
     /* Remove the associated port serdes attribute */
     removePortSerdesAttribute(p.m_port_id);
@@ -4275,6 +4316,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
             }
 
             setPortConfigState(PORT_CONFIG_RECEIVED);
+            m_portConfigDoneTime = std::chrono::steady_clock::now();
 
             SWSS_LOG_INFO("Got PortConfigDone notification from portsyncd");
 
@@ -8011,6 +8053,9 @@ void PortsOrch::generateQueueMap(map<string, FlexCounterQueueStates> queuesState
         queuesStateVector.clear();
     }
 
+    /* The maps of all ports are written at once */
+    BufferCounterMaps maps;
+
     for (const auto& it: m_portList)
     {
         if (it.second.m_type == Port::PHY)
@@ -8029,10 +8074,10 @@ void PortsOrch::generateQueueMap(map<string, FlexCounterQueueStates> queuesState
                 }
                 queuesStateVector.insert(make_pair(it.second.m_alias, flexCounterQueueState));
             }
-            generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), false);
+            generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), false, maps);
             if (gMySwitchType == "voq")
             {
-                generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), true);
+                generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), true, maps);
             }
         }
 
@@ -8044,30 +8089,37 @@ void PortsOrch::generateQueueMap(map<string, FlexCounterQueueStates> queuesState
                 FlexCounterQueueStates flexCounterQueueState(maxQueueNumber);
                 queuesStateVector.insert(make_pair(it.second.m_alias, flexCounterQueueState));
             }
-            generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), true);
+            generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), true, maps);
         }
     }
 
-    m_isQueueMapGenerated = true;
-}
-
-void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq)
-{
-    /* Create the Queue map in the Counter DB */
-    vector<FieldValueTuple> queueVector;
-    vector<FieldValueTuple> queuePortVector;
-    vector<FieldValueTuple> queueIndexVector;
-    vector<FieldValueTuple> queueTypeVector;
-    std::vector<sai_object_id_t> queue_ids;
-
-    if (voq)
+    m_queueCounterNameMapUpdater->setCounterNameMap(maps.names);
+    if (!maps.voqNames.empty())
     {
-        queue_ids = m_port_voq_ids[port.m_alias];
+        m_voqTable->set("", maps.voqNames);
     }
-    else
+    if (!maps.ports.empty())
+    {
+        m_queuePortTable->set("", maps.ports);
+    }
+    if (!maps.indexes.empty())
     {
-        queue_ids = port.m_queue_ids;
+        m_queueIndexTable->set("", maps.indexes);
     }
+    if (!maps.types.empty())
+    {
+        m_queueTypeTable->set("", maps.types);
+    }
+
+    SWSS_LOG_NOTICE("Generated the maps of %zu queues and %zu VOQs", maps.names.size(), maps.voqNames.size());
+
+    m_isQueueMapGenerated = true;
+}
+
+void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq, BufferCounterMaps& maps)
+{
+    /* Add the Queues of the port to the Counter DB maps */
+    const auto& queue_ids = voq ? m_port_voq_ids[port.m_alias] : port.m_queue_ids;
 
     for (size_t queueIndex = 0; queueIndex < queue_ids.size(); ++queueIndex)
     {
@@ -8094,21 +8146,24 @@ void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates
             {
                 continue;
             }
-            queueTypeVector.emplace_back(id, sai_queue_type_string_map[queueType]);
-            queueIndexVector.emplace_back(id, to_string(queueRealIndex));
+            maps.types.emplace_back(id, sai_queue_type_string_map[queueType]);
+            maps.indexes.emplace_back(id, to_string(queueRealIndex));
         }
 
-        queueVector.emplace_back(name.str(), id);
         if (voq)
         {
+            maps.voqNames.emplace_back(name.str(), id);
+
             // Install a flex counter for this voq to track stats. Voq counters do
             // not have buffer queue config. So it does not get enabled through the
             // flexcounter orch logic. Always enabled voq counters.
             addQueueFlexCountersPerPortPerQueueIndex(port, queueIndex, true, queueType);
-            queuePortVector.emplace_back(id, sai_serialize_object_id(port.m_system_port_oid));
+            maps.ports.emplace_back(id, sai_serialize_object_id(port.m_system_port_oid));
         }
         else
         {
+            maps.names.emplace_back(name.str(), id);
+
             // In voq systems, always install a flex counter for this egress queue
             // to track stats. In voq systems, the buffer profiles are defined on
             // sysports. So the phy ports do not have buffer queue config. Hence
@@ -8119,23 +8174,14 @@ void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates
             {
                addQueueFlexCountersPerPortPerQueueIndex(port, queueIndex, false, queueType);
             }
-            queuePortVector.emplace_back(id, sai_serialize_object_id(port.m_port_id));
+            maps.ports.emplace_back(id, sai_serialize_object_id(port.m_port_id));
         }
     }
 
-    if (voq)
-    {
-        m_voqTable->set("", queueVector);
-    }
-    else
+    if (!voq)
     {
-        m_queueCounterNameMapUpdater->setCounterNameMap(queueVector);
         CounterCheckOrch::getInstance().addPort(port);
     }
-    m_queuePortTable->set("", queuePortVector);
-    m_queueIndexTable->set("", queueIndexVector);
-    m_queueTypeTable->set("", queueTypeVector);
-
 }
 
 void PortsOrch::addQueueFlexCounters(map<string, FlexCounterQueueStates> queuesStateVector)
@@ -8200,7 +8246,6 @@ void PortsOrch::addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueSt
 void PortsOrch::addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, bool voq, sai_queue_type_t queueType)
 {
     std::unordered_set<string> counter_stats;
-    std::vector<sai_object_id_t> queue_ids;
 
     for (const auto& it: queue_stat_ids)
     {
@@ -8212,12 +8257,8 @@ void PortsOrch::addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_
         {
             counter_stats.emplace(sai_serialize_queue_stat(voq_it));
         }
-        queue_ids = m_port_voq_ids[port.m_alias];
-    }
-    else
-    {
-        queue_ids = port.m_queue_ids;
     }
+    const auto& queue_ids = voq ? m_port_voq_ids[port.m_alias] : port.m_queue_ids;
 
     queue_stat_manager.setCounterIdList(queue_ids[queueIndex], CounterType::QUEUE, counter_stats, queueType);
 }
@@ -8430,6 +8471,9 @@ void PortsOrch::generatePriorityGroupMap(map<string, FlexCounterPgStates> pgsSta
         pgsStateVector.clear();
     }
 
+    /* The maps of all ports are written at once */
+    BufferCounterMaps maps;
+
     for (const auto& it: m_portList)
     {
         if (it.second.m_type == Port::PHY)
@@ -8444,20 +8488,28 @@ void PortsOrch::generatePriorityGroupMap(map<string, FlexCounterPgStates> pgsSta
                 }
                 pgsStateVector.insert(make_pair(it.second.m_alias, flexCounterPgState));
             }
-            generatePriorityGroupMapPerPort(it.second, pgsStateVector.at(it.second.m_alias));
+            generatePriorityGroupMapPerPort(it.second, pgsStateVector.at(it.second.m_alias), maps);
         }
     }
 
+    m_pgCounterNameMapUpdater->setCounterNameMap(maps.names);
+    if (!maps.ports.empty())
+    {
+        m_pgPortTable->set("", maps.ports);
+    }
+    if (!maps.indexes.empty())
+    {
+        m_pgIndexTable->set("", maps.indexes);
+    }
+
+    SWSS_LOG_NOTICE("Generated the maps of %zu priority groups", maps.names.size());
+
     m_isPriorityGroupMapGenerated = true;
 }
 
-void PortsOrch::generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgStates& pgsState)
+void PortsOrch::generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgStates& pgsState, BufferCounterMaps& maps)
 {
-    /* Create the PG map in the Counter DB */
-    vector<FieldValueTuple> pgVector;
-    vector<FieldValueTuple> pgPortVector;
-    vector<FieldValueTuple> pgIndexVector;
-
+    /* Add the PGs of the port to the Counter DB maps */
     for (size_t pgIndex = 0; pgIndex < port.m_priority_group_ids.size(); ++pgIndex)
     {
         if (!pgsState.isPgCounterEnabled(static_cast<uint32_t>(pgIndex)))
@@ -8469,16 +8521,11 @@ void PortsOrch::generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgS
 
         const auto id = sai_serialize_object_id(port.m_priority_group_ids[pgIndex]);
 
-        pgVector.emplace_back(name.str(), id);
-        pgPortVector.emplace_back(id, sai_serialize_object_id(port.m_port_id));
-        pgIndexVector.emplace_back(id, to_string(pgIndex));
-
+        maps.names.emplace_back(name.str(), id);
+        maps.ports.emplace_back(id, sai_serialize_object_id(port.m_port_id));
+        maps.indexes.emplace_back(id, to_string(pgIndex));
     }
 
-    m_pgCounterNameMapUpdater->setCounterNameMap(pgVector);
-    m_pgPortTable->set("", pgPortVector);
-    m_pgIndexTable->set("", pgIndexVector);
-
     CounterCheckOrch::getInstance().addPort(port);
 }
 
@@ -8840,29 +8887,31 @@ void PortsOrch::addWredQueueFlexCountersPerPort(const Port& port, FlexCounterQue
 void PortsOrch::addWredQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex,  bool voq, sai_queue_type_t queueType)
 {
     std::unordered_set<string> counter_stats;
-    std::vector<sai_object_id_t> queue_ids;
 
     for (const auto& it: wred_queue_stat_ids)
     {
         counter_stats.emplace(sai_serialize_queue_stat(it));
     }
-    if (voq)
-    {
-        queue_ids = m_port_voq_ids[port.m_alias];
-    }
-    else
-    {
-        queue_ids = port.m_queue_ids;
-    }
+    const auto& queue_ids = voq ? m_port_voq_ids[port.m_alias] : port.m_queue_ids;
 
     wred_queue_stat_manager.setCounterIdList(queue_ids[queueIndex], CounterType::QUEUE, counter_stats, queueType);
 }
 
 void PortsOrch::flushCounters()
 {
+    size_t count = 0;
+
     for (auto counter_manager : counter_managers)
     {
-        counter_manager.get().flush();
+        count += counter_manager.get().flush();
+    }
+
+    if (count && m_portConfigDoneTime != std::chrono::steady_clock::time_point())
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - m_portConfigDoneTime).count();
+        SWSS_LOG_NOTICE("Registered the counters of %zu objects, %lld ms after PortConfigDone",
+                count, static_cast<long long>(elapsed));
     }
 }
 
@@ -8894,10 +8943,134 @@ void PortsOrch::doTask(NotificationConsumer &consumer)
     std::deque<KeyOpFieldsValuesTuple> entries;
     consumer.pops(entries);
 
+    /* The DB updates of the port state changes of a batch are written in one pipeline */
+    bool statusBatch = &consumer == m_portStatusNotificationConsumer;
+    if (statusBatch)
+    {
+        m_portTable->setBuffered(true);
+        m_portStateTable.setBuffered(true);
+        m_portOpErrTable.setBuffered(true);
+    }
+
     for (auto& entry : entries)
     {
         handleNotification(consumer, entry);
     }
+
+    if (statusBatch)
+    {
+        updatePortsOperSpeedAndFec();
+
+        m_portTable->flush();
+        m_portStateTable.flush();
+        m_portOpErrTable.flush();
+        m_portTable->setBuffered(false);
+        m_portStateTable.setBuffered(false);
+        m_portOpErrTable.setBuffered(false);
+    }
+}
+
+/*
+ * Fetches the oper speed and FEC of the ports that came up in the current
+ * notification batch with one bulk get, and updates them in STATE_DB.
+ */
+void PortsOrch::updatePortsOperSpeedAndFec()
+{
+    SWSS_LOG_ENTER();
+
+    vector<Port *> ports;
+    unordered_set<string> seen;
+    for (const auto &alias : m_operUpPorts)
+    {
+        Port *port = getPortPtr(alias);
+        /* A later notification of the batch may have brought the port down */
+        if (!port || port->m_oper_status != SAI_PORT_OPER_STATUS_UP || !seen.insert(alias).second)
+        {
+            continue;
+        }
+
+        /* Only physical ports have oper speed and FEC */
+        if (port->m_type != Port::PHY)
+        {
+            updateDbPortOperSpeed(*port, 0);
+            updateDbPortOperFec(*port, "N/A");
+            continue;
+        }
+        ports.push_back(port);
+    }
+    m_operUpPorts.clear();
+
+    if (ports.empty())
+    {
+        return;
+    }
+
+    /* Oper speed of all ports first, followed by their oper FEC if supported */
+    const auto portCount = static_cast<uint32_t>(ports.size());
+    PortBulker bulker(oper_fec_sup ? 2 * portCount : portCount);
+
+    sai_attribute_t attr;
+    attr.id = SAI_PORT_ATTR_OPER_SPEED;
+    for (const auto port : ports)
+    {
+        bulker.add(port->m_port_id, attr);
+    }
+    if (oper_fec_sup)
+    {
+        attr.id = SAI_PORT_ATTR_OPER_PORT_FEC_MODE;
+        for (const auto port : ports)
+        {
+            bulker.add(port->m_port_id, attr);
+        }
+    }
+
+    bulker.executeGet();
+
+    for (size_t idx = 0; idx < portCount; idx++)
+    {
+        Port &port = *ports[idx];
+
+        sai_uint32_t speed = 0;
+        if (bulker.statuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            speed = bulker.attrList[idx].value.u32;
+            if (speed == 0)
+            {
+                // The port may have gone down after the notification, see getPortOperSpeed()
+                SWSS_LOG_WARN("Port %s operational speed is 0", port.m_alias.c_str());
+            }
+            else
+            {
+                SWSS_LOG_NOTICE("%s oper speed is %d", port.m_alias.c_str(), speed);
+            }
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to get oper speed for %s", port.m_alias.c_str());
+        }
+        updateDbPortOperSpeed(port, speed);
+
+        string fec_str = "N/A";
+        if (oper_fec_sup)
+        {
+            size_t fecIdx = portCount + idx;
+            if (bulker.statuses[fecIdx] == SAI_STATUS_SUCCESS)
+            {
+                auto fec_mode = static_cast<sai_port_fec_mode_t>(bulker.attrList[fecIdx].value.s32);
+                if (!m_portHlpr.fecToStr(fec_str, fec_mode))
+                {
+                    SWSS_LOG_ERROR("Error unknown fec mode %d while querying port %s fec mode",
+                                static_cast<std::int32_t>(fec_mode), port.m_alias.c_str());
+                    fec_str = "N/A";
+                }
+            }
+            else
+            {
+                SWSS_LOG_NOTICE("Failed to get oper fec for %s", port.m_alias.c_str());
+            }
+        }
+        updateDbPortOperFec(port, fec_str);
+    }
 }
 
 void PortsOrch::handleNotification(NotificationConsumer &consumer, KeyOpFieldsValuesTuple& entry)
@@ -8915,7 +9088,6 @@ void PortsOrch::handleNotification(NotificationConsumer &consumer, KeyOpFieldsVa
 
         for (uint32_t i = 0; i < count; i++)
         {
-            Port port;
             sai_object_id_t id = portoperstatus[i].port_id;
             sai_port_oper_status_t status = portoperstatus[i].port_state;
             sai_port_error_status_t port_oper_err = portoperstatus[i].port_error_status;
@@ -8924,50 +9096,26 @@ void PortsOrch::handleNotification(NotificationConsumer &consumer, KeyOpFieldsVa
                                 "oper_error_status:0x%" PRIx32,
                                 id, status, port_oper_err);
 
-            if (!getPort(id, port))
+            /* The port is updated in place in m_portList */
+            Port *p = getPortPtr(id);
+            if (!p)
             {
                 SWSS_LOG_NOTICE("Got port state change for port id 0x%" PRIx64 " which does not exist, possibly outdated event", id);
                 continue;
             }
+            Port &port = *p;
 
             updatePortOperStatus(port, status);
             if (status == SAI_PORT_OPER_STATUS_UP)
             {
-                sai_uint32_t speed;
-                if (getPortOperSpeed(port, speed))
-                {
-                    SWSS_LOG_NOTICE("%s oper speed is %d", port.m_alias.c_str(), speed);
-                    updateDbPortOperSpeed(port, speed);
-                }
-                else
-                {
-                    updateDbPortOperSpeed(port, 0);
-                }
-                sai_port_fec_mode_t fec_mode;
-                string fec_str;
-                if (oper_fec_sup && getPortOperFec(port, fec_mode))
-                {
-                    if (!m_portHlpr.fecToStr(fec_str, fec_mode))
-                    {
-                        SWSS_LOG_ERROR("Error unknown fec mode %d while querying port %s fec mode",
-                                    static_cast<std::int32_t>(fec_mode), port.m_alias.c_str());
-                        fec_str = "N/A";
-                    }
-                    updateDbPortOperFec(port,fec_str);
-                }
-                else
-                {
-                    updateDbPortOperFec(port, "N/A");
-                }
+                /* Oper speed and FEC are fetched for the whole batch, see updatePortsOperSpeedAndFec() */
+                m_operUpPorts.push_back(port.m_alias);
             } else {
                 if (port_oper_err)
                 {
                     updatePortErrorStatus(port, port_oper_err);
                 }
             }
-
-            /* update m_portList */
-            m_portList[port.m_alias] = port;
         }
 
         sai_deserialize_free_port_oper_status_ntf(count, portoperstatus);
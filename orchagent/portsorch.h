@@ -1,6 +1,7 @@
 #ifndef SWSS_PORTSORCH_H
 #define SWSS_PORTSORCH_H
 
+#include <chrono>
 #include <map>
 #include <unordered_set>
 
@@ -142,12 +143,21 @@ public:
     void cleanPortTable(const vector<string>& keys);
     bool getBridgePort(sai_object_id_t id, Port &port);
     bool setBridgePortLearningFDB(Port &port, sai_bridge_port_fdb_learning_mode_t mode);
-    bool getPort(string alias, Port &port);
+    bool getPort(const string &alias, Port &port);
     bool getPort(sai_object_id_t id, Port &port);
+    /*
+     * Lookup by alias or by port, bridge port, LAG, VLAN or tunnel OID without
+     * copying the port, nullptr if not found. The pointer stays valid until
+     * the port is removed.
+     */
+    Port *getPortPtr(const string &alias);
+    Port *getPortPtr(sai_object_id_t id);
+    const Port *getPortPtr(const string &alias) const;
+    const Port *getPortPtr(sai_object_id_t id) const;
     void increasePortRefCount(const string &alias);
     void decreasePortRefCount(const string &alias);
     bool getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port);
-    void setPort(string alias, Port port);
+    void setPort(const string &alias, const Port &port);
     void getCpuPort(Port &port);
     void initHostTxReadyState(Port &port);
     void initializePortOperErrors(Port &port);
@@ -337,6 +347,8 @@ private:
 
     unordered_set<string> m_vlanPorts;
     port_config_state_t m_portConfigState = PORT_CONFIG_MISSING;
+    /* When PortConfigDone was received, to report when the counters are registered */
+    std::chrono::steady_clock::time_point m_portConfigDoneTime;
     sai_uint32_t m_portCount;
     map<set<uint32_t>, sai_object_id_t> m_portListLaneMap;
     map<set<uint32_t>, PortConfig> m_lanesAliasSpeedMap;
@@ -359,6 +371,8 @@ private:
 
     NotificationConsumer* m_portStatusNotificationConsumer;
     NotificationConsumer* m_portHostTxReadyNotificationConsumer;
+    /* Ports that came up in the notification batch being processed */
+    vector<string> m_operUpPorts;
 
     bool fec_override_sup = false;
     bool oper_fec_sup = false;
@@ -383,6 +397,7 @@ private:
 
     void doTask(NotificationConsumer &consumer);
     void handleNotification(NotificationConsumer &consumer, KeyOpFieldsValuesTuple& entry);
+    void updatePortsOperSpeedAndFec();
     void doTask(swss::SelectableTimer &timer);
 
     void removePortFromLanesMap(string alias);
@@ -465,8 +480,18 @@ private:
 
     bool getQueueTypeAndIndex(sai_object_id_t queue_id, sai_queue_type_t &type, uint8_t &index);
 
+    /* Queue or PG maps of the ports in the Counter DB, written with one HMSET per map */
+    struct BufferCounterMaps
+    {
+        vector<FieldValueTuple> names;
+        vector<FieldValueTuple> voqNames;
+        vector<FieldValueTuple> ports;
+        vector<FieldValueTuple> indexes;
+        vector<FieldValueTuple> types;
+    };
+
     bool m_isQueueMapGenerated = false;
-    void generateQueueMapPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq);
+    void generateQueueMapPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq, BufferCounterMaps& maps);
     bool m_isQueueFlexCountersAdded = false;
     void addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState);
     void addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, bool voq, sai_queue_type_t queueType);
@@ -480,7 +505,7 @@ private:
     void addWredQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, bool voq, sai_queue_type_t queueType);
 
     bool m_isPriorityGroupMapGenerated = false;
-    void generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgStates& pgsState);
+    void generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgStates& pgsState, BufferCounterMaps& maps);
     bool m_isPriorityGroupFlexCountersAdded = false;
     void addPriorityGroupFlexCountersPerPort(const Port& port, FlexCounterPgStates& pgsState);
     void addPriorityGroupFlexCountersPerPortPerPgIndex(const Port& port, size_t pgIndex);
@@ -0,0 +1,311 @@
+#ifndef SWSS_PREFIXTRIE_H
+#define SWSS_PREFIXTRIE_H
+
+#include <memory>
+#include <cstring>
+#include <cstdint>
+#include <sys/socket.h>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+
+/*
+ * Longest prefix match index of IP prefixes.
+ *
+ * Path compressed binary (patricia) trie, one per address family. Each node
+ * holds a prefix, nodes without an entry only join two subtrees. Looking up
+ * the prefixes covering an address or the prefixes under a prefix walks at
+ * most one node per prefix bit, regardless of the number of entries.
+ */
+template <typename T>
+class PrefixTrie
+{
+public:
+    PrefixTrie() : m_size(0) {}
+
+    PrefixTrie(const PrefixTrie&) = delete;
+    PrefixTrie& operator=(const PrefixTrie&) = delete;
+    PrefixTrie(PrefixTrie&&) = default;
+    PrefixTrie& operator=(PrefixTrie&&) = default;
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void clear()
+    {
+        m_root[0].reset();
+        m_root[1].reset();
+        m_size = 0;
+    }
+
+    /* Adds or replaces the entry of the prefix */
+    T& insert(const swss::IpPrefix &prefix, const T &value)
+    {
+        Key key(prefix);
+        std::unique_ptr<Node> *link = &root(prefix);
+
+        while (true)
+        {
+            Node *node = link->get();
+            if (!node)
+            {
+                link->reset(new Node(key, prefix));
+                return set(link->get(), prefix, value);
+            }
+
+            uint8_t common = commonLength(node->key, key);
+            if (common == node->key.len)
+            {
+                if (node->key.len == key.len)
+                {
+                    return set(node, prefix, value);
+                }
+                link = &node->child[key.bit(node->key.len)];
+                continue;
+            }
+
+            /* The prefix and the node diverge, or the prefix covers the node */
+            std::unique_ptr<Node> split(new Node(key.truncate(common), prefix));
+            split->child[node->key.bit(common)] = std::move(*link);
+            if (common != key.len)
+            {
+                Node *leaf = new Node(key, prefix);
+                split->child[key.bit(common)].reset(leaf);
+                *link = std::move(split);
+                return set(leaf, prefix, value);
+            }
+            *link = std::move(split);
+            return set(link->get(), prefix, value);
+        }
+    }
+
+    /* Removes the entry of the prefix, returns false if there is none */
+    bool erase(const swss::IpPrefix &prefix)
+    {
+        Key key(prefix);
+        std::unique_ptr<Node> *link = &root(prefix);
+        std::unique_ptr<Node> *parent = nullptr;
+
+        while (*link && (*link)->key.len < key.len && commonLength((*link)->key, key) == (*link)->key.len)
+        {
+            parent = link;
+            link = &(*link)->child[key.bit((*link)->key.len)];
+        }
+
+        Node *node = link->get();
+        if (!node || node->key.len != key.len || commonLength(node->key, key) != key.len || !node->used)
+        {
+            return false;
+        }
+
+        node->used = false;
+        node->value = T();
+        m_size--;
+
+        compact(*link);
+        if (parent)
+        {
+            compact(*parent);
+        }
+        return true;
+    }
+
+    /* Entry of the prefix, nullptr if there is none */
+    T *find(const swss::IpPrefix &prefix)
+    {
+        Key key(prefix);
+        Node *node = root(prefix).get();
+
+        while (node && node->key.len <= key.len && commonLength(node->key, key) == node->key.len)
+        {
+            if (node->key.len == key.len)
+            {
+                return node->used ? &node->value : nullptr;
+            }
+            node = node->child[key.bit(node->key.len)].get();
+        }
+        return nullptr;
+    }
+
+    /* Calls f(prefix, value) for each prefix covering the address, shortest first */
+    template <typename F>
+    void forEachCovering(const swss::IpAddress &addr, F f)
+    {
+        Key key(addr);
+        Node *node = m_root[addr.isV4() ? 0 : 1].get();
+
+        while (node && commonLength(node->key, key) == node->key.len)
+        {
+            if (node->used)
+            {
+                f(const_cast<const swss::IpPrefix &>(node->prefix), node->value);
+            }
+            if (node->key.len == key.len)
+            {
+                break;
+            }
+            node = node->child[key.bit(node->key.len)].get();
+        }
+    }
+
+    /* Calls f(prefix, value) for each prefix within the given prefix, itself included */
+    template <typename F>
+    void forEachCovered(const swss::IpPrefix &prefix, F f)
+    {
+        Key key(prefix);
+        Node *node = root(prefix).get();
+
+        while (node && node->key.len < key.len)
+        {
+            if (commonLength(node->key, key) != node->key.len)
+            {
+                return;
+            }
+            node = node->child[key.bit(node->key.len)].get();
+        }
+
+        if (node && commonLength(node->key, key) == key.len)
+        {
+            walk(node, f);
+        }
+    }
+
+private:
+    struct Key
+    {
+        uint8_t bytes[16];
+        uint8_t len;
+
+        Key() : len(0)
+        {
+            memset(bytes, 0, sizeof(bytes));
+        }
+
+        explicit Key(const swss::IpAddress &addr)
+        {
+            init(addr.getIp(), addr.isV4() ? 32 : 128);
+        }
+
+        explicit Key(const swss::IpPrefix &prefix)
+        {
+            init(prefix.getIp().getIp(), static_cast<uint8_t>(prefix.getMaskLength()));
+        }
+
+        void init(const swss::ip_addr_t &ip, uint8_t length)
+        {
+            memset(bytes, 0, sizeof(bytes));
+            if (ip.family == AF_INET)
+            {
+                memcpy(bytes, &ip.ip_addr.ipv4_addr, 4);
+            }
+            else
+            {
+                memcpy(bytes, ip.ip_addr.ipv6_addr, 16);
+            }
+            len = length;
+        }
+
+        uint8_t bit(uint8_t pos) const
+        {
+            return static_cast<uint8_t>((bytes[pos / 8] >> (7 - pos % 8)) & 1);
+        }
+
+        Key truncate(uint8_t length) const
+        {
+            Key key;
+            memcpy(key.bytes, bytes, (length + 7) / 8);
+            if (length % 8)
+            {
+                key.bytes[length / 8] = static_cast<uint8_t>(key.bytes[length / 8] & (0xff << (8 - length % 8)));
+            }
+            key.len = length;
+            return key;
+        }
+    };
+
+    struct Node
+    {
+        Key key;
+        /* prefix of the entry, any prefix the node was created for otherwise */
+        swss::IpPrefix prefix;
+        bool used;
+        T value;
+        std::unique_ptr<Node> child[2];
+
+        Node(const Key &k, const swss::IpPrefix &p) : key(k), prefix(p), used(false), value() {}
+    };
+
+    /* Number of leading bits shared by both keys, up to the shortest length */
+    static uint8_t commonLength(const Key &a, const Key &b)
+    {
+        uint8_t max = a.len < b.len ? a.len : b.len;
+        uint8_t len = 0;
+
+        for (uint8_t i = 0; len < max; i++)
+        {
+            uint8_t diff = static_cast<uint8_t>(a.bytes[i] ^ b.bytes[i]);
+            if (diff)
+            {
+                while (!(diff & 0x80))
+                {
+                    diff = static_cast<uint8_t>(diff << 1);
+                    len++;
+                }
+                break;
+            }
+            len = static_cast<uint8_t>(len + 8);
+        }
+        return len < max ? len : max;
+    }
+
+    std::unique_ptr<Node> &root(const swss::IpPrefix &prefix)
+    {
+        return m_root[prefix.isV4() ? 0 : 1];
+    }
+
+    T &set(Node *node, const swss::IpPrefix &prefix, const T &value)
+    {
+        if (!node->used)
+        {
+            node->used = true;
+            m_size++;
+        }
+        node->prefix = prefix;
+        node->value = value;
+        return node->value;
+    }
+
+    /* Drops a node without entry that joins less than two subtrees */
+    static void compact(std::unique_ptr<Node> &link)
+    {
+        Node *node = link.get();
+        if (!node || node->used || (node->child[0] && node->child[1]))
+        {
+            return;
+        }
+
+        std::unique_ptr<Node> child = std::move(node->child[node->child[0] ? 0 : 1]);
+        link = std::move(child);
+    }
+
+    template <typename F>
+    static void walk(Node *node, F &f)
+    {
+        if (node->used)
+        {
+            f(const_cast<const swss::IpPrefix &>(node->prefix), node->value);
+        }
+        for (auto &child : node->child)
+        {
+            if (child)
+            {
+                walk(child.get(), f);
+            }
+        }
+    }
+
+    std::unique_ptr<Node> m_root[2];
+    size_t m_size;
+};
+
+#endif /* SWSS_PREFIXTRIE_H */
@@ -0,0 +1,425 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "logger.h"
+#include "dbconnector.h"
+#include "schema.h"
+#include "rateengine.h"
+
+using namespace std;
+using namespace swss;
+
+#define INIT_DONE_FIELD             "INIT_DONE"
+#define LAST_SUFFIX                 "_last"
+#define SEC_TO_MS                   1000
+
+// The HLD of the FEC BER suggests the statistical average frame BER for the post FEC BER
+#define RS_AVERAGE_FRAME_BER        1e-8
+#define FEC_HISTOGRAM_BINS          16
+
+bool isNativeRatesEnabled()
+{
+    static const bool enabled = []()
+    {
+        DBConnector configDb("CONFIG_DB", 0);
+        Table deviceMetadata(&configDb, CFG_DEVICE_METADATA_TABLE_NAME);
+        string value;
+        return deviceMetadata.hget("localhost", RATES_ENGINE_FIELD, value) && value == RATES_ENGINE_NATIVE;
+    }();
+
+    return enabled;
+}
+
+static bool getCounter(const RateEngine::Counters &counters, const string &field, uint64_t &value)
+{
+    auto it = counters.find(field);
+    if (it == counters.end() || it->second.empty())
+    {
+        return false;
+    }
+
+    char *end = nullptr;
+    value = strtoull(it->second.c_str(), &end, 10);
+    return *end == '\0';
+}
+
+unique_ptr<RateEngine> RateEngine::create(const string &group)
+{
+    if (group == "PORT")
+    {
+        return unique_ptr<RateEngine>(new PortRateEngine());
+    }
+    if (group == "RIF")
+    {
+        return unique_ptr<RateEngine>(new RateEngine(group, {
+            { "RX_BPS", { "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS" } },
+            { "RX_PPS", { "SAI_ROUTER_INTERFACE_STAT_IN_PACKETS" } },
+            { "TX_BPS", { "SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS" } },
+            { "TX_PPS", { "SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS" } }
+        }, false));
+    }
+    if (group == "TRAP")
+    {
+        return unique_ptr<RateEngine>(new RateEngine(group, {
+            { "RX_PPS", { "SAI_COUNTER_STAT_PACKETS" } }
+        }, true));
+    }
+    if (group == "TUNNEL")
+    {
+        return unique_ptr<RateEngine>(new RateEngine(group, {
+            { "RX_BPS", { "SAI_TUNNEL_STAT_IN_OCTETS" } },
+            { "RX_PPS", { "SAI_TUNNEL_STAT_IN_PACKETS" } },
+            { "TX_BPS", { "SAI_TUNNEL_STAT_OUT_OCTETS" } },
+            { "TX_PPS", { "SAI_TUNNEL_STAT_OUT_PACKETS" } }
+        }, true));
+    }
+
+    return nullptr;
+}
+
+RateEngine::RateEngine(const string &group, const vector<Rate> &rates, bool missingAsZero) :
+    m_group(group),
+    m_rates(rates),
+    m_missingAsZero(missingAsZero)
+{
+    for (const auto &rate : m_rates)
+    {
+        vector<size_t> counters;
+        for (const auto &name : rate.counters)
+        {
+            size_t i = 0;
+            while (i < m_counterNames.size() && m_counterNames[i] != name)
+            {
+                i++;
+            }
+            if (i == m_counterNames.size())
+            {
+                m_counterNames.push_back(name);
+            }
+            counters.push_back(i);
+        }
+        m_rateCounters.push_back(counters);
+    }
+
+    m_values.resize(m_counterNames.size());
+    m_last.resize(m_counterNames.size());
+    m_read.resize(m_counterNames.size());
+    m_sum.resize(m_rates.size());
+    m_sumLast.resize(m_rates.size());
+    m_value.resize(m_rates.size());
+}
+
+void RateEngine::addObject(const string &key)
+{
+    if (m_index.find(key) != m_index.end())
+    {
+        return;
+    }
+
+    m_index[key] = m_keys.size();
+    m_keys.push_back(key);
+    m_state.push_back(INIT_NONE);
+    m_lastTime.push_back(0);
+    m_delta.push_back(1);
+    m_weight.push_back(0);
+    for (size_t c = 0; c < m_counterNames.size(); c++)
+    {
+        m_last[c].push_back(0);
+        m_read[c].emplace_back();
+    }
+    for (size_t r = 0; r < m_rates.size(); r++)
+    {
+        m_sum[r].push_back(0);
+        m_sumLast[r].push_back(0);
+        m_value[r].push_back(0);
+    }
+}
+
+void RateEngine::removeObject(const string &key)
+{
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    // The last object takes the place of the removed one in all arrays
+    size_t index = it->second;
+    size_t last = m_keys.size() - 1;
+    m_index.erase(it);
+    if (index != last)
+    {
+        m_keys[index] = m_keys[last];
+        m_index[m_keys[index]] = index;
+        m_state[index] = m_state[last];
+        m_lastTime[index] = m_lastTime[last];
+        for (size_t c = 0; c < m_counterNames.size(); c++)
+        {
+            m_last[c][index] = m_last[c][last];
+        }
+        for (size_t r = 0; r < m_rates.size(); r++)
+        {
+            m_sum[r][index] = m_sum[r][last];
+            m_sumLast[r][index] = m_sumLast[r][last];
+            m_value[r][index] = m_value[r][last];
+        }
+    }
+
+    m_keys.pop_back();
+    m_state.pop_back();
+    m_lastTime.pop_back();
+    m_delta.pop_back();
+    m_weight.pop_back();
+    for (size_t c = 0; c < m_counterNames.size(); c++)
+    {
+        m_last[c].pop_back();
+        m_read[c].pop_back();
+    }
+    for (size_t r = 0; r < m_rates.size(); r++)
+    {
+        m_sum[r].pop_back();
+        m_sumLast[r].pop_back();
+        m_value[r].pop_back();
+    }
+
+    removeObjectState(key);
+}
+
+void RateEngine::clear()
+{
+    auto keys = m_keys;
+    for (const auto &key : keys)
+    {
+        removeObject(key);
+    }
+}
+
+void RateEngine::setPollInterval(uint32_t pollInterval)
+{
+    m_pollInterval = pollInterval;
+}
+
+bool RateEngine::readSample(size_t index, const Counters *counters, uint64_t now)
+{
+    auto &values = m_values;
+    bool changed = false;
+
+    for (size_t c = 0; c < m_counterNames.size(); c++)
+    {
+        if (counters == nullptr || !getCounter(*counters, m_counterNames[c], values[c]))
+        {
+            if (!m_missingAsZero)
+            {
+                return false;
+            }
+            values[c] = 0;
+            m_read[c][index] = "0";
+        }
+        else
+        {
+            m_read[c][index] = counters->at(m_counterNames[c]);
+        }
+        changed = changed || values[c] != m_last[c][index];
+    }
+
+    // syncd polls the counters on its own timer. Counters that did not change since
+    // the previous sample are most likely not polled yet, unless they were for a while
+    if (m_state[index] != INIT_NONE &&
+        (now <= m_lastTime[index] || (!changed && now - m_lastTime[index] < 2 * static_cast<uint64_t>(m_pollInterval))))
+    {
+        return false;
+    }
+
+    for (size_t c = 0; c < m_counterNames.size(); c++)
+    {
+        m_last[c][index] = values[c];
+    }
+    for (size_t r = 0; r < m_rates.size(); r++)
+    {
+        double sum = 0;
+        for (auto c : m_rateCounters[r])
+        {
+            sum += static_cast<double>(values[c]);
+        }
+        m_sumLast[r][index] = m_state[index] == INIT_NONE ? sum : m_sum[r][index];
+        m_sum[r][index] = sum;
+    }
+
+    return true;
+}
+
+void RateEngine::poll(uint64_t now, double alpha, const CountersReader &reader, RatesUpdates &updates)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = m_keys.size();
+    vector<size_t> sampled;
+    vector<InitState> sampledState;
+    vector<const Counters *> sampledCounters;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        m_delta[i] = 1;
+        m_weight[i] = 0;
+
+        const Counters *counters = reader(m_keys[i]);
+        if (!readSample(i, counters, now))
+        {
+            continue;
+        }
+
+        sampled.push_back(i);
+        sampledState.push_back(m_state[i]);
+        sampledCounters.push_back(counters);
+        if (m_state[i] != INIT_NONE)
+        {
+            m_delta[i] = static_cast<double>(now - m_lastTime[i]);
+            // The first rate is stored unsmoothed
+            m_weight[i] = m_state[i] == INIT_DONE ? alpha : 1;
+        }
+        m_lastTime[i] = now;
+    }
+
+    // The new rate of the objects not sampled has a weight of 0, which leaves their rate as is
+    const double *delta = m_delta.data();
+    const double *weight = m_weight.data();
+    for (size_t r = 0; r < m_rates.size(); r++)
+    {
+        const double *sum = m_sum[r].data();
+        const double *sumLast = m_sumLast[r].data();
+        double *value = m_value[r].data();
+        for (size_t i = 0; i < count; i++)
+        {
+            double rate = (sum[i] - sumLast[i]) / delta[i] * SEC_TO_MS;
+            value[i] = weight[i] * rate + (1 - weight[i]) * value[i];
+        }
+    }
+
+    for (size_t s = 0; s < sampled.size(); s++)
+    {
+        size_t i = sampled[s];
+        const string &key = m_keys[i];
+        auto &fields = updates[key];
+
+        if (sampledState[s] != INIT_NONE)
+        {
+            for (size_t r = 0; r < m_rates.size(); r++)
+            {
+                fields.emplace_back(m_rates[r].name, formatNumber(m_value[r][i]));
+            }
+        }
+        for (size_t c = 0; c < m_counterNames.size(); c++)
+        {
+            fields.emplace_back(m_counterNames[c] + LAST_SUFFIX, m_read[c][i]);
+        }
+
+        const Counters *counters = sampledCounters[s];
+        pollObject(key, sampledState[s], counters ? *counters : Counters(), m_delta[i], fields);
+
+        // The init state is only written when it changes
+        if (sampledState[s] != INIT_DONE)
+        {
+            m_state[i] = sampledState[s] == INIT_NONE ? INIT_COUNTERS_LAST : INIT_DONE;
+            updates[key + ":" + m_group].emplace_back(INIT_DONE_FIELD,
+                    m_state[i] == INIT_DONE ? "DONE" : "COUNTERS_LAST");
+        }
+    }
+}
+
+string RateEngine::formatNumber(double value)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.14g", value);
+    return buffer;
+}
+
+PortRateEngine::PortRateEngine() :
+    RateEngine("PORT", {
+        { "RX_BPS", { "SAI_PORT_STAT_IF_IN_OCTETS" } },
+        { "RX_PPS", { "SAI_PORT_STAT_IF_IN_UCAST_PKTS", "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS" } },
+        { "TX_BPS", { "SAI_PORT_STAT_IF_OUT_OCTETS" } },
+        { "TX_PPS", { "SAI_PORT_STAT_IF_OUT_UCAST_PKTS", "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS" } }
+    }, false)
+{
+}
+
+void PortRateEngine::setLineRate(const string &key, size_t laneCount, uint32_t speed)
+{
+    // Serdes rate in bits per second of each lane speed in Mb/s
+    static const map<uint32_t, double> serdesRates =
+    {
+        { 1000, 1.25e+9 },
+        { 10000, 10.3125e+9 },
+        { 25000, 25.78125e+9 },
+        { 50000, 53.125e+9 },
+        { 100000, 106.25e+9 },
+        { 200000, 212.5e+9 }
+    };
+
+    double lineRate = 0;
+    if (laneCount != 0 && speed % laneCount == 0)
+    {
+        auto serdes = serdesRates.find(static_cast<uint32_t>(speed / laneCount));
+        if (serdes != serdesRates.end())
+        {
+            lineRate = static_cast<double>(laneCount) * serdes->second;
+        }
+    }
+
+    m_fec[key].lineRate = lineRate;
+}
+
+void PortRateEngine::pollObject(const string &key, InitState state, const Counters &counters,
+        double delta, vector<FieldValueTuple> &fields)
+{
+    uint64_t correctedBits, uncorrectableFrames;
+    if (!getCounter(counters, "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", correctedBits) ||
+        !getCounter(counters, "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES", uncorrectableFrames))
+    {
+        return;
+    }
+
+    auto &fec = m_fec[key];
+    if (state != INIT_NONE)
+    {
+        double preBer = -1;
+        double postBer = -1;
+        if (fec.lineRate > 0)
+        {
+            double serdesRateTotal = fec.lineRate * delta / 1000;
+            preBer = (static_cast<double>(correctedBits) - static_cast<double>(fec.correctedBitsLast)) / serdesRateTotal;
+            postBer = (static_cast<double>(uncorrectableFrames) - static_cast<double>(fec.uncorrectableFramesLast)) * RS_AVERAGE_FRAME_BER / serdesRateTotal;
+        }
+
+        // Maximum FEC histogram bin with a non zero count
+        int maxT = -1;
+        for (int bin = 0; bin < FEC_HISTOGRAM_BINS; bin++)
+        {
+            uint64_t codewords;
+            if (getCounter(counters, "SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S" + to_string(bin), codewords) && codewords > 0)
+            {
+                maxT = bin;
+            }
+        }
+
+        if (preBer > fec.preBerMax)
+        {
+            fec.preBerMax = preBer;
+            fields.emplace_back("FEC_PRE_BER_MAX", formatNumber(preBer));
+        }
+        fields.emplace_back("FEC_PRE_BER", formatNumber(preBer));
+        fields.emplace_back("FEC_POST_BER", formatNumber(postBer));
+        fields.emplace_back("FEC_MAX_T", to_string(maxT));
+    }
+
+    fec.correctedBitsLast = correctedBits;
+    fec.uncorrectableFramesLast = uncorrectableFrames;
+    // The field names are the ones of port_rates.lua
+    fields.emplace_back("SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last", counters.at("SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS"));
+    fields.emplace_back("SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last", counters.at("SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES"));
+}
+
+void PortRateEngine::removeObjectState(const string &key)
+{
+    m_fec.erase(key);
+}
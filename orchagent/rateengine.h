@@ -0,0 +1,144 @@
+#ifndef SWSS_RATEENGINE_H
+#define SWSS_RATEENGINE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "table.h"
+
+#define RATES_TABLE_NAME            "RATES"
+#define RATES_ENGINE_FIELD          "rates_engine"
+#define RATES_ENGINE_NATIVE         "native"
+
+// Rates are computed by RateEngine in orchagent instead of the rate plugins when
+// DEVICE_METADATA|localhost rates_engine is native. Read once, when orchagent starts
+bool isNativeRatesEnabled();
+
+/*
+ * In-process implementation of the port_rates.lua, rif_rates.lua, trap_rates.lua and
+ * tunnel_rates.lua plugins, which syncd runs in redis after each poll of the counters.
+ *
+ * The previous samples, the rates and the init state of the objects are kept in memory,
+ * one array per counter and per rate indexed by object, and the rates of all objects are
+ * smoothed in a single loop per rate. The fields written to RATES:<oid> and
+ * RATES:<oid>:<group> are the ones of the plugins.
+ */
+class RateEngine
+{
+public:
+    // Fields of a COUNTERS_DB entry
+    typedef std::unordered_map<std::string, std::string> Counters;
+    // Returns the fields of the COUNTERS entry of the key, nullptr if there is none.
+    // The fields are to stay valid until the end of the poll
+    typedef std::function<const Counters *(const std::string &key)> CountersReader;
+    // Fields to be written to the RATES table, by key
+    typedef std::map<std::string, std::vector<swss::FieldValueTuple>> RatesUpdates;
+
+    // Rate published as <name> in RATES:<oid>, from the sum of the counters
+    struct Rate
+    {
+        std::string name;
+        std::vector<std::string> counters;
+    };
+
+    virtual ~RateEngine() = default;
+
+    // Engine of the rates group, PORT, RIF, TRAP or TUNNEL, nullptr if there is none
+    static std::unique_ptr<RateEngine> create(const std::string &group);
+
+    const std::string &getGroup() const { return m_group; }
+    const std::vector<std::string> &getObjects() const { return m_keys; }
+
+    void addObject(const std::string &key);
+    void removeObject(const std::string &key);
+    void clear();
+    void setPollInterval(uint32_t pollInterval);
+
+    // Computes the rates of all objects on the counters read at now, in milliseconds.
+    // The rates are smoothed with alpha from the third sample of an object on
+    void poll(uint64_t now, double alpha, const CountersReader &reader, RatesUpdates &updates);
+
+protected:
+    enum InitState : uint8_t
+    {
+        INIT_NONE,
+        INIT_COUNTERS_LAST,
+        INIT_DONE
+    };
+
+    // Counters missing from COUNTERS_DB are taken as 0 if missingAsZero,
+    // otherwise the object is skipped until all of them are there
+    RateEngine(const std::string &group, const std::vector<Rate> &rates, bool missingAsZero);
+
+    // Called for each object sampled by a poll, after its rates are computed.
+    // delta is the time since the previous sample, in milliseconds
+    virtual void pollObject(const std::string &key, InitState state, const Counters &counters,
+            double delta, std::vector<swss::FieldValueTuple> &fields) {}
+    virtual void removeObjectState(const std::string &key) {}
+
+    // Number as converted to string by lua
+    static std::string formatNumber(double value);
+
+private:
+    bool readSample(size_t index, const Counters *counters, uint64_t now);
+
+    std::string m_group;
+    std::vector<Rate> m_rates;
+    bool m_missingAsZero;
+    uint32_t m_pollInterval = 0;
+
+    // Counters of all rates, and for each rate the indexes of its counters
+    std::vector<std::string> m_counterNames;
+    std::vector<std::vector<size_t>> m_rateCounters;
+
+    // Objects, the arrays below are indexed as m_keys
+    std::vector<std::string> m_keys;
+    std::unordered_map<std::string, size_t> m_index;
+    std::vector<InitState> m_state;
+    std::vector<uint64_t> m_lastTime;
+    // Previous value of each counter, by counter
+    std::vector<std::vector<uint64_t>> m_last;
+    // Current and previous sum of the counters and the rate, by rate
+    std::vector<std::vector<double>> m_sum;
+    std::vector<std::vector<double>> m_sumLast;
+    std::vector<std::vector<double>> m_value;
+    // Per poll, time since the previous sample and weight of the new rate, 0 if not sampled
+    std::vector<double> m_delta;
+    std::vector<double> m_weight;
+    // Per poll, counters read for each object
+    std::vector<std::vector<std::string>> m_read;
+    std::vector<uint64_t> m_values;
+};
+
+// Model of port_rates.lua, which also publishes the pre and post FEC bit error rates
+class PortRateEngine : public RateEngine
+{
+public:
+    PortRateEngine();
+
+    // Serdes rate of the port, from the lane count and the speed in Mb/s of PORT_TABLE
+    void setLineRate(const std::string &key, size_t laneCount, uint32_t speed);
+
+protected:
+    void pollObject(const std::string &key, InitState state, const Counters &counters,
+            double delta, std::vector<swss::FieldValueTuple> &fields) override;
+    void removeObjectState(const std::string &key) override;
+
+private:
+    struct FecState
+    {
+        // Sum of the serdes rates of the lanes in bits per second, 0 if unknown
+        double lineRate = 0;
+        uint64_t correctedBitsLast = 0;
+        uint64_t uncorrectableFramesLast = 0;
+        double preBerMax = 0;
+    };
+
+    std::unordered_map<std::string, FecState> m_fec;
+};
+
+#endif /* SWSS_RATEENGINE_H */
@@ -28,6 +28,18 @@ std::string PrependedComponent(const ReturnCode &status)
     return kOrchagentComponent;
 }
 
+// Append "|field:value" for each attribute without building temporaries.
+void AppendAttrs(std::string &s, const std::vector<swss::FieldValueTuple> &attrs)
+{
+    for (const auto &attr : attrs)
+    {
+        s += "|";
+        s += fvField(attr);
+        s += ":";
+        s += fvValue(attr);
+    }
+}
+
 void RecordDBWrite(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &attrs,
                    const std::string &op)
 {
@@ -36,13 +48,14 @@ void RecordDBWrite(const std::string &table, const std::string &key, const std::
         return;
     }
 
-    std::string s = table + ":" + key + "|" + op;
-    for (const auto &attr : attrs)
-    {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
-    }
+    std::string s = table;
+    s += ":";
+    s += key;
+    s += "|";
+    s += op;
+    AppendAttrs(s, attrs);
 
-    swss::Recorder::Instance().respub.record(s);
+    swss::Recorder::Instance().respub.record(std::move(s));
 }
 
 void RecordResponse(const std::string &response_channel, const std::string &key,
@@ -53,13 +66,14 @@ void RecordResponse(const std::string &response_channel, const std::string &key,
         return;
     }
 
-    std::string s = response_channel + ":" + key + "|" + status;
-    for (const auto &attr : attrs)
-    {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
-    }
+    std::string s = response_channel;
+    s += ":";
+    s += key;
+    s += "|";
+    s += status;
+    AppendAttrs(s, attrs);
 
-    swss::Recorder::Instance().respub.record(s);
+    swss::Recorder::Instance().respub.record(std::move(s));
 }
 
 } // namespace
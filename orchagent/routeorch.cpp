@@ -36,9 +36,14 @@ extern string gMySwitchType;
 /* Default maximum number of next hop groups */
 #define DEFAULT_NUMBER_OF_ECMP_GROUPS   128
 #define DEFAULT_MAX_ECMP_GROUP_SIZE     32
+/* Pooled next hop keys are pruned whenever the pool reaches this size */
+#define NHG_KEY_POOL_PRUNE_SIZE         1024
+/* Bookkeeping of a std::map/std::set node: color and 3 pointers */
+#define RB_TREE_NODE_OVERHEAD           (4 * sizeof(void *))
 
 RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames, SwitchOrch *switchOrch, NeighOrch *neighOrch, IntfsOrch *intfsOrch, VRFOrch *vrfOrch, FgNhgOrch *fgNhgOrch, Srv6Orch *srv6Orch, swss::ZmqServer *zmqServer) :
         gRouteBulker(sai_route_api, gMaxBulkSize),
+        gNextHopRouteBulker(sai_route_api, gMaxBulkSize),
         gLabelRouteBulker(sai_mpls_api, gMaxBulkSize),
         gNextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize),
         ZmqOrch(db, tableNames, zmqServer),
@@ -55,6 +60,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
     SWSS_LOG_ENTER();
 
     m_publisher.setBuffered(true);
+    m_nextHopGroupKeyPoolPruneSize = NHG_KEY_POOL_PRUNE_SIZE;
 
     sai_attribute_t attr;
     attr.id = SAI_SWITCH_ATTR_NUMBER_OF_ECMP_GROUPS;
@@ -148,6 +154,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     /* Add default IPv4 route into the m_syncdRoutes */
     m_syncdRoutes[gVirtualRouterId][default_ip_prefix] = RouteNhg();
+    addSyncdRouteIndex(gVirtualRouterId, default_ip_prefix);
 
     SWSS_LOG_NOTICE("Create IPv4 default route with packet action drop");
 
@@ -168,6 +175,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     /* Add default IPv6 route into the m_syncdRoutes */
     m_syncdRoutes[gVirtualRouterId][v6_default_ip_prefix] = RouteNhg();
+    addSyncdRouteIndex(gVirtualRouterId, v6_default_ip_prefix);
 
     SWSS_LOG_NOTICE("Create IPv6 default route with packet action drop");
 
@@ -302,6 +310,120 @@ sai_object_id_t RouteOrch::getNextHopGroupId(const NextHopGroupKey& nexthops)
     return m_syncdNextHopGroups[nexthops].next_hop_group_id;
 }
 
+/*
+ * Returns a key equal to nextHops which shares its next hop set with the
+ * next hop group or the other routes using the same next hops, so that each
+ * route doesn't own a copy of the set.
+ */
+NextHopGroupKey RouteOrch::internNextHopGroupKey(const NextHopGroupKey& nextHops)
+{
+    if (nextHops.getSize() == 0)
+    {
+        return nextHops;
+    }
+
+    /* Key equality ignores the next hop type, which must be kept as is */
+    auto sameType = [&nextHops](const NextHopGroupKey& key)
+    {
+        return key.is_overlay_nexthop() == nextHops.is_overlay_nexthop() &&
+               key.is_srv6_nexthop() == nextHops.is_srv6_nexthop() &&
+               key.is_srv6_vpn() == nextHops.is_srv6_vpn();
+    };
+
+    auto nhg = m_syncdNextHopGroups.find(nextHops);
+    if (nhg != m_syncdNextHopGroups.end())
+    {
+        return sameType(nhg->first) ? nhg->first : nextHops;
+    }
+
+    auto key = m_nextHopGroupKeyPool.insert(nextHops).first;
+    return sameType(*key) ? *key : nextHops;
+}
+
+/* Drops the pooled keys no route refers to anymore, amortized over the route updates */
+void RouteOrch::pruneNextHopGroupKeyPool()
+{
+    if (m_nextHopGroupKeyPool.size() < m_nextHopGroupKeyPoolPruneSize)
+    {
+        return;
+    }
+
+    for (auto it = m_nextHopGroupKeyPool.begin(); it != m_nextHopGroupKeyPool.end();)
+    {
+        if (it->getShareCount() <= 1)
+        {
+            it = m_nextHopGroupKeyPool.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    m_nextHopGroupKeyPoolPruneSize = std::max<size_t>(NHG_KEY_POOL_PRUNE_SIZE, 2 * m_nextHopGroupKeyPool.size());
+}
+
+RouteTableMemoryUsage RouteOrch::getRouteTableMemoryUsage() const
+{
+    /* Heap bytes of a string, 0 when held in the small string buffer */
+    auto stringBytes = [](const std::string& str)
+    {
+        return str.capacity() > 15 ? str.capacity() + 1 : 0;
+    };
+
+    RouteTableMemoryUsage usage;
+    std::unordered_set<const std::set<NextHopKey> *> nextHopSets;
+
+    for (const auto& routeTable : m_syncdRoutes)
+    {
+        usage.routeBytes += RB_TREE_NODE_OVERHEAD + sizeof(routeTable);
+
+        for (const auto& route : routeTable.second)
+        {
+            usage.routes++;
+            usage.routeBytes += RB_TREE_NODE_OVERHEAD + sizeof(route);
+            usage.routeBytes += stringBytes(route.second.nhg_index) + stringBytes(route.second.context_index);
+
+            const auto& nexthops = route.second.nhg_key.getNextHops();
+            if (nexthops.empty() || !nextHopSets.insert(&nexthops).second)
+            {
+                continue;
+            }
+
+            usage.nextHopBytes += sizeof(nexthops);
+            for (const auto& nh : nexthops)
+            {
+                usage.nextHopBytes += RB_TREE_NODE_OVERHEAD + sizeof(nh);
+                usage.nextHopBytes += stringBytes(nh.alias) + stringBytes(nh.srv6_segment) +
+                                      stringBytes(nh.srv6_source) + stringBytes(nh.srv6_vpn_sid);
+            }
+        }
+    }
+
+    usage.nextHopSets = nextHopSets.size();
+    return usage;
+}
+
+void RouteOrch::addSyncdRouteIndex(sai_object_id_t vrf_id, const IpPrefix& ipPrefix)
+{
+    m_syncdRouteIndexes[vrf_id].insert(ipPrefix, true);
+}
+
+void RouteOrch::removeSyncdRouteIndex(sai_object_id_t vrf_id, const IpPrefix& ipPrefix)
+{
+    auto routeIndex = m_syncdRouteIndexes.find(vrf_id);
+    if (routeIndex == m_syncdRouteIndexes.end())
+    {
+        return;
+    }
+
+    routeIndex->second.erase(ipPrefix);
+    if (routeIndex->second.empty())
+    {
+        m_syncdRouteIndexes.erase(routeIndex);
+    }
+}
+
 void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_id_t vrf_id)
 {
     SWSS_LOG_ENTER();
@@ -317,19 +439,24 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
         observerEntry = m_nextHopObservers.find(host);
 
         /* Find the prefixes that cover the destination IP */
-        if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
+        auto routeTable = m_syncdRoutes.find(vrf_id);
+        auto routeIndex = m_syncdRouteIndexes.find(vrf_id);
+        if (routeTable != m_syncdRoutes.end() && routeIndex != m_syncdRouteIndexes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
+            routeIndex->second.forEachCovering(dstAddr, [&](const IpPrefix& prefix, bool&)
             {
-                if (route.first.isAddressInSubnet(dstAddr))
+                auto route = routeTable->second.find(prefix);
+                if (route != routeTable->second.end())
                 {
                     SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
+                            route->first.to_string().c_str());
                     observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
+                            route->first, route->second);
                 }
-            }
+            });
         }
+
+        m_nextHopObserverIndexes[vrf_id].insert(IpPrefix(dstAddr.to_string()), observerEntry);
     }
 
     observerEntry->second.observers.push_back(observer);
@@ -376,6 +503,15 @@ void RouteOrch::detach(Observer *observer, const IpAddress& dstAddr, sai_object_
             // destination IP.
             if (observerEntry->second.observers.empty())
             {
+                auto observerIndex = m_nextHopObserverIndexes.find(vrf_id);
+                if (observerIndex != m_nextHopObserverIndexes.end())
+                {
+                    observerIndex->second.erase(IpPrefix(dstAddr.to_string()));
+                    if (observerIndex->second.empty())
+                    {
+                        m_nextHopObserverIndexes.erase(observerIndex);
+                    }
+                }
                 m_nextHopObservers.erase(observerEntry);
             }
             break;
@@ -1224,6 +1360,8 @@ void RouteOrch::doTask(ConsumerBase& consumer)
         {
             m_srv6Orch->removeSrv6Nexthops(m_bulkSrv6NhgReducedVec);
         }
+        pruneNextHopGroupKeyPool();
+
         /* No Update to Default Route so we can return */
         if (!(v4_default_nhg_key.getSize()) && !(v6_default_nhg_key.getSize()))
         {
@@ -1246,12 +1384,22 @@ void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPre
 {
     SWSS_LOG_ENTER();
 
-    for (auto& entry : m_nextHopObservers)
+    auto observerIndex = m_nextHopObserverIndexes.find(vrf_id);
+    if (observerIndex == m_nextHopObserverIndexes.end())
     {
-        if (vrf_id != entry.first.first || !prefix.isAddressInSubnet(entry.first.second))
-        {
-            continue;
-        }
+        return;
+    }
+
+    /* Observed destination IPs within the prefix */
+    std::vector<NextHopObserverTable::iterator> entries;
+    observerIndex->second.forEachCovered(prefix, [&entries](const IpPrefix&, NextHopObserverTable::iterator& entry)
+    {
+        entries.push_back(entry);
+    });
+
+    for (auto observerEntry : entries)
+    {
+        auto& entry = *observerEntry;
 
         if (add)
         {
@@ -1826,64 +1974,190 @@ void RouteOrch::removeNextHopRoute(const NextHopKey& nextHop, const RouteKey& ro
     }
 }
 
-bool RouteOrch::updateNextHopRoutes(const NextHopKey& nextHop, uint32_t& numRoutes)
+/**
+ * @brief re-points the single next hop routes using nextHop to its current next hop id
+ * @param nextHop next hop whose id changed
+ * @param numRoutes number of routes updated
+ * @param rollbackNextHopId next hop id the routes pointed to before, if known:
+ *        if some routes fail to update, the updated ones are restored to it so
+ *        that all routes of the next hop keep pointing to the same id
+ * @return true if all routes are updated
+ */
+bool RouteOrch::updateNextHopRoutes(const NextHopKey& nextHop, uint32_t& numRoutes, sai_object_id_t rollbackNextHopId)
 {
-    numRoutes = 0;
-    auto it = m_nextHops.find((nextHop));
+    std::vector<NextHopRouteUpdate> updates;
+    updates.emplace_back(nextHop, rollbackNextHopId);
+
+    bool ret = updateNextHopRoutes(updates);
+    numRoutes = updates.front().numRoutes;
+    return ret;
+}
 
-    if (it == m_nextHops.end())
+/**
+ * @brief re-points the single next hop routes of several next hops in one bulk
+ * @param updates next hops whose id changed, numRoutes is set to the number of
+ *        routes updated for each of them
+ * @return true if all routes are updated. Otherwise the updated routes of the
+ *         next hops with a rollbackNextHopId are restored to it, so that a
+ *         failure leaves these next hops as they were before the call
+ */
+bool RouteOrch::updateNextHopRoutes(std::vector<NextHopRouteUpdate>& updates)
+{
+    auto route_table = m_syncdRoutes.find(gVirtualRouterId);
+
+    size_t count = 0;
+    for (auto& update : updates)
     {
-        SWSS_LOG_INFO("No routes found for NH %s", nextHop.ip_address.to_string().c_str());
-        return true;
+        update.numRoutes = 0;
+        auto it = m_nextHops.find(update.nexthop);
+        if (it != m_nextHops.end())
+        {
+            count += it->second.size();
+        }
     }
 
+    std::vector<sai_route_entry_t> route_entries;
+    std::vector<sai_status_t> object_statuses;
+    /* Update the route belongs to, and the nexthop id set for each route */
+    std::vector<size_t> route_updates;
+    std::vector<sai_attribute_t> route_attrs;
+    route_entries.reserve(count);
+    route_updates.reserve(count);
+    /* The bulker keeps pointers to the entries, statuses and attributes, no reallocation allowed */
+    object_statuses.reserve(count);
+    route_attrs.reserve(updates.size());
+
     sai_route_entry_t route_entry;
     sai_attribute_t route_attr;
-    sai_object_id_t next_hop_id;
+    route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
 
-    auto rt = it->second.begin();
-    while(rt != it->second.end())
+    for (size_t i = 0; i < updates.size(); i++)
     {
-        /* Check if route points to nexthop group and skip */
-        NextHopGroupKey nhg_key = gRouteOrch->getSyncdRouteNhgKey(gVirtualRouterId, (*rt).prefix);
-        if (nhg_key.getSize() > 1)
-        {
-            /* multiple mux nexthop case:
-             * skip for now, muxOrch::updateRoute() will handle route
-             */
-            SWSS_LOG_INFO("Route %s is mux multi nexthop route, skipping.",
-                        (*rt).prefix.to_string().c_str());
+        const NextHopKey& nextHop = updates[i].nexthop;
+        auto it = m_nextHops.find(nextHop);
 
-            ++rt;
+        if (it == m_nextHops.end())
+        {
+            SWSS_LOG_INFO("No routes found for NH %s", nextHop.ip_address.to_string().c_str());
             continue;
         }
 
-        next_hop_id = m_neighOrch->getNextHopId(nextHop);
-        SWSS_LOG_INFO("Updating route %s with nexthop %" PRIu64, (*rt).prefix.to_string().c_str(), (uint64_t)next_hop_id);
+        sai_object_id_t next_hop_id = m_neighOrch->getNextHopId(nextHop);
+        route_attr.value.oid = next_hop_id;
+        route_attrs.push_back(route_attr);
+
+        for (const auto& rt : it->second)
+        {
+            /* Check if route points to nexthop group and skip */
+            if (route_table != m_syncdRoutes.end())
+            {
+                auto route = route_table->second.find(rt.prefix);
+                if (route != route_table->second.end() && route->second.nhg_key.getSize() > 1)
+                {
+                    /* multiple mux nexthop case:
+                     * skip for now, muxOrch::updateRoute() will handle route
+                     */
+                    SWSS_LOG_INFO("Route %s is mux multi nexthop route, skipping.",
+                                rt.prefix.to_string().c_str());
+                    continue;
+                }
+            }
+
+            SWSS_LOG_INFO("Updating route %s with nexthop %" PRIu64, rt.prefix.to_string().c_str(), (uint64_t)next_hop_id);
 
-        route_entry.vr_id = (*rt).vrf_id;
-        route_entry.switch_id = gSwitchId;
-        copy(route_entry.destination, (*rt).prefix);
+            route_entry.vr_id = rt.vrf_id;
+            route_entry.switch_id = gSwitchId;
+            copy(route_entry.destination, rt.prefix);
 
-        route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-        route_attr.value.oid = next_hop_id;
+            route_entries.push_back(route_entry);
+            route_updates.push_back(i);
+            object_statuses.emplace_back();
+            gNextHopRouteBulker.set_entry_attribute(&object_statuses.back(), &route_entries.back(), &route_attrs.back());
+        }
+    }
 
-        sai_status_t status = sai_route_api->set_route_entry_attribute(&route_entry, &route_attr);
+    if (route_entries.empty())
+    {
+        return true;
+    }
+
+    gNextHopRouteBulker.flush();
+
+    task_process_status failure = task_success;
+    for (size_t i = 0; i < route_entries.size(); i++)
+    {
+        sai_status_t status = object_statuses[i];
         if (status != SAI_STATUS_SUCCESS)
         {
-            SWSS_LOG_ERROR("Failed to update route %s, rv:%d", (*rt).prefix.to_string().c_str(), status);
+            IpPrefix prefix = getIpPrefixFromSaiPrefix(route_entries[i].destination);
+            SWSS_LOG_ERROR("Failed to update route %s, rv:%d", prefix.to_string().c_str(), status);
             task_process_status handle_status = handleSaiSetStatus(SAI_API_ROUTE, status);
             if (handle_status != task_success)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                failure = handle_status;
+                continue;
             }
         }
 
-        ++numRoutes;
-        ++rt;
+        ++updates[route_updates[i]].numRoutes;
     }
 
-    return true;
+    if (failure == task_success)
+    {
+        return true;
+    }
+
+    std::vector<sai_attribute_t> rollback_attrs;
+    std::vector<sai_status_t> rollback_statuses;
+    rollback_attrs.reserve(updates.size());
+    rollback_statuses.reserve(route_entries.size());
+    for (const auto& update : updates)
+    {
+        route_attr.value.oid = update.rollbackNextHopId;
+        rollback_attrs.push_back(route_attr);
+    }
+
+    size_t restored = 0;
+    for (size_t i = 0; i < route_entries.size(); i++)
+    {
+        rollback_statuses.emplace_back(SAI_STATUS_NOT_EXECUTED);
+        const auto& update = updates[route_updates[i]];
+        if (object_statuses[i] == SAI_STATUS_SUCCESS && update.rollbackNextHopId != SAI_NULL_OBJECT_ID)
+        {
+            gNextHopRouteBulker.set_entry_attribute(&rollback_statuses.back(), &route_entries[i], &rollback_attrs[route_updates[i]]);
+            ++restored;
+        }
+    }
+
+    if (!restored)
+    {
+        return parseHandleSaiStatusFailure(failure);
+    }
+
+    SWSS_LOG_NOTICE("Restoring %zu routes to their previous nexthop", restored);
+    gNextHopRouteBulker.flush();
+
+    for (size_t i = 0; i < route_entries.size(); i++)
+    {
+        const auto& update = updates[route_updates[i]];
+        if (object_statuses[i] != SAI_STATUS_SUCCESS || update.rollbackNextHopId == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        if (rollback_statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            --updates[route_updates[i]].numRoutes;
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to restore route %s of NH %s, rv:%d",
+                           getIpPrefixFromSaiPrefix(route_entries[i].destination).to_string().c_str(),
+                           update.nexthop.to_string().c_str(), rollback_statuses[i]);
+        }
+    }
+
+    return parseHandleSaiStatusFailure(failure);
 }
 
 /**
@@ -2543,6 +2817,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
                 // This can happen in dualtor when a tunnel route is removed that matches a learned route
                 // remove the entry from the cache and retry route creation
                 m_syncdRoutes.at(vrf_id).erase(ipPrefix);
+                removeSyncdRouteIndex(vrf_id, ipPrefix);
                 return false;
             }
             SWSS_LOG_ERROR("Failed to set route %s with next hop(s) %s",
@@ -2673,7 +2948,8 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         gFlowCounterRouteOrch->handleRouteAdd(vrf_id, ipPrefix);
     }
 
-    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index, ctx.context_index);
+    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(internNextHopGroupKey(nextHops), ctx.nhg_index, ctx.context_index);
+    addSyncdRouteIndex(vrf_id, ipPrefix);
 
     /* add subnet decap term for VIP route */
     const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
@@ -2948,6 +3224,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
     else
     {
         it_route_table->second.erase(ipPrefix);
+        removeSyncdRouteIndex(vrf_id, ipPrefix);
 
         /* Notify about the route next hop removal */
         notifyNextHopChangeObservers(vrf_id, ipPrefix, NextHopGroupKey(), false);
@@ -14,11 +14,13 @@
 #include "ipprefix.h"
 #include "nexthopgroupkey.h"
 #include "bulker.h"
+#include "prefixtrie.h"
 #include "fgnhgorch.h"
 #include <map>
 #include "zmqorch.h"
 #include "zmqserver.h"
 #include <unordered_map>
+#include <unordered_set>
 
 /* Maximum next hop group number */
 #define NHGRP_MAX_SIZE 128
@@ -106,6 +108,19 @@ struct RouteKey
     }
 };
 
+/* Routes of a nexthop to re-point to its current nexthop id */
+struct NextHopRouteUpdate
+{
+    NextHopKey nexthop;
+    /* nexthop id the routes are restored to if the update fails */
+    sai_object_id_t rollbackNextHopId;
+    /* number of routes left pointing to the new nexthop id */
+    uint32_t numRoutes;
+
+    NextHopRouteUpdate(const NextHopKey& nh, sai_object_id_t rollback = SAI_NULL_OBJECT_ID)
+        : nexthop(nh), rollbackNextHopId(rollback), numRoutes(0) {}
+};
+
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
 typedef std::unordered_map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
 /* RouteTable: destination network, NextHopGroupKey */
@@ -122,6 +137,8 @@ typedef std::pair<sai_object_id_t, IpAddress> Host;
 typedef std::map<Host, NextHopObserverEntry> NextHopObserverTable;
 /* Single Nexthop to Routemap */
 typedef std::map<NextHopKey, std::set<RouteKey>> NextHopRouteTable;
+/* RouteIndexes: vrf_id, longest prefix match index of the RouteTable prefixes */
+typedef std::map<sai_object_id_t, PrefixTrie<bool>> RouteIndexes;
 
 struct NextHopObserverEntry
 {
@@ -129,6 +146,18 @@ struct NextHopObserverEntry
     list<Observer *> observers;
 };
 
+/* NextHopObserverIndexes: vrf_id, index of the observed destination IPs */
+typedef std::map<sai_object_id_t, PrefixTrie<NextHopObserverTable::iterator>> NextHopObserverIndexes;
+
+/* Estimated memory of the route tables */
+struct RouteTableMemoryUsage
+{
+    size_t routes = 0;          // routes in the route tables
+    size_t nextHopSets = 0;     // distinct next hop sets referenced by the routes
+    size_t routeBytes = 0;      // route table nodes and route attributes
+    size_t nextHopBytes = 0;    // next hop sets referenced by the routes
+};
+
 struct RouteBulkContext
 {
     std::deque<sai_status_t>            object_statuses;    // Bulk statuses
@@ -238,7 +267,8 @@ public:
 
     void addNextHopRoute(const NextHopKey&, const RouteKey&);
     void removeNextHopRoute(const NextHopKey&, const RouteKey&);
-    bool updateNextHopRoutes(const NextHopKey&, uint32_t&);
+    bool updateNextHopRoutes(const NextHopKey&, uint32_t&, sai_object_id_t rollbackNextHopId = SAI_NULL_OBJECT_ID);
+    bool updateNextHopRoutes(std::vector<NextHopRouteUpdate>&);
     bool getRoutesForNexthop(std::set<RouteKey>&, const NextHopKey&);
     bool swapnexthopinNextHopGroup(sai_object_id_t next_hop_group_id, sai_object_id_t default_next_hop_id);
 
@@ -267,6 +297,7 @@ public:
     void decreaseNextHopGroupCount();
     bool checkNextHopGroupCount();
     const RouteTables& getSyncdRoutes() const { return m_syncdRoutes; }
+    RouteTableMemoryUsage getRouteTableMemoryUsage() const;
 
 private:
     SwitchOrch *m_switchOrch;
@@ -286,8 +317,12 @@ private:
     unique_ptr<swss::Table> m_stateDefaultRouteTb;
 
     RouteTables m_syncdRoutes;
+    RouteIndexes m_syncdRouteIndexes;
     LabelRouteTables m_syncdLabelRoutes;
     NextHopGroupTable m_syncdNextHopGroups;
+    /* Route next hop keys which are not next hop groups, see internNextHopGroupKey() */
+    std::unordered_set<NextHopGroupKey> m_nextHopGroupKeyPool;
+    size_t m_nextHopGroupKeyPoolPruneSize;
     NextHopRouteTable m_nextHops;
 
     std::set<std::pair<NextHopGroupKey, sai_object_id_t>> m_bulkNhgReducedRefCnt;
@@ -298,11 +333,20 @@ private:
     std::vector<NextHopGroupKey> m_bulkSrv6NhgReducedVec;
 
     NextHopObserverTable m_nextHopObservers;
+    NextHopObserverIndexes m_nextHopObserverIndexes;
 
     EntityBulker<sai_route_api_t>           gRouteBulker;
+    /* Routes re-pointed by updateNextHopRoutes(), apart from route table updates */
+    EntityBulker<sai_route_api_t>           gNextHopRouteBulker;
     EntityBulker<sai_mpls_api_t>            gLabelRouteBulker;
     ObjectBulker<sai_next_hop_group_api_t>  gNextHopGroupMemberBulker;
 
+    NextHopGroupKey internNextHopGroupKey(const NextHopGroupKey& nextHops);
+    void pruneNextHopGroupKeyPool();
+
+    void addSyncdRouteIndex(sai_object_id_t vrf_id, const IpPrefix& ipPrefix);
+    void removeSyncdRouteIndex(sai_object_id_t vrf_id, const IpPrefix& ipPrefix);
+
     void addTempRoute(RouteBulkContext& ctx, const NextHopGroupKey&);
 
     void addTempLabelRoute(LabelRouteBulkContext& ctx, const NextHopGroupKey&);
@@ -0,0 +1,391 @@
+#ifndef SWSS_SYNCMAP_H
+#define SWSS_SYNCMAP_H
+
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <functional>
+#include <unordered_map>
+
+#include "table.h"
+
+/*
+ * Recycles the blocks of single nodes freed by the containers of a SyncMap,
+ * so that the nodes of a key erased by one doTask() pass are reused by the
+ * tasks of the next ones instead of going back to the heap. Blocks are cached
+ * by size, up to SYNCMAP_POOL_MAX_FREE per size.
+ */
+class SyncMapNodePool
+{
+public:
+    SyncMapNodePool() = default;
+    SyncMapNodePool(const SyncMapNodePool&) = delete;
+    SyncMapNodePool& operator=(const SyncMapNodePool&) = delete;
+
+    ~SyncMapNodePool()
+    {
+        for (auto &list : m_lists)
+        {
+            while (list.head)
+            {
+                FreeBlock *block = list.head;
+                list.head = block->next;
+                ::operator delete(block);
+            }
+        }
+    }
+
+    void *allocate(size_t size)
+    {
+        for (auto &list : m_lists)
+        {
+            if (list.size == size && list.head)
+            {
+                FreeBlock *block = list.head;
+                list.head = block->next;
+                list.count--;
+                return block;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    void deallocate(void *p, size_t size)
+    {
+        if (size >= sizeof(FreeBlock))
+        {
+            for (auto &list : m_lists)
+            {
+                // claim an unused size class for a new size
+                if (list.size == 0)
+                {
+                    list.size = size;
+                }
+                if (list.size == size)
+                {
+                    if (list.count >= SYNCMAP_POOL_MAX_FREE)
+                    {
+                        break;
+                    }
+                    auto block = static_cast<FreeBlock *>(p);
+                    block->next = list.head;
+                    list.head = block;
+                    list.count++;
+                    return;
+                }
+            }
+        }
+        ::operator delete(p);
+    }
+
+private:
+    static const size_t SYNCMAP_POOL_MAX_FREE = 16384;
+
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    struct FreeList
+    {
+        size_t size = 0;
+        size_t count = 0;
+        FreeBlock *head = nullptr;
+    };
+
+    // one size class per node type: tasks and index entries
+    std::array<FreeList, 4> m_lists;
+};
+
+template <class T>
+struct SyncMapAllocator
+{
+    typedef T value_type;
+
+    explicit SyncMapAllocator(SyncMapNodePool *pool) : pool(pool) {}
+
+    template <class U>
+    SyncMapAllocator(const SyncMapAllocator<U> &other) : pool(other.pool) {}
+
+    T *allocate(size_t n)
+    {
+        // only single nodes are recycled, bucket arrays come from the heap
+        return static_cast<T *>(n == 1 ? pool->allocate(sizeof(T)) : ::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n)
+    {
+        if (n == 1)
+        {
+            pool->deallocate(p, sizeof(T));
+        }
+        else
+        {
+            ::operator delete(p);
+        }
+    }
+
+    template <class U>
+    bool operator==(const SyncMapAllocator<U> &other) const { return pool == other.pool; }
+
+    template <class U>
+    bool operator!=(const SyncMapAllocator<U> &other) const { return pool != other.pool; }
+
+    SyncMapNodePool *pool;
+};
+
+/*
+ * Pending tasks of a consumer.
+ *
+ * Behaves as std::multimap<std::string, KeyOpFieldsValuesTuple>: tasks are
+ * iterated in key order and tasks of the same key keep their insertion order
+ * (e.g. DEL then SET). The key order is what the doTask(Consumer&) loops of
+ * the orchs iterate on, so the tasks stay in an ordered tree.
+ *
+ * A hash index keyed by the task key holds the slots of the key: its first
+ * task, its first SET task and its number of tasks. Lookups by key (find,
+ * count, equal_range, erase) are served by the index alone, without walking
+ * the tree, and a task of a key already pending is inserted after the last
+ * one of the key in amortized constant time. The index is keyed by pointers
+ * to the key strings held in the tree nodes, so keys are not copied.
+ *
+ * The nodes of both containers come from a SyncMapNodePool, so the steady
+ * churn of tasks does not allocate nodes.
+ */
+class SyncMap
+{
+public:
+    typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple, std::less<std::string>,
+            SyncMapAllocator<std::pair<const std::string, swss::KeyOpFieldsValuesTuple>>> map_type;
+    typedef map_type::key_type key_type;
+    typedef map_type::mapped_type mapped_type;
+    typedef map_type::value_type value_type;
+    typedef map_type::size_type size_type;
+    typedef map_type::difference_type difference_type;
+    typedef map_type::iterator iterator;
+    typedef map_type::const_iterator const_iterator;
+    typedef map_type::reverse_iterator reverse_iterator;
+    typedef map_type::const_reverse_iterator const_reverse_iterator;
+
+    struct KeySlots
+    {
+        // number of pending tasks of the key
+        size_type count;
+        // first pending task of the key, the others follow it
+        iterator first;
+        // first pending SET task of the key, valid if hasSet
+        iterator set;
+        bool hasSet;
+    };
+
+    SyncMap() :
+        m_map(std::less<std::string>(), map_type::allocator_type(&m_pool)),
+        m_index(0, KeyHash(), KeyEqual(), index_type::allocator_type(&m_pool))
+    {
+    }
+
+    // The index holds iterators into the tree, which can't be copied along
+    SyncMap(const SyncMap&) = delete;
+    SyncMap& operator=(const SyncMap&) = delete;
+
+    iterator begin() { return m_map.begin(); }
+    iterator end() { return m_map.end(); }
+    const_iterator begin() const { return m_map.begin(); }
+    const_iterator end() const { return m_map.end(); }
+    const_iterator cbegin() const { return m_map.cbegin(); }
+    const_iterator cend() const { return m_map.cend(); }
+    reverse_iterator rbegin() { return m_map.rbegin(); }
+    reverse_iterator rend() { return m_map.rend(); }
+    const_reverse_iterator rbegin() const { return m_map.rbegin(); }
+    const_reverse_iterator rend() const { return m_map.rend(); }
+
+    bool empty() const { return m_map.empty(); }
+    size_type size() const { return m_map.size(); }
+
+    size_type count(const key_type &key) const
+    {
+        auto it = m_index.find(&key);
+        return it == m_index.end() ? 0 : it->second.count;
+    }
+
+    iterator find(const key_type &key)
+    {
+        auto it = m_index.find(&key);
+        return it == m_index.end() ? m_map.end() : it->second.first;
+    }
+
+    const_iterator find(const key_type &key) const
+    {
+        auto it = m_index.find(&key);
+        return it == m_index.end() ? m_map.end() : const_iterator(it->second.first);
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type &key)
+    {
+        auto it = m_index.find(&key);
+        if (it == m_index.end())
+        {
+            // empty range at the position of the key
+            return m_map.equal_range(key);
+        }
+        return std::make_pair(it->second.first, std::next(it->second.first, static_cast<difference_type>(it->second.count)));
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+    {
+        auto it = m_index.find(&key);
+        if (it == m_index.end())
+        {
+            return m_map.equal_range(key);
+        }
+        const_iterator first = it->second.first;
+        return std::make_pair(first, std::next(first, static_cast<difference_type>(it->second.count)));
+    }
+
+    // Index entry of a key, nullptr if no task is pending for the key
+    KeySlots *slots(const key_type &key)
+    {
+        auto it = m_index.find(&key);
+        return it == m_index.end() ? nullptr : &it->second;
+    }
+
+    iterator emplace(const key_type &key, const mapped_type &task)
+    {
+        auto slot = m_index.find(&key);
+        if (slot == m_index.end())
+        {
+            auto it = m_map.emplace(key, task);
+            m_index.emplace(&it->first, KeySlots{1, it, it, isSet(it)});
+            return it;
+        }
+
+        // the tasks of a key are contiguous, the new one goes right after the last of them
+        auto &slots = slot->second;
+        auto hint = std::next(slots.first, static_cast<difference_type>(slots.count));
+        auto it = m_map.emplace_hint(hint, key, task);
+        slots.count++;
+        if (!slots.hasSet && isSet(it))
+        {
+            slots.set = it;
+            slots.hasSet = true;
+        }
+        return it;
+    }
+
+    iterator insert(const value_type &value)
+    {
+        return emplace(value.first, value.second);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        indexErase(pos);
+        return m_map.erase(pos);
+    }
+
+    iterator erase(iterator pos)
+    {
+        indexErase(pos);
+        return m_map.erase(pos);
+    }
+
+    size_type erase(const key_type &key)
+    {
+        auto slot = m_index.find(&key);
+        if (slot == m_index.end())
+        {
+            return 0;
+        }
+
+        size_type n = slot->second.count;
+        // take the range before dropping the index entry, whose key lives in the first task
+        auto first = slot->second.first;
+        auto last = std::next(first, static_cast<difference_type>(n));
+        m_index.erase(slot);
+        m_map.erase(first, last);
+        return n;
+    }
+
+    void clear()
+    {
+        m_index.clear();
+        m_map.clear();
+    }
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const std::string *key) const
+        {
+            return std::hash<std::string>()(*key);
+        }
+    };
+
+    struct KeyEqual
+    {
+        bool operator()(const std::string *a, const std::string *b) const
+        {
+            return *a == *b;
+        }
+    };
+
+    typedef std::unordered_map<const std::string *, KeySlots, KeyHash, KeyEqual,
+            SyncMapAllocator<std::pair<const std::string * const, KeySlots>>> index_type;
+
+    static bool isSet(const_iterator it)
+    {
+        return kfvOp(it->second) == SET_COMMAND;
+    }
+
+    void indexErase(const_iterator pos)
+    {
+        auto slot = m_index.find(&pos->first);
+        if (slot == m_index.end())
+        {
+            return;
+        }
+
+        auto &slots = slot->second;
+        if (--slots.count == 0)
+        {
+            m_index.erase(slot);
+            return;
+        }
+
+        bool firstErased = const_iterator(slots.first) == pos;
+        if (slots.hasSet && const_iterator(slots.set) == pos)
+        {
+            // look for another SET among the remaining tasks of the key
+            slots.hasSet = false;
+            auto it = slots.first;
+            for (size_type i = 0; i <= slots.count; ++i, ++it)
+            {
+                if (const_iterator(it) != pos && isSet(it))
+                {
+                    slots.set = it;
+                    slots.hasSet = true;
+                    break;
+                }
+            }
+        }
+
+        if (firstErased)
+        {
+            // the index entry is keyed by the key string of the first task, rebind it to the next one
+            KeySlots moved = slots;
+            moved.first = std::next(slots.first);
+            m_index.erase(slot);
+            m_index.emplace(&moved.first->first, moved);
+        }
+    }
+
+    // declared first, so that it outlives the nodes of the containers
+    SyncMapNodePool m_pool;
+    map_type m_map;
+    index_type m_index;
+};
+
+#endif /* SWSS_SYNCMAP_H */
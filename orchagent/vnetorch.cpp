@@ -1807,19 +1807,18 @@ void VNetRouteOrch::attach(Observer* observer, const IpAddress& dstAddr)
     if (insert_result.second)
     {
         /* Find the prefixes that cover the destination IP */
-        for (auto route : syncd_routes_)
+        syncd_route_index_.forEachCovering(dstAddr, [&](const IpPrefix&, VNetRouteTable::iterator& route)
         {
-            if (route.first.isAddressInSubnet(dstAddr))
-            {
-                SWSS_LOG_INFO("Prefix %s covers destination address",
-                    route.first.to_string().c_str());
+            SWSS_LOG_INFO("Prefix %s covers destination address",
+                route->first.to_string().c_str());
 
-                observerEntry->second.routeTable.emplace(
-                    route.first,
-                    route.second
-                );
-            }
-        }
+            observerEntry->second.routeTable.emplace(
+                route->first,
+                route->second
+            );
+        });
+
+        next_hop_observer_index_.insert(IpPrefix(dstAddr.to_string()), observerEntry);
     }
 
     observerEntry->second.observers.push_back(observer);
@@ -1884,48 +1883,56 @@ void VNetRouteOrch::detach(Observer* observer, const IpAddress& dstAddr)
             observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, reinterpret_cast<void*>(&update));
         }
     }
+    next_hop_observer_index_.erase(IpPrefix(dstAddr.to_string()));
     next_hop_observers_.erase(observerEntry);
 }
 
 void VNetRouteOrch::addRoute(const std::string& vnet, const IpPrefix& ipPrefix, const nextHop& nh)
 {
     SWSS_LOG_ENTER();
-    for (auto& next_hop_observer : next_hop_observers_)
+
+    /* Observed destination IPs within the prefix */
+    std::vector<VNetNextHopObserverTable::iterator> observers;
+    next_hop_observer_index_.forEachCovered(ipPrefix, [&observers](const IpPrefix&, VNetNextHopObserverTable::iterator& entry)
     {
-        if (ipPrefix.isAddressInSubnet(next_hop_observer.first))
-        {
-            auto route_insert_result = next_hop_observer.second.routeTable.emplace(ipPrefix, VNetEntry());
+        observers.push_back(entry);
+    });
+
+    for (auto next_hop_observer : observers)
+    {
+        auto route_insert_result = next_hop_observer->second.routeTable.emplace(ipPrefix, VNetEntry());
 
-            auto vnet_result_result = route_insert_result.first->second.emplace(vnet, nh);
-            if (!vnet_result_result.second)
+        auto vnet_result_result = route_insert_result.first->second.emplace(vnet, nh);
+        if (!vnet_result_result.second)
+        {
+            if (vnet_result_result.first->second.ips == nh.ips
+                && vnet_result_result.first->second.ifname == nh.ifname)
             {
-                if (vnet_result_result.first->second.ips == nh.ips
-                    && vnet_result_result.first->second.ifname == nh.ifname)
-                {
-                    continue;
-                }
-                vnet_result_result.first->second = nh;
+                continue;
             }
+            vnet_result_result.first->second = nh;
+        }
 
-            // If the inserted route is the best route. (Table should not be empty. Because we inserted a new entry above)
-            if (route_insert_result.first == --next_hop_observer.second.routeTable.end())
+        // If the inserted route is the best route. (Table should not be empty. Because we inserted a new entry above)
+        if (route_insert_result.first == --next_hop_observer->second.routeTable.end())
+        {
+            VNetNextHopUpdate update =
             {
-                VNetNextHopUpdate update =
-                {
-                    SET_COMMAND,
-                    vnet, // vnet name
-                    next_hop_observer.first, // destination
-                    ipPrefix, // prefix
-                    nh // nexthop
-                };
-                for (auto& observer : next_hop_observer.second.observers)
-                {
-                    observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, reinterpret_cast<void*>(&update));
-                }
+                SET_COMMAND,
+                vnet, // vnet name
+                next_hop_observer->first, // destination
+                ipPrefix, // prefix
+                nh // nexthop
+            };
+            for (auto& observer : next_hop_observer->second.observers)
+            {
+                observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, reinterpret_cast<void*>(&update));
             }
         }
     }
-    syncd_routes_.emplace(ipPrefix, VNetEntry()).first->second[vnet] = nh;
+    auto route = syncd_routes_.emplace(ipPrefix, VNetEntry()).first;
+    route->second[vnet] = nh;
+    syncd_route_index_.insert(ipPrefix, route);
 }
 
 void VNetRouteOrch::delRoute(const IpPrefix& ipPrefix)
@@ -1939,45 +1946,48 @@ void VNetRouteOrch::delRoute(const IpPrefix& ipPrefix)
         assert(false);
         return;
     }
-    auto next_hop_observer = next_hop_observers_.begin();
-    while(next_hop_observer != next_hop_observers_.end())
+    /* Observed destination IPs within the prefix */
+    std::vector<VNetNextHopObserverTable::iterator> observers;
+    next_hop_observer_index_.forEachCovered(ipPrefix, [&observers](const IpPrefix&, VNetNextHopObserverTable::iterator& entry)
+    {
+        observers.push_back(entry);
+    });
+
+    for (auto next_hop_observer : observers)
     {
-        if (ipPrefix.isAddressInSubnet(next_hop_observer->first))
+        auto itr = next_hop_observer->second.routeTable.find(ipPrefix);
+        if ( itr == next_hop_observer->second.routeTable.end())
         {
-            auto itr = next_hop_observer->second.routeTable.find(ipPrefix);
-            if ( itr == next_hop_observer->second.routeTable.end())
-            {
-                SWSS_LOG_ERROR(
-                    "Failed to find any ip(%s) belong to this route(%s).",
-                    next_hop_observer->first.to_string().c_str(),
-                    ipPrefix.to_string().c_str());
-                assert(false);
-                continue;
-            }
-            if (itr->second.empty())
-            {
-                continue;
-            }
-            for (auto& observer : next_hop_observer->second.observers)
-            {
-                VNetNextHopUpdate update = {
-                    DEL_COMMAND,
-                    itr->second.rbegin()->first, // vnet name
-                    next_hop_observer->first, // destination
-                    itr->first, // prefix
-                    itr->second.rbegin()->second // nexthop
-                };
-                observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, reinterpret_cast<void*>(&update));
-            }
-            next_hop_observer->second.routeTable.erase(itr);
-            if (next_hop_observer->second.routeTable.empty())
-            {
-                next_hop_observer = next_hop_observers_.erase(next_hop_observer);
-                continue;
-            }
+            SWSS_LOG_ERROR(
+                "Failed to find any ip(%s) belong to this route(%s).",
+                next_hop_observer->first.to_string().c_str(),
+                ipPrefix.to_string().c_str());
+            assert(false);
+            continue;
+        }
+        if (itr->second.empty())
+        {
+            continue;
+        }
+        for (auto& observer : next_hop_observer->second.observers)
+        {
+            VNetNextHopUpdate update = {
+                DEL_COMMAND,
+                itr->second.rbegin()->first, // vnet name
+                next_hop_observer->first, // destination
+                itr->first, // prefix
+                itr->second.rbegin()->second // nexthop
+            };
+            observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, reinterpret_cast<void*>(&update));
+        }
+        next_hop_observer->second.routeTable.erase(itr);
+        if (next_hop_observer->second.routeTable.empty())
+        {
+            next_hop_observer_index_.erase(IpPrefix(next_hop_observer->first.to_string()));
+            next_hop_observers_.erase(next_hop_observer);
         }
-        next_hop_observer++;
     }
+    syncd_route_index_.erase(ipPrefix);
     syncd_routes_.erase(route_itr);
 }
 
@@ -14,6 +14,7 @@
 #include "producerstatetable.h"
 #include "observer.h"
 #include "nexthopgroupkey.h"
+#include "prefixtrie.h"
 #include "bfdorch.h"
 #include "tunneltermhelper.h"
 
@@ -520,7 +521,9 @@ private:
     handler_map handler_map_;
 
     VNetRouteTable syncd_routes_;
+    PrefixTrie<VNetRouteTable::iterator> syncd_route_index_;
     VNetNextHopObserverTable next_hop_observers_;
+    PrefixTrie<VNetNextHopObserverTable::iterator> next_hop_observer_index_;
     std::map<std::string, VNetNextHopGroupInfoTable> syncd_nexthop_groups_;
     std::map<std::string, VNetTunnelRouteTable> syncd_tunnel_routes_;
     std::map<std::string, bool> vnet_tunnel_route_check_directly_connected;
@@ -20,6 +20,8 @@ extern "C" {
 #include "sai_serialize.h"
 #include "flex_counter_manager.h"
 #include "converter.h"
+#include "rateengine.h"
+#include "flexcounterorch.h"
 
 /* Global variables */
 extern sai_object_id_t gSwitchId;
@@ -1205,9 +1207,13 @@ VxlanTunnelOrch::VxlanTunnelOrch(DBConnector *statedb, DBConnector *db, const st
     m_asic_db = shared_ptr<DBConnector>(new DBConnector("ASIC_DB", 0));
     try
     {
-        string tunnel_rate_script = swss::loadLuaScript(tunnel_rate_plugin);
-        string tunnel_rate_sha = swss::loadRedisScript(m_counter_db.get(), tunnel_rate_script);
-        fv = FieldValueTuple(TUNNEL_PLUGIN_FIELD, tunnel_rate_sha);
+        // Tunnel rates computed in orchagent don't need the plugin
+        if (!isNativeRatesEnabled())
+        {
+            string tunnel_rate_script = swss::loadLuaScript(tunnel_rate_plugin);
+            string tunnel_rate_sha = swss::loadRedisScript(m_counter_db.get(), tunnel_rate_script);
+            fv = FieldValueTuple(TUNNEL_PLUGIN_FIELD, tunnel_rate_sha);
+        }
     }
     catch (const runtime_error &e)
     {
@@ -1253,6 +1259,12 @@ void VxlanTunnelOrch::doTask(SelectableTimer &timer)
 
             m_tunnelNameTable->set("", tunnelNameFvs);
             m_tunnelTypeTable->set("", tunnelTypeFvs);
+
+            auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+            if (flexCounterOrch)
+            {
+                flexCounterOrch->setNativeRatesObject(COUNTERS_TUNNEL_NAME_MAP, it->second, id);
+            }
             auto tunnel_stats = generateTunnelCounterStats();
 
             tunnel_stat_manager->setCounterIdList(it->first, CounterType::TUNNEL,
@@ -1290,6 +1302,12 @@ void VxlanTunnelOrch::removeTunnelFromFlexCounter(sai_object_id_t oid, const str
 
     m_tunnelNameTable->hdel("", name);
     m_tunnelTypeTable->hdel("", sai_oid);
+
+    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+    if (flexCounterOrch)
+    {
+        flexCounterOrch->delNativeRatesObject(COUNTERS_TUNNEL_NAME_MAP, name);
+    }
     tunnel_stat_manager->clearCounterIdList(oid);
     SWSS_LOG_DEBUG("Unregistered tunnel %s to Flex counter", name.c_str());
 }
@@ -16,6 +16,10 @@
 #define CLEAR_BUFFER_POOL_REQUEST "BUFFER_POOL"
 #define CLEAR_HEADROOM_POOL_REQUEST "HEADROOM_POOL"
 
+#define PERIODIC_CLEAR_MODE_FIELD "periodic_clear_mode"
+#define PERIODIC_CLEAR_MODE_ZERO "zero"
+#define PERIODIC_CLEAR_MODE_DELETE "delete"
+
 extern PortsOrch *gPortsOrch;
 extern BufferOrch *gBufferOrch;
 
@@ -105,6 +109,18 @@ void WatermarkOrch::handleWmConfigUpdate(const std::string &key, const std::vect
                 // reset the timer interval when current timer expires
                 m_timerChanged = true;
             }
+            else if (i.first == PERIODIC_CLEAR_MODE_FIELD)
+            {
+                if (i.second == PERIODIC_CLEAR_MODE_DELETE || i.second == PERIODIC_CLEAR_MODE_ZERO)
+                {
+                    m_periodicClearDelete = (i.second == PERIODIC_CLEAR_MODE_DELETE);
+                    SWSS_LOG_NOTICE("Periodic watermarks are cleared in %s mode", i.second.c_str());
+                }
+                else
+                {
+                    SWSS_LOG_WARN("Unsupported periodic clear mode: %s", i.second.c_str());
+                }
+            }
             else
             {
                 SWSS_LOG_WARN("Unsupported key: %s", i.first.c_str());
@@ -256,31 +272,72 @@ void WatermarkOrch::doTask(SelectableTimer &timer)
             m_telemetryTimer->stop();
         }
 
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES",
-                      m_pg_ids);
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES",
-                      m_pg_ids);
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES",
-                      m_unicast_queue_ids);
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES",
-                      m_multicast_queue_ids);
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES",
-                      m_all_queue_ids);
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_BUFFER_POOL_STAT_WATERMARK_BYTES",
-                      gBufferOrch->getBufferPoolNameOidMap());
-        clearSingleWm(m_periodicWatermarkTable.get(),
-                      "SAI_BUFFER_POOL_STAT_XOFF_ROOM_WATERMARK_BYTES",
-                      gBufferOrch->getBufferPoolNameOidMap());
+        if (m_periodicClearDelete)
+        {
+            deletePeriodicWms();
+        }
+        else
+        {
+            clearPeriodicWms();
+        }
         SWSS_LOG_DEBUG("Periodic watermark cleared by timer!");
     }
 }
 
+void WatermarkOrch::clearPeriodicWms()
+{
+    SWSS_LOG_ENTER();
+
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES",
+                  m_pg_ids);
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES",
+                  m_pg_ids);
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES",
+                  m_unicast_queue_ids);
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES",
+                  m_multicast_queue_ids);
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES",
+                  m_all_queue_ids);
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_BUFFER_POOL_STAT_WATERMARK_BYTES",
+                  gBufferOrch->getBufferPoolNameOidMap());
+    clearSingleWm(m_periodicWatermarkTable.get(),
+                  "SAI_BUFFER_POOL_STAT_XOFF_ROOM_WATERMARK_BYTES",
+                  gBufferOrch->getBufferPoolNameOidMap());
+}
+
+void WatermarkOrch::deletePeriodicWms()
+{
+    /* Start a new period by removing the entries of all objects at once rather than zeroing
+     * each watermark. The watermark plugins take the watermarks of an absent entry as 0 */
+    SWSS_LOG_ENTER();
+
+    Table *table = m_periodicWatermarkTable.get();
+    const auto &bufferPools = gBufferOrch->getBufferPoolNameOidMap();
+    SWSS_LOG_DEBUG("delete periodic WMs, for %zu obj ids",
+                   m_pg_ids.size() + m_queue_ids.size() + bufferPools.size());
+
+    table->setBuffered(true);
+    for (const auto *obj_ids: {&m_pg_ids, &m_queue_ids})
+    {
+        for (sai_object_id_t id: *obj_ids)
+        {
+            table->del(sai_serialize_object_id(id));
+        }
+    }
+    for (const auto &it : bufferPools)
+    {
+        table->del(sai_serialize_object_id(it.second.m_saiObjectId));
+    }
+    table->flush();
+    table->setBuffered(false);
+}
+
 void WatermarkOrch::init_pg_ids()
 {
     SWSS_LOG_ENTER();
@@ -305,6 +362,7 @@ void WatermarkOrch::init_queue_ids()
     {
         sai_object_id_t id;
         sai_deserialize_object_id(fv.first, id);
+        m_queue_ids.push_back(id);
         if (fv.second == "SAI_QUEUE_TYPE_UNICAST")
         {
             m_unicast_queue_ids.push_back(id);
@@ -328,10 +386,14 @@ void WatermarkOrch::clearSingleWm(Table *table, string wm_name, vector<sai_objec
 
     vector<FieldValueTuple> vfvt = {{wm_name, "0"}};
 
+    // All objects are written in a single pipeline
+    table->setBuffered(true);
     for (sai_object_id_t id: obj_ids)
     {
         table->set(sai_serialize_object_id(id), vfvt);
     }
+    table->flush();
+    table->setBuffered(false);
 }
 
 void WatermarkOrch::clearSingleWm(Table *table, string wm_name, const object_reference_map &nameOidMap)
@@ -341,8 +403,11 @@ void WatermarkOrch::clearSingleWm(Table *table, string wm_name, const object_ref
 
     vector<FieldValueTuple> fvTuples = {{wm_name, "0"}};
 
+    table->setBuffered(true);
     for (const auto &it : nameOidMap)
     {
         table->set(sai_serialize_object_id(it.second.m_saiObjectId), fvTuples);
     }
+    table->flush();
+    table->setBuffered(false);
 }
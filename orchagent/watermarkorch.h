@@ -36,6 +36,8 @@ public:
 
     void clearSingleWm(swss::Table *table, std::string wm_name, std::vector<sai_object_id_t> &obj_ids);
     void clearSingleWm(swss::Table *table, std::string wm_name, const object_reference_map &nameOidMap);
+    void clearPeriodicWms();
+    void deletePeriodicWms();
 
     std::shared_ptr<swss::Table> getCountersTable(void)
     {
@@ -55,6 +57,8 @@ private:
     */
     uint8_t m_wmStatus = 0;
     bool m_timerChanged = false;
+    // Periodic watermarks are cleared by deleting their entries instead of zeroing each of them
+    bool m_periodicClearDelete = false;
 
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::DBConnector> m_appDb = nullptr;
@@ -69,6 +73,8 @@ private:
     std::vector<sai_object_id_t> m_unicast_queue_ids;
     std::vector<sai_object_id_t> m_multicast_queue_ids;
     std::vector<sai_object_id_t> m_all_queue_ids;
+    // Every queue once, whatever its type
+    std::vector<sai_object_id_t> m_queue_ids;
     std::vector<sai_object_id_t> m_pg_ids;
 };
 
@@ -22,6 +22,8 @@ void ZmqConsumer::drain()
 {
     if (!m_toSync.empty())
         (static_cast<ZmqOrch*>(m_orch))->doTask(*this);
+
+    setPending(!m_toSync.empty());
 }
 
 
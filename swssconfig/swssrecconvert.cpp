@@ -0,0 +1,50 @@
+#include <fstream>
+#include <iostream>
+
+#include "recorder.h"
+
+using namespace std;
+using namespace swss;
+
+void usage()
+{
+	cout << "Usage: swssrecconvert <binary_rec_file> [<text_rec_file>]" << endl;
+	cout << "    Convert a swss.rec or responsepublisher.rec recorded with '-w binary'" << endl;
+	cout << "    to the text format. Output goes to stdout if no output file is given." << endl;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 2 && argc != 3)
+	{
+		usage();
+		exit(EXIT_FAILURE);
+	}
+
+	ifstream in(argv[1], ifstream::in | ifstream::binary);
+	if (!in.is_open())
+	{
+		cerr << "Failed to open " << argv[1] << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	ofstream file;
+	if (argc == 3)
+	{
+		file.open(argv[2], ofstream::out | ofstream::trunc);
+		if (!file.is_open())
+		{
+			cerr << "Failed to open " << argv[2] << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+	ostream &out = argc == 3 ? file : cout;
+
+	if (!Recorder::binaryToText(in, out))
+	{
+		cerr << "Truncated record in " << argv[1] << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	return 0;
+}
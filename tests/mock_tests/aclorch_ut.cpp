@@ -1873,6 +1873,247 @@ namespace aclorch_test
         ASSERT_TRUE(orch->m_aclOrch->removeAclRule(rule->getTableId(), rule->getId()));
     }
 
+    TEST_F(AclOrchTest, AclRuleUpdateInPlace)
+    {
+        string tableId = "acl_table_1";
+        string ruleId = "acl_rule_1";
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+
+        // add acl rule ...
+
+        auto kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|" + ruleId,
+            SET_COMMAND,
+            {
+                { RULE_PRIORITY, "800" },
+                { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                { MATCH_SRC_IP, "1.1.1.1/32" }
+            }
+        }});
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        auto rule = orch->m_aclOrch->getAclRule(tableId, ruleId);
+        ASSERT_NE(rule, nullptr);
+        auto ruleOid = rule->getOid();
+        ASSERT_NE(ruleOid, SAI_NULL_OBJECT_ID);
+
+        // update acl rule, the SAI entry is kept and its attributes are set ...
+
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|" + ruleId,
+            SET_COMMAND,
+            {
+                { RULE_PRIORITY, "900" },
+                { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                { MATCH_SRC_IP, "2.2.2.2/24" },
+                { MATCH_DST_IP, "3.3.3.3/32" }
+            }
+        }});
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_EQ(orch->m_aclOrch->getAclRule(tableId, ruleId), rule);
+        ASSERT_EQ(rule->getOid(), ruleOid);
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_PRIORITY), "900");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP), "2.2.2.2&mask:255.255.255.0");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_DST_IP), "3.3.3.3&mask:255.255.255.255");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION), "SAI_PACKET_ACTION_DROP");
+
+        // delete acl rule and table ...
+
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|" + ruleId,
+            DEL_COMMAND,
+            {}
+        }});
+
+        orch->doAclRuleTask(kvfAclRule);
+        ASSERT_EQ(orch->m_aclOrch->getAclRule(tableId, ruleId), nullptr);
+
+        kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            DEL_COMMAND,
+            {}
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+        ASSERT_EQ(orch->getTableById(tableId), SAI_NULL_OBJECT_ID);
+    }
+
+    sai_acl_api_t *old_sai_acl_api;
+    vector<uint32_t> createdAclEntryPriorities;
+    uint32_t failingAclEntryPriority = 0;
+    bool failAclEntrySet = false;
+
+    // The following functions are used to override SAI API create_acl_entry and set_acl_entry_attribute
+    // to record the order in which the ACL entries are created and to fail some of the requests.
+    sai_status_t createAclEntry(_Out_ sai_object_id_t *acl_entry_id, _In_ sai_object_id_t switch_id,
+                                _In_ uint32_t attr_count, _In_ const sai_attribute_t *attr_list)
+    {
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_ACL_ENTRY_ATTR_PRIORITY)
+            {
+                createdAclEntryPriorities.push_back(attr_list[i].value.u32);
+                if (attr_list[i].value.u32 == failingAclEntryPriority)
+                {
+                    return SAI_STATUS_FAILURE;
+                }
+            }
+        }
+        return old_sai_acl_api->create_acl_entry(acl_entry_id, switch_id, attr_count, attr_list);
+    }
+
+    sai_status_t setAclEntryAttribute(_In_ sai_object_id_t acl_entry_id, _In_ const sai_attribute_t *attr)
+    {
+        if (failAclEntrySet)
+        {
+            return SAI_STATUS_FAILURE;
+        }
+        return old_sai_acl_api->set_acl_entry_attribute(acl_entry_id, attr);
+    }
+
+    TEST_F(AclOrchTest, AclRuleBatchCreation)
+    {
+        string tableId = "acl_table_1";
+
+        // Override SAI API create_acl_entry and set_acl_entry_attribute
+        old_sai_acl_api = sai_acl_api;
+        sai_acl_api_t new_sai_acl_api = *sai_acl_api;
+        sai_acl_api = &new_sai_acl_api;
+        sai_acl_api->create_acl_entry = createAclEntry;
+        sai_acl_api->set_acl_entry_attribute = setAclEntryAttribute;
+        createdAclEntryPriorities.clear();
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+        ASSERT_NE(orch->getTableById(tableId), SAI_NULL_OBJECT_ID);
+
+        Table ruleStateTable(m_state_db.get(), STATE_ACL_RULE_TABLE_NAME);
+        auto ruleStatus = [&](const string &ruleId)
+        {
+            string status;
+            ruleStateTable.hget(tableId + "|" + ruleId, "status", status);
+            return status;
+        };
+
+        auto aclRule = [&](const string &ruleId, const string &priority, const string &srcIp)
+        {
+            return KeyOpFieldsValuesTuple(tableId + "|" + ruleId, SET_COMMAND, {
+                { RULE_PRIORITY, priority },
+                { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                { MATCH_SRC_IP, srcIp }
+            });
+        };
+
+        // add acl rules in one batch, the creation of the rule of priority 250 fails ...
+
+        failingAclEntryPriority = 250;
+
+        auto consumer = unique_ptr<Consumer>(new Consumer(
+            new swss::ConsumerStateTable(m_config_db.get(), CFG_ACL_RULE_TABLE_NAME, 1, 1), orch->m_aclOrch, CFG_ACL_RULE_TABLE_NAME));
+        consumer->addToSync(deque<KeyOpFieldsValuesTuple>({
+            aclRule("acl_rule_1", "100", "1.1.1.1/32"),
+            aclRule("acl_rule_2", "300", "2.2.2.2/32"),
+            aclRule("acl_rule_3", "250", "3.3.3.3/32"),
+            aclRule("acl_rule_4", "200", "4.4.4.4/32")
+        }));
+        static_cast<Orch *>(orch->m_aclOrch)->doTask(*consumer);
+
+        // the rules are created by decreasing priority
+        ASSERT_EQ(createdAclEntryPriorities, vector<uint32_t>({ 300, 250, 200, 100 }));
+
+        for (const auto &ruleId : { "acl_rule_1", "acl_rule_2", "acl_rule_4" })
+        {
+            ASSERT_NE(orch->getAclRule(tableId, ruleId), nullptr);
+            ASSERT_EQ(ruleStatus(ruleId), "Active");
+        }
+
+        // the rule which failed to be created is kept to be retried
+        ASSERT_EQ(orch->getAclRule(tableId, "acl_rule_3"), nullptr);
+        ASSERT_EQ(ruleStatus("acl_rule_3"), "Pending creation");
+        ASSERT_EQ(consumer->m_toSync.size(), 1);
+        ASSERT_EQ(consumer->m_toSync.begin()->first, tableId + "|acl_rule_3");
+
+        // the rule is created once the SAI accepts it ...
+
+        failingAclEntryPriority = 0;
+        createdAclEntryPriorities.clear();
+        static_cast<Orch *>(orch->m_aclOrch)->doTask(*consumer);
+
+        ASSERT_EQ(createdAclEntryPriorities, vector<uint32_t>({ 250 }));
+        ASSERT_NE(orch->getAclRule(tableId, "acl_rule_3"), nullptr);
+        ASSERT_EQ(ruleStatus("acl_rule_3"), "Active");
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        // update acl rule, the rule is created again when its attributes can't be set ...
+
+        failAclEntrySet = true;
+        createdAclEntryPriorities.clear();
+
+        orch->doAclRuleTask(deque<KeyOpFieldsValuesTuple>({ aclRule("acl_rule_1", "150", "5.5.5.5/32") }));
+
+        ASSERT_EQ(createdAclEntryPriorities, vector<uint32_t>({ 150 }));
+        auto rule = orch->getAclRule(tableId, "acl_rule_1");
+        ASSERT_NE(rule, nullptr);
+        ASSERT_NE(rule->getOid(), SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_PRIORITY), "150");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP), "5.5.5.5&mask:255.255.255.255");
+        ASSERT_EQ(ruleStatus("acl_rule_1"), "Active");
+
+        failAclEntrySet = false;
+
+        // delete acl rules and table ...
+
+        for (const auto &ruleId : { "acl_rule_1", "acl_rule_2", "acl_rule_3", "acl_rule_4" })
+        {
+            orch->doAclRuleTask(deque<KeyOpFieldsValuesTuple>({{ tableId + "|" + ruleId, DEL_COMMAND, {} }}));
+            ASSERT_EQ(orch->getAclRule(tableId, ruleId), nullptr);
+        }
+
+        kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            DEL_COMMAND,
+            {}
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+        ASSERT_EQ(orch->getTableById(tableId), SAI_NULL_OBJECT_ID);
+
+        // Restore sai_acl_api.
+        sai_acl_api = old_sai_acl_api;
+    }
+
     TEST_F(AclOrchTest, deleteNonExistingRule)
     {
         string tableId = "acl_table";
@@ -1677,4 +1677,58 @@ namespace buffermgrdyn_test
         VerifyProfileExists("pg_lossless_100000_5m_profile", false);
         VerifyProfileExists("pg_lossless_100000_5m_mtu4096_profile", false);
     }
+
+    TEST(BufferCalculatorTest, MellanoxHeadroomParity)
+    {
+        // Expected results are the ones of buffer_headroom_mellanox.lua for the same inputs,
+        // test_headroomCalculationParity in test_buffer_dynamic.py runs the lua plugin against buffermgrd
+        struct {
+            string asic_name;
+            string cell_size;
+            string mtu;
+            string small_packet_percentage;
+            buffer_headroom_input_t input;
+            string xon;
+            string xoff;
+            string size;
+        } vectors[] = {
+            { "MELLANOX-SPECTRUM-3", "144", "1024", "100", { "100000", "5m", "9100", "", 4, false }, "19456", "108544", "128000" },
+            { "MELLANOX-SPECTRUM-3", "144", "1024", "100", { "400000", "40m", "9100", "", 8, false }, "38912", "265216", "313344" },
+            { "MELLANOX-SPECTRUM-3", "144", "1024", "100", { "25000", "300m", "1500", "", 1, true }, "19456", "52224", "19456" },
+            { "MELLANOX-SPECTRUM-4", "144", "1024", "100", { "800000", "5m", "9100", "", 8, false }, "38912", "256000", "304128" },
+            { "MELLANOX-SPECTRUM-2", "96", "1500", "50", { "12345", "5m", "9100", "", 4, false }, "19456", "17408", "36864" },
+            { "MELLANOX-SPECTRUM-2", "96", "1500", "50", { "100000", "5m", "9100", "1000", 4, false }, "19456", "67584", "87040" }
+        };
+
+        auto calculator = BufferCalculator::create("mellanox");
+        ASSERT_TRUE(calculator != nullptr);
+        ASSERT_TRUE(BufferCalculator::create("barefoot") == nullptr);
+
+        for (auto &v : vectors)
+        {
+            buffer_headroom_params_t params;
+            params.asic_name = v.asic_name;
+            params.asic = {
+                {"cell_size", v.cell_size},
+                {"pipeline_latency", "19"},
+                {"mac_phy_delay", "0.8"},
+                {"peer_response_time", "3.8"}
+            };
+            params.lossless_traffic = {
+                {"mtu", v.mtu},
+                {"small_packet_percentage", v.small_packet_percentage}
+            };
+
+            buffer_headroom_t headroom;
+            ASSERT_TRUE(calculator->calculateHeadroom(params, v.input, headroom));
+            ASSERT_EQ(headroom.xon, v.xon);
+            ASSERT_EQ(headroom.xoff, v.xoff);
+            ASSERT_EQ(headroom.size, v.size);
+            ASSERT_TRUE(headroom.xon_offset.empty());
+
+            // The lua plugin is to be used if the parameters are incomplete
+            params.asic.erase("cell_size");
+            ASSERT_FALSE(calculator->calculateHeadroom(params, v.input, headroom));
+        }
+    }
 }
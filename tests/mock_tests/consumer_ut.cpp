@@ -23,10 +23,19 @@ namespace consumer_test
         {
             std::cout << "TestOrch::doTask " << consumer.m_toSync.size() << std::endl;
             m_notification_count += consumer.m_toSync.size();
-            consumer.m_toSync.clear();
+            if (!m_retry)
+            {
+                consumer.m_toSync.clear();
+            }
+        }
+
+        Consumer *getConsumer(const string &tableName)
+        {
+            return dynamic_cast<Consumer *>(getExecutor(tableName));
         }
 
         long m_notification_count;
+        bool m_retry = false;
     };
 
     struct ConsumerTest : public ::testing::Test
@@ -342,6 +351,117 @@ namespace consumer_test
 
     }
 
+    TEST_F(ConsumerTest, ConsumerAddToSync_Set_Merge_Fields)
+    {
+        // Updated fields move to the end, the last value of a repeated field wins
+        auto entrya = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1a },
+                    { f2, v2a },
+                    { f3, v3a } } });
+
+        auto entryb = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f2, v2b },
+                    { f1, v1a },
+                    { f2, v2a } } });
+
+        kofv_q.push_back(entrya);
+        kofv_q.push_back(entryb);
+        consumer->addToSync(kofv_q);
+        ASSERT_EQ(consumer->m_toSync.count(key), 1);
+
+        exp_kofv = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f3, v3a },
+                    { f1, v1a },
+                    { f2, v2a } } });
+        validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
+        ASSERT_EQ(consumer->m_toSync.count(key), 0);
+    }
+
+    TEST_F(ConsumerTest, ConsumerSyncMap_Index)
+    {
+        auto del = KeyOpFieldsValuesTuple({ key, DEL_COMMAND, { } });
+        auto set = KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f1, v1a } } });
+
+        consumer->addToSync(del);
+        consumer->addToSync(set);
+        ASSERT_EQ(consumer->m_toSync.count(key), 2);
+
+        // Erasing the DEL keeps the pending SET indexed
+        auto it = consumer->m_toSync.find(key);
+        ASSERT_EQ(kfvOp(it->second), DEL_COMMAND);
+        consumer->m_toSync.erase(it);
+        ASSERT_EQ(consumer->m_toSync.count(key), 1);
+
+        auto slots = consumer->m_toSync.slots(key);
+        ASSERT_NE(slots, nullptr);
+        ASSERT_TRUE(slots->hasSet);
+        ASSERT_EQ(kfvOp(slots->set->second), SET_COMMAND);
+
+        // A following SET is merged into the indexed one
+        consumer->addToSync(KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f2, v2a } } }));
+        exp_kofv = KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f1, v1a }, { f2, v2a } } });
+        validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
+        ASSERT_EQ(consumer->m_toSync.slots(key), nullptr);
+    }
+
+    TEST_F(ConsumerTest, ConsumerSyncMap_KeyOrder)
+    {
+        SyncMap sync;
+        auto task = [](const string &k, const string &op, const string &value)
+        {
+            return KeyOpFieldsValuesTuple({ k, op, { { "f", value } } });
+        };
+
+        // Tasks emplaced directly by the orchs are kept in key order, then in insertion order
+        sync.emplace("b", task("b", SET_COMMAND, "1"));
+        sync.emplace("a", task("a", SET_COMMAND, "1"));
+        sync.emplace("b", task("b", DEL_COMMAND, "2"));
+        sync.emplace("c", task("c", DEL_COMMAND, "1"));
+        sync.emplace("b", task("b", SET_COMMAND, "3"));
+
+        vector<string> order;
+        for (const auto &t : sync)
+        {
+            order.push_back(t.first + ":" + fvValue(kfvFieldsValues(t.second)[0]));
+        }
+        ASSERT_EQ(order, vector<string>({ "a:1", "b:1", "b:2", "b:3", "c:1" }));
+
+        auto range = sync.equal_range("b");
+        ASSERT_EQ(distance(range.first, range.second), 3);
+        ASSERT_EQ(range.first, sync.find("b"));
+        ASSERT_EQ(range.second, sync.find("c"));
+
+        // Erasing the first SET of the key moves the index to the remaining tasks
+        sync.erase(sync.find("b"));
+        ASSERT_EQ(sync.count("b"), 2);
+        ASSERT_EQ(kfvOp(sync.find("b")->second), DEL_COMMAND);
+        auto slots = sync.slots("b");
+        ASSERT_NE(slots, nullptr);
+        ASSERT_TRUE(slots->hasSet);
+        ASSERT_EQ(fvValue(kfvFieldsValues(slots->set->second)[0]), "3");
+
+        // A task of a pending key goes after its last task
+        sync.emplace("b", task("b", DEL_COMMAND, "4"));
+        range = sync.equal_range("b");
+        ASSERT_EQ(fvValue(kfvFieldsValues(prev(range.second)->second)[0]), "4");
+
+        ASSERT_EQ(sync.erase("b"), 3);
+        ASSERT_EQ(sync.count("b"), 0);
+        ASSERT_EQ(sync.find("b"), sync.end());
+        ASSERT_EQ(sync.size(), 2);
+
+        // The range of a key which is not pending is empty
+        range = sync.equal_range("b");
+        ASSERT_EQ(range.first, range.second);
+        ASSERT_EQ(range.first, sync.find("c"));
+    }
+
     TEST_F(ConsumerTest, ConsumerPops_notification_count)
     {
         int consumer_pops_batch_size = 10;
@@ -368,4 +488,39 @@ namespace consumer_test
         test_consumer.execute();
         ASSERT_EQ(test_orch.m_notification_count, consumer_pops_batch_size*2);
     }
+
+    TEST_F(ConsumerTest, ConsumerPendingSweep)
+    {
+        TestOrch test_orch(m_config_db.get(), "CFG_TEST_TABLE");
+        auto test_consumer = test_orch.getConsumer("CFG_TEST_TABLE");
+        ASSERT_NE(test_consumer, nullptr);
+
+        // Nothing pending, the sweep does not call doTask(Consumer&)
+        EXPECT_FALSE(test_orch.hasPendingTasks());
+        static_cast<Orch &>(test_orch).doTask();
+        EXPECT_EQ(test_orch.m_notification_count, 0);
+
+        auto entry = KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f1, v1a } } });
+        test_consumer->addToSync(entry);
+        EXPECT_TRUE(test_consumer->isPending());
+        EXPECT_TRUE(test_orch.hasPendingTasks());
+
+        // Tasks left behind keep the consumer pending
+        test_orch.m_retry = true;
+        static_cast<Orch &>(test_orch).doTask();
+        EXPECT_EQ(test_orch.m_notification_count, 1);
+        EXPECT_TRUE(test_orch.hasPendingTasks());
+
+        test_orch.m_retry = false;
+        static_cast<Orch &>(test_orch).doTask();
+        EXPECT_EQ(test_orch.m_notification_count, 2);
+        EXPECT_FALSE(test_consumer->isPending());
+        EXPECT_FALSE(test_orch.hasPendingTasks());
+
+        // A consumer not owned by the orch is never tracked
+        Consumer other_consumer(
+                new swss::ConsumerStateTable(m_config_db.get(), "CFG_TEST_TABLE", 1, 1), &test_orch, "CFG_TEST_TABLE");
+        other_consumer.addToSync(entry);
+        EXPECT_FALSE(test_orch.hasPendingTasks());
+    }
 }
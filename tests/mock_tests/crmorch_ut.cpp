@@ -0,0 +1,171 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#include "crmorch.h"
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+extern sai_acl_api_t *sai_acl_api;
+extern sai_switch_api_t *sai_switch_api;
+
+namespace crmorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const int NUM_ACL_TABLES = 1000;
+    static const uint32_t ACL_ENTRY_AVAILABLE = 1000;
+
+    sai_acl_api_t ut_sai_acl_api;
+    sai_acl_api_t *pold_sai_acl_api;
+    uint32_t _sai_get_acl_table_attribute_count;
+
+    sai_switch_api_t ut_sai_switch_api;
+    sai_switch_api_t *pold_sai_switch_api;
+    uint32_t _sai_get_available_acl_table_count;
+
+    sai_status_t _ut_stub_sai_get_switch_attribute(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        if (attr_count == 1 && attr_list[0].id == SAI_SWITCH_ATTR_AVAILABLE_ACL_TABLE)
+        {
+            _sai_get_available_acl_table_count++;
+            attr_list[0].value.aclresource.count = 1;
+            attr_list[0].value.aclresource.list[0].stage = SAI_ACL_STAGE_INGRESS;
+            attr_list[0].value.aclresource.list[0].bind_point = SAI_ACL_BIND_POINT_TYPE_PORT;
+            attr_list[0].value.aclresource.list[0].avail_num = ACL_ENTRY_AVAILABLE;
+            return SAI_STATUS_SUCCESS;
+        }
+        return pold_sai_switch_api->get_switch_attribute(switch_id, attr_count, attr_list);
+    }
+
+    sai_status_t _ut_stub_sai_get_acl_table_attribute(
+        _In_ sai_object_id_t acl_table_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        _sai_get_acl_table_attribute_count++;
+        attr_list[0].value.u32 = ACL_ENTRY_AVAILABLE;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    class CrmOrchTest : public MockOrchTest
+    {
+    protected:
+        void ApplySaiMock()
+        {
+            ut_sai_acl_api = *sai_acl_api;
+            pold_sai_acl_api = sai_acl_api;
+            ut_sai_acl_api.get_acl_table_attribute = _ut_stub_sai_get_acl_table_attribute;
+            sai_acl_api = &ut_sai_acl_api;
+
+            ut_sai_switch_api = *sai_switch_api;
+            pold_sai_switch_api = sai_switch_api;
+            ut_sai_switch_api.get_switch_attribute = _ut_stub_sai_get_switch_attribute;
+            sai_switch_api = &ut_sai_switch_api;
+        }
+
+        void PreTearDown()
+        {
+            sai_acl_api = pold_sai_acl_api;
+            sai_switch_api = pold_sai_switch_api;
+        }
+
+        sai_object_id_t aclTableId(int i)
+        {
+            return static_cast<sai_object_id_t>(0x7000000000000 + i);
+        }
+
+        string usedAclEntries(int i)
+        {
+            Table crm_table(m_counters_db.get(), COUNTERS_CRM_TABLE);
+            string value;
+            crm_table.hget(gCrmOrch->getCrmAclTableKey(aclTableId(i)), "crm_stats_acl_entry_used", value);
+            return value;
+        }
+
+        void poll()
+        {
+            _sai_get_acl_table_attribute_count = 0;
+            _sai_get_available_acl_table_count = 0;
+            gCrmOrch->doTask(*gCrmOrch->m_timer);
+        }
+
+        shared_ptr<DBConnector> m_counters_db = make_shared<DBConnector>("COUNTERS_DB", 0);
+    };
+
+    TEST_F(CrmOrchTest, IncrementalPolling)
+    {
+        for (int i = 0; i < NUM_ACL_TABLES; i++)
+        {
+            gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, aclTableId(i));
+        }
+
+        const auto &aclEntryCounters = gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap;
+        ASSERT_GE(aclEntryCounters.size(), (size_t)NUM_ACL_TABLES);
+
+        gCrmOrch->handleSetCommand("Config", { { "incremental_polling", "true" } });
+        ASSERT_TRUE(gCrmOrch->m_incrementalPolling);
+
+        // The first poll queries every ACL table
+        poll();
+        ASSERT_EQ(_sai_get_acl_table_attribute_count, aclEntryCounters.size());
+        ASSERT_EQ(usedAclEntries(0), "1");
+
+        // Nothing changed, no ACL table is queried. The switch wide resources still are,
+        // their hardware is shared with other resources
+        poll();
+        ASSERT_FALSE(gCrmOrch->m_fullSweep);
+        ASSERT_EQ(_sai_get_acl_table_attribute_count, 0u);
+        ASSERT_EQ(_sai_get_available_acl_table_count, 1u);
+
+        // Only the ACL table with a new entry is queried and published
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, aclTableId(1));
+        poll();
+        ASSERT_EQ(_sai_get_acl_table_attribute_count, 1u);
+        ASSERT_EQ(usedAclEntries(1), "2");
+        ASSERT_EQ(usedAclEntries(0), "1");
+
+        // A threshold change re-evaluates the counters of the resource
+        auto &cnt = gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap.at(gCrmOrch->getCrmAclTableKey(aclTableId(0)));
+        ASSERT_FALSE(cnt.checkPending);
+        gCrmOrch->handleSetCommand("Config", { { "acl_entry_threshold_type", "used" },
+                                               { "acl_entry_low_threshold", "0" },
+                                               { "acl_entry_high_threshold", "1" } });
+        ASSERT_TRUE(cnt.checkPending);
+        poll();
+        ASSERT_FALSE(cnt.checkPending);
+        ASSERT_EQ(cnt.exceededLogCounter, 1u);
+
+        // Unchanged ACL tables are queried and published again on the next full sweep
+        Table crm_table(m_counters_db.get(), COUNTERS_CRM_TABLE);
+        crm_table.del(gCrmOrch->getCrmAclTableKey(aclTableId(0)));
+        for (int polls = 0; polls < 100; polls++)
+        {
+            poll();
+            if (gCrmOrch->m_fullSweep)
+            {
+                break;
+            }
+            ASSERT_EQ(_sai_get_acl_table_attribute_count, 0u);
+        }
+        ASSERT_TRUE(gCrmOrch->m_fullSweep);
+        ASSERT_EQ(_sai_get_acl_table_attribute_count, aclEntryCounters.size());
+        ASSERT_EQ(usedAclEntries(0), "1");
+
+        // Without incremental polling every ACL table is queried on each poll
+        gCrmOrch->handleSetCommand("Config", { { "incremental_polling", "false" } });
+        poll();
+        ASSERT_EQ(_sai_get_acl_table_attribute_count, aclEntryCounters.size());
+    }
+}
@@ -197,6 +197,40 @@ namespace fdb_syncd_flush_test
         m_portsOrch->m_portList[VLAN40].m_members.insert(VXLAN_REMOTE);
     }
 
+    vector<string> setUpVlanMembers(PortsOrch* m_portsOrch, int num_ports){
+        /* Updates portsOrch internal cache for Ethernet0..N as members of Vlan40 */
+        vector<string> aliases;
+        for (int i = 0; i < num_ports; i++)
+        {
+            string alias = "Ethernet" + to_string(i * 4);
+            Port port(alias, Port::PHY);
+            port.m_index = i + 1;
+            port.m_port_id = 0x10000000004a4 + i;
+            port.m_bridge_port_id = 0x3a000000002c33 + i;
+
+            m_portsOrch->m_portList[alias] = port;
+            m_portsOrch->saiOidToAlias[port.m_port_id] = alias;
+            m_portsOrch->saiOidToAlias[port.m_bridge_port_id] = alias;
+            m_portsOrch->m_portList[VLAN40].m_members.insert(alias);
+            aliases.push_back(alias);
+        }
+        return aliases;
+    }
+
+    /* Counts the FDB changes notified to the observers of FdbOrch */
+    struct FdbChangeCounter : public Observer
+    {
+        size_t changes = 0;
+
+        void update(SubjectType type, void *cntx) override
+        {
+            if (type == SUBJECT_TYPE_FDB_CHANGE)
+            {
+                changes++;
+            }
+        }
+    };
+
     void triggerUpdate(FdbOrch* m_fdborch,
                        sai_fdb_event_t type,
                        vector<uint8_t> mac_addr,
@@ -548,4 +582,158 @@ namespace fdb_syncd_flush_test
         ASSERT_EQ(m_portsOrch->m_portList[VXLAN_REMOTE].m_fdb_count, 1);
         _unhook_sai_fdb_api();
     }
+
+    /* Test Flush per Port and per Vlan at scale only touches the entries of the port or vlan */
+    TEST_F(FdbOrchTest, ScaleFlushPortAndVlan)
+    {
+        const int num_ports = 4;
+        const int macs_per_port = 2500;
+
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        sai_object_id_t vlan_oid = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+
+        vector<string> aliases = setUpVlanMembers(m_portsOrch.get(), num_ports);
+
+        /* Event 1: Learn dynamic FDB Entries on every port */
+        for (int i = 0; i < num_ports; i++)
+        {
+            for (int j = 0; j < macs_per_port; j++)
+            {
+                vector<uint8_t> mac_addr = {0x7c, 0xfe, 0x90, static_cast<uint8_t>(i), static_cast<uint8_t>(j >> 8), static_cast<uint8_t>(j)};
+                triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac_addr, m_portsOrch->m_portList[aliases[i]].m_bridge_port_id, vlan_oid);
+            }
+        }
+
+        ASSERT_EQ(m_fdborch->m_entries.size(), (size_t)(num_ports * macs_per_port));
+        ASSERT_EQ(m_fdborch->m_entriesByBridgePort.size(), (size_t)num_ports);
+        ASSERT_EQ(m_fdborch->m_entriesByBvId.at(vlan_oid).size(), (size_t)(num_ports * macs_per_port));
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, num_ports * macs_per_port);
+
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        {
+            it->second.is_flush_pending = true;
+        }
+
+        /* Event 2: Generate a FDB Flush per port, only the entries of the port are removed */
+        vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, flush_mac_addr, m_portsOrch->m_portList[aliases[0]].m_bridge_port_id,
+                      SAI_NULL_OBJECT_ID);
+
+        ASSERT_EQ(m_portsOrch->m_portList[aliases[0]].m_fdb_count, 0);
+        for (int i = 1; i < num_ports; i++)
+        {
+            ASSERT_EQ(m_portsOrch->m_portList[aliases[i]].m_fdb_count, macs_per_port);
+        }
+        ASSERT_EQ(m_fdborch->m_entries.size(), (size_t)((num_ports - 1) * macs_per_port));
+        ASSERT_EQ(m_fdborch->m_entriesByBridgePort.count(m_portsOrch->m_portList[aliases[0]].m_bridge_port_id), 0);
+        ASSERT_EQ(m_fdborch->m_entriesByBvId.at(vlan_oid).size(), (size_t)((num_ports - 1) * macs_per_port));
+
+        /* Event 3: Generate a FDB Flush per port and per vlan */
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, flush_mac_addr, m_portsOrch->m_portList[aliases[1]].m_bridge_port_id,
+                      vlan_oid);
+
+        ASSERT_EQ(m_portsOrch->m_portList[aliases[1]].m_fdb_count, 0);
+        ASSERT_EQ(m_fdborch->m_entries.size(), (size_t)((num_ports - 2) * macs_per_port));
+
+        /* Event 4: Generate a FDB Flush per vlan */
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, flush_mac_addr, SAI_NULL_OBJECT_ID, vlan_oid);
+
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 0);
+        ASSERT_TRUE(m_fdborch->m_entries.empty());
+        ASSERT_TRUE(m_fdborch->m_entriesByBridgePort.empty());
+        ASSERT_TRUE(m_fdborch->m_entriesByBvId.empty());
+    }
+
+    /* Test a MAC move storm is coalesced per MAC within a batch of FDB notifications */
+    TEST_F(FdbOrchTest, BatchedMacMoveStorm)
+    {
+        const int num_ports = 3;
+        const int num_macs = 2000;
+
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        sai_object_id_t vlan_oid = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+
+        vector<sai_object_id_t> bridge_ports;
+        for (const auto &alias : setUpVlanMembers(m_portsOrch.get(), num_ports))
+        {
+            bridge_ports.push_back(m_portsOrch->m_portList[alias].m_bridge_port_id);
+        }
+
+        FdbChangeCounter observer;
+        m_fdborch->attach(&observer);
+
+        auto fdbEntry = [&](uint8_t prefix, int i) {
+            sai_fdb_entry_t entry;
+            vector<uint8_t> mac_addr = {0x7c, 0xfe, prefix, 0, static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i)};
+            memcpy(entry.mac_address, mac_addr.data(), sizeof(sai_mac_t));
+            entry.switch_id = gSwitchId;
+            entry.bv_id = vlan_oid;
+            return entry;
+        };
+
+        /* Event 1: Learn then move every MAC across the ports one event at a time */
+        for (int i = 0; i < num_macs; i++)
+        {
+            auto entry = fdbEntry(0x90, i);
+            m_fdborch->update(SAI_FDB_EVENT_LEARNED, &entry, bridge_ports[0], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+            m_fdborch->update(SAI_FDB_EVENT_MOVE, &entry, bridge_ports[1], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+            m_fdborch->update(SAI_FDB_EVENT_MOVE, &entry, bridge_ports[2], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+        }
+
+        /* Each event is written to STATE_DB and notified on its own */
+        ASSERT_EQ(observer.changes, (size_t)(3 * num_macs));
+
+        /* Event 2: Same storm on other MACs as one batch of notifications */
+        observer.changes = 0;
+        m_fdborch->m_fdbEventBatch = true;
+        for (int i = 0; i < num_macs; i++)
+        {
+            auto entry = fdbEntry(0x91, i);
+            m_fdborch->queueFdbEvent(SAI_FDB_EVENT_LEARNED, entry, bridge_ports[0], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+            m_fdborch->queueFdbEvent(SAI_FDB_EVENT_MOVE, entry, bridge_ports[1], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+            m_fdborch->queueFdbEvent(SAI_FDB_EVENT_MOVE, entry, bridge_ports[2], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+        }
+        ASSERT_EQ(m_fdborch->m_fdbEvents.size(), (size_t)num_macs);
+        m_fdborch->processFdbEvents();
+
+        /* The three events of a MAC are coalesced into one STATE_DB write and one notification */
+        ASSERT_EQ(m_fdborch->m_fdbStateWrites.size(), (size_t)num_macs);
+        ASSERT_EQ(m_fdborch->m_fdbUpdates.size(), (size_t)num_macs);
+        ASSERT_EQ(observer.changes, 0u);
+        m_fdborch->flushFdbEventBatch();
+        ASSERT_EQ(observer.changes, (size_t)num_macs);
+
+        /* Both storms end with every MAC on the last port */
+        ASSERT_EQ(m_portsOrch->m_portList["Ethernet0"].m_fdb_count, 0);
+        ASSERT_EQ(m_portsOrch->m_portList["Ethernet4"].m_fdb_count, 0);
+        ASSERT_EQ(m_portsOrch->m_portList["Ethernet8"].m_fdb_count, 2 * num_macs);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 2 * num_macs);
+        ASSERT_EQ(m_fdborch->m_entriesByBridgePort.at(bridge_ports[2]).size(), (size_t)(2 * num_macs));
+        ASSERT_TRUE(m_fdborch->m_fdbUpdates.empty());
+        ASSERT_TRUE(m_fdborch->m_fdbStateWrites.empty());
+
+        string port;
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:7c:fe:90:00:00:01", "port", port), true);
+        ASSERT_EQ(port, "Ethernet8");
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:7c:fe:91:00:00:01", "port", port), true);
+        ASSERT_EQ(port, "Ethernet8");
+
+        /* Event 3: A learn and an age of the same MAC in one batch leaves nothing behind */
+        m_fdborch->m_fdbEventBatch = true;
+        auto entry = fdbEntry(0x92, 0);
+        m_fdborch->queueFdbEvent(SAI_FDB_EVENT_LEARNED, entry, bridge_ports[0], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+        m_fdborch->queueFdbEvent(SAI_FDB_EVENT_AGED, entry, bridge_ports[0], SAI_FDB_ENTRY_TYPE_DYNAMIC);
+        observer.changes = 0;
+        m_fdborch->processFdbEvents();
+        m_fdborch->flushFdbEventBatch();
+
+        ASSERT_EQ(observer.changes, 0u);
+        ASSERT_EQ(m_portsOrch->m_portList["Ethernet0"].m_fdb_count, 0);
+        ASSERT_EQ(m_fdborch->m_entries.size(), (size_t)(2 * num_macs));
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:7c:fe:92:00:00:00", "port", port), false);
+
+        m_fdborch->detach(&observer);
+    }
 }
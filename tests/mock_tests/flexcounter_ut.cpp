@@ -695,6 +695,26 @@ namespace flexcounter_test
         Port firstPort;
         gPortsOrch->getPort(firstPortName, firstPort);
         auto pgOid = firstPort.m_priority_group_ids[3];
+
+        // The maps of all ports are written to the counters database
+        string mapValue;
+        string mapOid;
+        Table portNameMap = Table(m_counters_db.get(), COUNTERS_PORT_NAME_MAP);
+        Table queueNameMap = Table(m_counters_db.get(), COUNTERS_QUEUE_NAME_MAP);
+        Table queuePortMap = Table(m_counters_db.get(), COUNTERS_QUEUE_PORT_MAP);
+        Table pgNameMap = Table(m_counters_db.get(), COUNTERS_PG_NAME_MAP);
+        Table pgIndexMap = Table(m_counters_db.get(), COUNTERS_PG_INDEX_MAP);
+        ASSERT_TRUE(portNameMap.hget("", firstPortName, mapValue));
+        ASSERT_EQ(mapValue, sai_serialize_object_id(firstPort.m_port_id));
+        ASSERT_TRUE(queueNameMap.hget("", firstPortName + ":3", mapOid));
+        ASSERT_EQ(mapOid, sai_serialize_object_id(firstPort.m_queue_ids[3]));
+        ASSERT_TRUE(queuePortMap.hget("", mapOid, mapValue));
+        ASSERT_EQ(mapValue, sai_serialize_object_id(firstPort.m_port_id));
+        ASSERT_TRUE(pgNameMap.hget("", firstPortName + ":3", mapOid));
+        ASSERT_EQ(mapOid, sai_serialize_object_id(pgOid));
+        ASSERT_TRUE(pgIndexMap.hget("", mapOid, mapValue));
+        ASSERT_EQ(mapValue, "3");
+
         ASSERT_TRUE(checkFlexCounter(SWITCH_STAT_COUNTER_FLEX_COUNTER_GROUP, gSwitchId,
                                      {
                                          {SWITCH_COUNTER_ID_LIST,
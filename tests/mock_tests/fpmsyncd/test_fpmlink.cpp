@@ -69,3 +69,21 @@ TEST_F(FpmLinkTest, TwoNlMessagesInFpmMessage)
     m_fpm.processFpmMessage(reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(fpmMsgBuffer)));
 }
 
+
+TEST_F(FpmLinkTest, HighThroughputModeSkipsLibnl)
+{
+    // Same message as SingleNlMessageInFpmMessage, parsed in place by RouteSync
+    alignas(fpm_msg_hdr_t) unsigned char fpmMsgBuffer[] = {
+        0x01, 0x01, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE0,
+        0x12, 0x6F, 0xC4, 0x02, 0x18, 0x00, 0x00, 0xFE, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x08, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05,
+        0x00, 0xAC, 0x1E, 0x38, 0xA6, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00
+    };
+
+    m_fpm.setHighThroughputMode(true);
+    EXPECT_TRUE(m_fpm.isHighThroughputMode());
+
+    EXPECT_CALL(m_mock, onMsg(_, _)).Times(0);
+
+    m_fpm.processFpmMessage(reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(fpmMsgBuffer)));
+}
@@ -1252,3 +1252,145 @@ TEST_F(WarmRestartRouteSyncTest, TestRouteDeleteHandlingWarmRestartInProgress)
     EXPECT_TRUE(routeTable.get("192.168.12.0/24", result));
 
 }
+
+// Routes parsed straight from the netlink message are written as through libnl
+TEST_F(WarmRestartRouteSyncTest, TestRouteMsgDirectMatchesLibnl)
+{
+    Table routeTable(m_db.get(), APP_ROUTE_TABLE_NAME);
+
+    auto checkRoute = [&](rtnl_route *route, const string &key) {
+        nl_msg *msg = nullptr;
+        ASSERT_EQ(rtnl_route_build_add_request(route, NLM_F_CREATE, &msg), 0);
+        auto nlMsg = unique_ptr<nl_msg, decltype(nlmsg_free)*>(msg, nlmsg_free);
+
+        m_testRouteSync.onMsg(RTM_NEWROUTE, (struct nl_object*)route);
+        vector<FieldValueTuple> expected;
+        ASSERT_TRUE(routeTable.get(key, expected));
+
+        testing_db::reset();
+
+        EXPECT_TRUE(m_testRouteSync.onRouteMsgDirect(nlmsg_hdr(nlMsg.get())));
+        vector<FieldValueTuple> actual;
+        ASSERT_TRUE(routeTable.get(key, actual));
+        EXPECT_EQ(actual, expected);
+    };
+
+    // ECMP route with weights in the default VRF
+    {
+        auto route = create_route("10.10.0.0/16");
+        rtnl_route_set_table(route.get(), RT_TABLE_UNSPEC);
+        rtnl_route_set_protocol(route.get(), RTPROT_BGP);
+        rtnl_nexthop *nh1 = create_nexthop("192.168.1.1");
+        rtnl_route_nh_set_weight(nh1, 3);
+        rtnl_route_add_nexthop(route.get(), nh1);
+        rtnl_route_add_nexthop(route.get(), create_nexthop("192.168.1.2"));
+        checkRoute(route.get(), "10.10.0.0/16");
+    }
+
+    // Single next hop IPv6 route in a VRF
+    {
+        rtnl_route *route = rtnl_route_alloc();
+        nl_addr *dst;
+        nl_addr_parse("2001:db8::/64", AF_INET6, &dst);
+        rtnl_route_set_dst(route, dst);
+        nl_addr_put(dst);
+        rtnl_route_set_type(route, RTN_UNICAST);
+        rtnl_route_set_protocol(route, RTPROT_STATIC);
+        rtnl_route_set_family(route, AF_INET6);
+        rtnl_route_set_scope(route, RT_SCOPE_UNIVERSE);
+        rtnl_route_set_table(route, 10);
+
+        rtnl_nexthop *nh = rtnl_route_nh_alloc();
+        nl_addr *gw;
+        nl_addr_parse("fc00::1", AF_INET6, &gw);
+        rtnl_route_nh_set_gateway(nh, gw);
+        nl_addr_put(gw);
+        rtnl_route_nh_set_ifindex(nh, 5);
+        rtnl_route_add_nexthop(route, nh);
+
+        checkRoute(route, "Vrf10:2001:db8::/64");
+        rtnl_route_put(route);
+    }
+
+    // Blackhole route, then its removal
+    {
+        auto route = create_route("10.20.0.0/16");
+        rtnl_route_set_table(route.get(), RT_TABLE_UNSPEC);
+        rtnl_route_set_type(route.get(), RTN_BLACKHOLE);
+        checkRoute(route.get(), "10.20.0.0/16");
+
+        nl_msg *msg = nullptr;
+        ASSERT_EQ(rtnl_route_build_del_request(route.get(), 0, &msg), 0);
+        auto nlMsg = unique_ptr<nl_msg, decltype(nlmsg_free)*>(msg, nlmsg_free);
+
+        EXPECT_TRUE(m_testRouteSync.onRouteMsgDirect(nlmsg_hdr(nlMsg.get())));
+        vector<FieldValueTuple> result;
+        EXPECT_FALSE(routeTable.get("10.20.0.0/16", result));
+    }
+
+    // Label routes are left to libnl
+    {
+        auto route = create_route("10.30.0.0/16");
+        nl_msg *msg = nullptr;
+        ASSERT_EQ(rtnl_route_build_add_request(route.get(), NLM_F_CREATE, &msg), 0);
+        auto nlMsg = unique_ptr<nl_msg, decltype(nlmsg_free)*>(msg, nlmsg_free);
+
+        rtmsg *rtm = static_cast<rtmsg*>(NLMSG_DATA(nlmsg_hdr(nlMsg.get())));
+        rtm->rtm_family = AF_MPLS;
+        EXPECT_FALSE(m_testRouteSync.onRouteMsgDirect(nlmsg_hdr(nlMsg.get())));
+    }
+}
+
+TEST_F(WarmRestartRouteSyncTest, TestRouteCoalescing)
+{
+    Table routeTable(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<FieldValueTuple> result;
+
+    m_testRouteSync.setCoalesceWindow(60000);
+
+    auto route = create_route("192.168.20.0/24");
+    rtnl_route_set_type(route.get(), RTN_BLACKHOLE);
+    rtnl_route_set_protocol(route.get(), RTPROT_BGP);
+
+    // Flap: ADD, DEL, ADD with another protocol
+    m_testRouteSync.onRouteMsg(RTM_NEWROUTE, (struct nl_object*)route.get(), nullptr);
+    m_testRouteSync.onRouteMsg(RTM_DELROUTE, (struct nl_object*)route.get(), nullptr);
+    rtnl_route_set_protocol(route.get(), RTPROT_STATIC);
+    m_testRouteSync.onRouteMsg(RTM_NEWROUTE, (struct nl_object*)route.get(), nullptr);
+
+    // ADD then DEL of another route
+    auto route2 = create_route("192.168.21.0/24");
+    rtnl_route_set_type(route2.get(), RTN_BLACKHOLE);
+    m_testRouteSync.onRouteMsg(RTM_NEWROUTE, (struct nl_object*)route2.get(), nullptr);
+    m_testRouteSync.onRouteMsg(RTM_DELROUTE, (struct nl_object*)route2.get(), nullptr);
+
+    // Nothing is written before the window expires
+    EXPECT_GT(m_testRouteSync.flushCoalescedRoutes(), 0);
+    EXPECT_FALSE(routeTable.get("192.168.20.0/24", result));
+    EXPECT_FALSE(routeTable.get("192.168.21.0/24", result));
+
+    EXPECT_EQ(m_testRouteSync.flushCoalescedRoutes(true), -1);
+
+    // Only the last state of each route is written
+    ASSERT_TRUE(routeTable.get("192.168.20.0/24", result));
+    bool foundProtocol = false;
+    for (const auto& fv : result) {
+        if (fvField(fv) == "protocol") {
+            foundProtocol = true;
+            EXPECT_EQ(fvValue(fv), "static");
+        }
+    }
+    EXPECT_TRUE(foundProtocol);
+    EXPECT_FALSE(routeTable.get("192.168.21.0/24", result));
+
+    const auto &counters = m_testRouteSync.getCoalesceCounters();
+    EXPECT_EQ(counters.buffered, 2);
+    EXPECT_EQ(counters.suppressed, 3);
+    EXPECT_EQ(counters.flushed, 2);
+
+    // Disabling coalescing writes route updates right away
+    m_testRouteSync.setCoalesceWindow(0);
+    m_testRouteSync.onRouteMsg(RTM_DELROUTE, (struct nl_object*)route.get(), nullptr);
+    EXPECT_FALSE(routeTable.get("192.168.20.0/24", result));
+    EXPECT_EQ(m_testRouteSync.flushCoalescedRoutes(), -1);
+}
@@ -8,6 +8,7 @@
 #define private public
 #include "neighorch.h"
 #include "muxorch.h"
+#include "routeorch.h"
 #undef private
 #include "mock_orchagent_main.h"
 #include "mock_sai_api.h"
@@ -40,6 +41,24 @@ namespace mux_rollback_test
     sai_bulk_object_create_fn old_object_create;
     sai_bulk_object_remove_fn old_object_remove;
 
+    static std::vector<uint32_t> set_route_counts;
+    static std::vector<sai_object_id_t> set_route_nhs;
+
+    /* Fails the last route of the first bulk, succeeds afterwards */
+    static sai_status_t mock_set_route_entries_attribute_partial_failure(
+        uint32_t object_count, const sai_route_entry_t *route_entry, const sai_attribute_t *attr_list,
+        sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bool fail = set_route_counts.empty();
+        set_route_counts.push_back(object_count);
+        set_route_nhs.push_back(attr_list[0].value.oid);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = (fail && i == object_count - 1) ? SAI_STATUS_TABLE_FULL : SAI_STATUS_SUCCESS;
+        }
+        return fail ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    }
+
     class MuxRollbackTest : public MockOrchTest
     {
     protected:
@@ -300,4 +319,58 @@ namespace mux_rollback_test
         SetMuxStateFromAppDb(ACTIVE_STATE);
         EXPECT_EQ(STANDBY_STATE, m_MuxCable->getState());
     }
+
+    TEST_F(MuxRollbackTest, StandbyToActiveRouteSetFailureRollbackToStandby)
+    {
+        NextHopKey nh_key(SERVER_IP1, VLAN_1000);
+        auto &routes = gRouteOrch->m_nextHops[nh_key];
+        routes.insert({ gVirtualRouterId, IpPrefix("10.10.10.0/24") });
+        routes.insert({ gVirtualRouterId, IpPrefix("10.10.20.0/24") });
+
+        auto old_set_route_entries_attribute = gRouteOrch->gNextHopRouteBulker.set_entries_attribute;
+        gRouteOrch->gNextHopRouteBulker.set_entries_attribute = mock_set_route_entries_attribute_partial_failure;
+        set_route_counts.clear();
+        set_route_nhs.clear();
+
+        SetMuxStateFromAppDb(ACTIVE_STATE);
+        EXPECT_EQ(STANDBY_STATE, m_MuxCable->getState());
+
+        /* Both routes are set in one bulk, the route that was updated is restored to its previous NH */
+        ASSERT_GE(set_route_counts.size(), 2u);
+        EXPECT_EQ(2u, set_route_counts[0]);
+        EXPECT_EQ(1u, set_route_counts[1]);
+        EXPECT_NE(set_route_nhs[0], set_route_nhs[1]);
+
+        gRouteOrch->gNextHopRouteBulker.set_entries_attribute = old_set_route_entries_attribute;
+        gRouteOrch->m_nextHops.erase(nh_key);
+    }
+
+    TEST_F(MuxRollbackTest, NextHopRoutesUpdatedInOneBulk)
+    {
+        NextHopKey nh_key(SERVER_IP1, VLAN_1000);
+        auto &routes = gRouteOrch->m_nextHops[nh_key];
+        routes.insert({ gVirtualRouterId, IpPrefix("10.10.10.0/24") });
+        routes.insert({ gVirtualRouterId, IpPrefix("10.10.20.0/24") });
+
+        auto old_set_route_entries_attribute = gRouteOrch->gNextHopRouteBulker.set_entries_attribute;
+        gRouteOrch->gNextHopRouteBulker.set_entries_attribute = mock_set_route_entries_attribute_partial_failure;
+        set_route_counts.clear();
+        set_route_nhs.clear();
+
+        /* Only the routes of the update with a rollback NH are restored */
+        std::vector<NextHopRouteUpdate> updates;
+        updates.emplace_back(nh_key, 0x1234);
+        updates.emplace_back(nh_key);
+        EXPECT_FALSE(gRouteOrch->updateNextHopRoutes(updates));
+
+        ASSERT_EQ(2u, set_route_counts.size());
+        EXPECT_EQ(4u, set_route_counts[0]);
+        EXPECT_EQ(2u, set_route_counts[1]);
+        EXPECT_EQ(0x1234u, set_route_nhs[1]);
+        EXPECT_EQ(0u, updates[0].numRoutes);
+        EXPECT_EQ(1u, updates[1].numRoutes);
+
+        gRouteOrch->gNextHopRouteBulker.set_entries_attribute = old_set_route_entries_attribute;
+        gRouteOrch->m_nextHops.erase(nh_key);
+    }
 }
@@ -0,0 +1,91 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#include "muxorch.h"
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+namespace mux_subnet_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const int NUM_CABLES = 64;
+    static const int NUM_NEIGHBOR_UPDATES = 10000;
+
+    class MuxSubnetTest : public MockOrchTest
+    {
+    protected:
+        string cablePort(int i)
+        {
+            return "Ethernet" + to_string(i * 4);
+        }
+
+        IpAddress serverIpv4(int i)
+        {
+            return IpAddress("192.168.0." + to_string(i + 2));
+        }
+
+        IpAddress serverIpv6(int i)
+        {
+            return IpAddress("fc02:1000::" + to_string(i + 2));
+        }
+
+        void ApplyInitialConfigs()
+        {
+            Table mux_cable_table = Table(m_config_db.get(), CFG_MUX_CABLE_TABLE_NAME);
+
+            // Mux cables are only created once the peer switch is known
+            m_MuxOrch->mux_peer_switch_ = IpAddress(PEER_IPV4_ADDRESS);
+
+            for (int i = 0; i < NUM_CABLES; i++)
+            {
+                mux_cable_table.set(cablePort(i), { { "server_ipv4", serverIpv4(i).to_string() + "/32" },
+                                                    { "server_ipv6", serverIpv6(i).to_string() + "/128" },
+                                                    { "state", "auto" } });
+            }
+
+            m_MuxOrch->addExistingData(&mux_cable_table);
+            static_cast<Orch *>(m_MuxOrch)->doTask();
+        }
+    };
+
+    TEST_F(MuxSubnetTest, FindMuxCableInSubnet)
+    {
+        ASSERT_EQ(m_MuxOrch->mux_cable_tb_.size(), (size_t)NUM_CABLES);
+        ASSERT_EQ(m_MuxOrch->mux_subnet_tb_.size(), (size_t)(2 * NUM_CABLES));
+
+        // Every server address of the 10k neighbor updates resolves to its own cable
+        for (int n = 0; n < NUM_NEIGHBOR_UPDATES; n++)
+        {
+            int i = n % NUM_CABLES;
+            IpAddress nbr = (n / NUM_CABLES) % 2 ? serverIpv6(i) : serverIpv4(i);
+            ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(nbr), m_MuxOrch->getMuxCable(cablePort(i)));
+        }
+
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(IpAddress("192.168.1.2")), nullptr);
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(IpAddress("fc02:1001::2")), nullptr);
+
+        // A cable removal drops its subnets
+        MuxCable *cable = m_MuxOrch->getMuxCable(cablePort(0));
+        m_MuxOrch->removeMuxSubnet(cable->getServerIpv4(), cablePort(0));
+        m_MuxOrch->removeMuxSubnet(cable->getServerIpv6(), cablePort(0));
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(serverIpv4(0)), nullptr);
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(serverIpv6(0)), nullptr);
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(serverIpv4(1)), m_MuxOrch->getMuxCable(cablePort(1)));
+
+        // Overlapping server subnets resolve to the first cable by port name, as before
+        m_MuxOrch->addMuxSubnet(IpPrefix("192.168.0.0/24"), "Ethernet0");
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(serverIpv4(0)), m_MuxOrch->getMuxCable("Ethernet0"));
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(serverIpv4(1)), m_MuxOrch->getMuxCable("Ethernet0"));
+        ASSERT_EQ(m_MuxOrch->findMuxCableInSubnet(serverIpv6(1)), m_MuxOrch->getMuxCable(cablePort(1)));
+    }
+}
@@ -0,0 +1,234 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#include "natorch.h"
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+extern sai_nat_api_t *sai_nat_api;
+
+namespace natorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    /* Entries over three bulks, the first two of them taking more than the time budget */
+    static const uint32_t NUM_NAT_ENTRIES = 2 * NAT_COUNTERS_BULK_SIZE + 100;
+    static const uint32_t BULK_GET_MSECS = NAT_COUNTERS_QUERY_BUDGET / 2 + 10;
+
+    /* Fake clock of the counters query, each bulk GET advances it by BULK_GET_MSECS */
+    uint64_t _query_msecs;
+
+    uint64_t _ut_stub_query_msecs(const struct timespec &begin)
+    {
+        return _query_msecs;
+    }
+
+    sai_nat_api_t ut_sai_nat_api;
+    sai_nat_api_t *pold_sai_nat_api;
+    bool _sai_bulk_get_supported;
+    uint32_t _sai_get_nat_entries_attribute_count;
+    uint32_t _sai_get_nat_entry_attribute_count;
+
+    /* Counters of an entry are derived from its source IP, the entries of 10.0.0.13 fail */
+    sai_status_t getCounters(const sai_nat_entry_t *nat_entry, sai_attribute_t *attr_list)
+    {
+        uint32_t host = ntohl(nat_entry->data.key.src_ip) & 0xffff;
+        if (host == 13)
+        {
+            return SAI_STATUS_FAILURE;
+        }
+        attr_list[0].value.u64 = 100 * host;
+        attr_list[1].value.u64 = host;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_get_nat_entries_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (!_sai_bulk_get_supported)
+        {
+            return SAI_STATUS_NOT_IMPLEMENTED;
+        }
+
+        _sai_get_nat_entries_attribute_count++;
+        _query_msecs += BULK_GET_MSECS;
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = getCounters(&nat_entry[idx], attr_list[idx]);
+            if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
+    sai_status_t _ut_stub_sai_get_nat_entry_attribute(
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        _sai_get_nat_entry_attribute_count++;
+        return getCounters(nat_entry, attr_list);
+    }
+
+    class NatOrchTest : public MockOrchTest
+    {
+    protected:
+        void ApplySaiMock()
+        {
+            ut_sai_nat_api = *sai_nat_api;
+            pold_sai_nat_api = sai_nat_api;
+            ut_sai_nat_api.get_nat_entries_attribute = _ut_stub_sai_get_nat_entries_attribute;
+            ut_sai_nat_api.get_nat_entry_attribute = _ut_stub_sai_get_nat_entry_attribute;
+            sai_nat_api = &ut_sai_nat_api;
+        }
+
+        void PostSetUp()
+        {
+            vector<table_name_with_pri_t> nat_tables = {
+                { APP_NAT_TABLE_NAME,        54 },
+                { APP_NAPT_TABLE_NAME,       53 },
+                { APP_NAT_TWICE_TABLE_NAME,  52 },
+                { APP_NAPT_TWICE_TABLE_NAME, 51 }
+            };
+            m_natOrch = make_unique<NatOrch>(m_app_db.get(), m_state_db.get(), nat_tables, gRouteOrch, gNeighOrch);
+            m_natOrch->m_countersQueryMsecs = _ut_stub_query_msecs;
+
+            _sai_bulk_get_supported = true;
+        }
+
+        void PreTearDown()
+        {
+            m_natOrch.reset();
+            sai_nat_api = pold_sai_nat_api;
+        }
+
+        IpAddress natIp(uint32_t idx)
+        {
+            return IpAddress("10.0." + to_string(idx / 256) + "." + to_string(idx % 256));
+        }
+
+        void addNatEntry(const IpAddress &ip, bool addedToHw = true)
+        {
+            NatEntryValue value = {};
+            value.translated_ip = IpAddress("65.55.45.1");
+            value.nat_type = "snat";
+            value.entry_type = "static";
+            value.addedToHw = addedToHw;
+            m_natOrch->m_natEntries[ip] = value;
+        }
+
+        void addNaptEntry(const IpAddress &ip, int port)
+        {
+            NaptEntryValue value = {};
+            value.translated_ip = IpAddress("65.55.45.1");
+            value.translated_l4_port = 1024;
+            value.nat_type = "snat";
+            value.entry_type = "static";
+            value.addedToHw = true;
+            m_natOrch->m_naptEntries[{ ip, port, "TCP" }] = value;
+        }
+
+        void tick()
+        {
+            _sai_get_nat_entries_attribute_count = 0;
+            _sai_get_nat_entry_attribute_count = 0;
+            _query_msecs = 0;
+            m_natOrch->queryCounters();
+        }
+
+        /* Counters as read from COUNTERS_DB, once the pipelines are flushed */
+        string natPkts(const string &key, const string &table = COUNTERS_NAT_TABLE)
+        {
+            Table counters(m_counters_db.get(), table);
+            string value;
+            if (!counters.hget(key, "NAT_TRANSLATIONS_PKTS", value))
+            {
+                return "absent";
+            }
+            return value;
+        }
+
+        unique_ptr<NatOrch> m_natOrch;
+        shared_ptr<DBConnector> m_counters_db = make_shared<DBConnector>("COUNTERS_DB", 0);
+    };
+
+    TEST_F(NatOrchTest, CountersQueryResumesOnNextTick)
+    {
+        for (uint32_t idx = 0; idx < NUM_NAT_ENTRIES; idx++)
+        {
+            addNatEntry(natIp(idx));
+        }
+        addNaptEntry(natIp(1), 80);
+
+        // The time budget runs out after the second bulk, the next entry is where the query resumes
+        tick();
+        ASSERT_EQ(_sai_get_nat_entries_attribute_count, 2u);
+        ASSERT_EQ(_sai_get_nat_entry_attribute_count, 0u);
+        ASSERT_TRUE(m_natOrch->m_natCountersCursor.valid);
+        ASSERT_EQ(m_natOrch->m_natCountersCursor.key, natIp(2 * NAT_COUNTERS_BULK_SIZE - 1));
+        ASSERT_EQ(m_natOrch->m_countersQueryTable, NAT_COUNTERS_QUERY_NAT);
+        ASSERT_EQ(natPkts(natIp(2).to_string()), "2");
+        ASSERT_EQ(natPkts(natIp(2 * NAT_COUNTERS_BULK_SIZE - 1).to_string()), to_string((2 * NAT_COUNTERS_BULK_SIZE - 1) & 0xffff));
+        ASSERT_EQ(natPkts(natIp(2 * NAT_COUNTERS_BULK_SIZE).to_string()), "absent");
+        ASSERT_EQ(natPkts("TCP:" + natIp(1).to_string() + ":80", COUNTERS_NAPT_TABLE), "absent");
+
+        // Entries changed in between are handled from the cursor on, the ones not in hardware are skipped
+        m_natOrch->m_natEntries.erase(natIp(2 * NAT_COUNTERS_BULK_SIZE));
+        addNatEntry(natIp(NUM_NAT_ENTRIES), false);
+
+        // The next tick ends the NAT table and goes through the others
+        tick();
+        ASSERT_EQ(_sai_get_nat_entries_attribute_count, 2u);
+        ASSERT_FALSE(m_natOrch->m_natCountersCursor.valid);
+        ASSERT_EQ(m_natOrch->m_countersQueryTable, NAT_COUNTERS_QUERY_NAT);
+        ASSERT_EQ(natPkts(natIp(2 * NAT_COUNTERS_BULK_SIZE).to_string()), "absent");
+        ASSERT_EQ(natPkts(natIp(NUM_NAT_ENTRIES - 1).to_string()), to_string((NUM_NAT_ENTRIES - 1) & 0xffff));
+        ASSERT_EQ(natPkts(natIp(NUM_NAT_ENTRIES).to_string()), "absent");
+        ASSERT_EQ(natPkts("TCP:" + natIp(1).to_string() + ":80", COUNTERS_NAPT_TABLE), "1");
+
+        // A failed GET publishes zeros
+        ASSERT_EQ(natPkts(natIp(13).to_string()), "0");
+    }
+
+    TEST_F(NatOrchTest, CountersQueryWithoutBulkGet)
+    {
+        _sai_bulk_get_supported = false;
+
+        for (uint32_t idx = 1; idx <= 20; idx++)
+        {
+            addNatEntry(natIp(idx));
+            addNaptEntry(natIp(idx), 443);
+        }
+
+        // Each entry is read with its own GET, all in a single tick
+        tick();
+        ASSERT_EQ(_sai_get_nat_entries_attribute_count, 0u);
+        ASSERT_EQ(_sai_get_nat_entry_attribute_count, 40u);
+        ASSERT_FALSE(m_natOrch->m_natCountersCursor.valid);
+        ASSERT_FALSE(m_natOrch->m_naptCountersCursor.valid);
+        ASSERT_EQ(m_natOrch->m_countersQueryTable, NAT_COUNTERS_QUERY_NAT);
+
+        ASSERT_EQ(natPkts(natIp(20).to_string()), "20");
+        ASSERT_EQ(natPkts("TCP:" + natIp(20).to_string() + ":443", COUNTERS_NAPT_TABLE), "20");
+        ASSERT_EQ(natPkts(natIp(13).to_string()), "0");
+        ASSERT_EQ(natPkts("TCP:" + natIp(13).to_string() + ":443", COUNTERS_NAPT_TABLE), "0");
+    }
+}
@@ -268,4 +268,32 @@ namespace neighorch_test
         gPortsOrch->m_portList.erase(VLAN_2000);
         LearnNeighbor(VLAN_2000, TEST_IP, MAC2);
     }
+
+    TEST_F(NeighOrchTest, NeighborIndexes)
+    {
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entry);
+        LearnNeighbor(VLAN_1000, TEST_IP, MAC1);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByIp.at(IpAddress(TEST_IP)).count(VLAN1000_NEIGH), 1);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByAlias.at(VLAN_1000).count(VLAN1000_NEIGH), 1);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByMac.at(MacAddress(MAC1)).count(VLAN1000_NEIGH), 1);
+
+        NeighborEntry neighborEntry;
+        MacAddress macAddress;
+        ASSERT_TRUE(gNeighOrch->getNeighborEntry(NextHopKey(TEST_IP, VLAN_1000), neighborEntry, macAddress));
+        ASSERT_EQ(neighborEntry, VLAN1000_NEIGH);
+        ASSERT_EQ(macAddress, MacAddress(MAC1));
+        ASSERT_FALSE(gNeighOrch->getNeighborEntry(NextHopKey(TEST_IP, VLAN_2000), neighborEntry, macAddress));
+
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entry);
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entry);
+        LearnNeighbor(VLAN_2000, TEST_IP, MAC2);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByIp.at(IpAddress(TEST_IP)).size(), 1);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByAlias.count(VLAN_1000), 0);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByMac.count(MacAddress(MAC1)), 0);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighborsByMac.at(MacAddress(MAC2)).count(VLAN2000_NEIGH), 1);
+
+        ASSERT_TRUE(gNeighOrch->getNeighborEntry(NextHopKey(TEST_IP, VLAN_2000), neighborEntry, macAddress));
+        ASSERT_EQ(neighborEntry, VLAN2000_NEIGH);
+        ASSERT_EQ(macAddress, MacAddress(MAC2));
+    }
 }
@@ -82,6 +82,70 @@ namespace orchdaemon_test
         delete ring;
     }
 
+    TEST_F(OrchDaemonTest, RingBufferBackPressure)
+    {
+        RingBuffer ring(3);
+        EXPECT_EQ(ring.getCapacity(), 2);
+
+        int x = 0;
+        EXPECT_TRUE(ring.push([&](){ x += 1; }));
+        EXPECT_TRUE(ring.push([&](){ x += 2; }));
+        EXPECT_TRUE(ring.IsFull());
+
+        // pushWait blocks until the consumer frees a slot
+        std::atomic<bool> pushed{false};
+        std::thread producer([&](){
+            EXPECT_TRUE(ring.pushWait([&](){ x += 4; }));
+            pushed = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        EXPECT_FALSE(pushed);
+
+        AnyTask task;
+        EXPECT_TRUE(ring.pop(task));
+        task();
+        producer.join();
+        EXPECT_TRUE(pushed);
+
+        while (ring.pop(task))
+        {
+            task();
+        }
+        EXPECT_EQ(x, 7);
+        EXPECT_TRUE(ring.IsEmpty());
+
+        EXPECT_EQ(ring.getEnqueueLatency().total(), 3);
+        EXPECT_EQ(ring.getDequeueLatency().total(), 3);
+    }
+
+    TEST_F(OrchDaemonTest, RingBufferPushWaitOnExit)
+    {
+        RingBuffer ring(2);
+
+        EXPECT_TRUE(ring.push([](){}));
+        EXPECT_TRUE(ring.IsFull());
+
+        // a producer blocked on the full ring gives up once the ring thread exits
+        std::atomic<bool> returned{false};
+        bool pushed = true;
+        std::thread producer([&](){
+            pushed = ring.pushWait([](){});
+            returned = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        EXPECT_FALSE(returned);
+
+        ring.exitThread();
+        producer.join();
+        EXPECT_TRUE(returned);
+        EXPECT_FALSE(pushed);
+
+        // nor does it wait on a ring which has exited already
+        EXPECT_FALSE(ring.pushWait([](){}));
+    }
+
     TEST_F(OrchDaemonTest, RingThread)
     {
         orchd->enableRingBuffer();
@@ -128,10 +192,43 @@ namespace orchdaemon_test
         orchd = new OrchDaemon(&appl_db, &config_db, &state_db, &counters_db, nullptr);
     }
 
-    TEST_F(OrchDaemonTest, PushRingBuffer)
+    TEST_F(OrchDaemonTest, WaitRingIdle)
     {
         orchd->enableRingBuffer();
 
+        orchd->ring_thread = std::thread(&OrchDaemon::popRingBuffer, orchd);
+        auto gRingBuffer = orchd->gRingBuffer;
+
+        while (!gRingBuffer->thread_created)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        std::atomic<int> executed{0};
+        for (int i = 0; i < 5; i++)
+        {
+            gRingBuffer->push([&executed]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                executed++;
+            });
+        }
+
+        // waitIdle() wakes up the ring thread and returns once all tasks are done
+        gRingBuffer->waitIdle();
+        EXPECT_EQ(executed, 5);
+        EXPECT_TRUE(gRingBuffer->IsEmpty() && gRingBuffer->IsIdle());
+
+        delete orchd;
+        EXPECT_TRUE(Executor::gRingBuffer == nullptr);
+
+        orchd = new OrchDaemon(&appl_db, &config_db, &state_db, &counters_db, nullptr);
+    }
+
+    TEST_F(OrchDaemonTest, PushRingBuffer)
+    {
+        orchd->enableRingBuffer(64);
+        EXPECT_EQ(orchd->gRingBuffer->getCapacity(), 63);
+
         auto gRingBuffer = orchd->gRingBuffer;
 
         std::vector<std::string> tables = {"ROUTE_TABLE", "OTHER_TABLE"};
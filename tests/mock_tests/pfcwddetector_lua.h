@@ -0,0 +1,373 @@
+// Generated by pfcwddetector_lua.py from pfc_detect_<platform>.lua and pfc_restore.lua, do not edit
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pfcwddetector_test
+{
+    static const uint32_t LUA_POLL_INTERVAL_MS = 125;
+    static const uint64_t LUA_START_TIME_US = 1700000000000000ULL;
+
+    struct LuaPoll
+    {
+        // Fields set before the poll, as key, field and value
+        std::vector<std::vector<std::string>> sets;
+        // Messages published by the plugins, as channel and message
+        std::vector<std::pair<std::string, std::string>> published;
+        // Estimated fields of the port entry after the poll
+        std::vector<std::pair<std::string, std::string>> estimates;
+    };
+
+    struct LuaScenario
+    {
+        std::string name;
+        std::string platform;
+        std::vector<LuaPoll> polls;
+    };
+
+    static const std::vector<LuaScenario> luaScenarios = {
+        { "VsStormAndRestore", "vs", {
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "PFC_WD_ACTION", "drop" }, { "oid:0x15000000000003", "PFC_WD_DETECTION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_WD_RESTORATION_TIME", "250000" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "10" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "5" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5125000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "10" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5250000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\"]" } },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "stormed" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "15" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5375000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "20" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5500000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5625000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5750000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"restore\"]" } },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5875000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "25" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "30" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6125000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "35" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6250000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\"]" } },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "40" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6375000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "20" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "45" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6500000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "30" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "50" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6625000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "40" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "55" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6750000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "110000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6875000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "220000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "7000000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\"]" } },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "330000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "7125000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "440000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "7250000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "BIG_RED_SWITCH_MODE", "enable" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "100" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "7375000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "105" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "7500000000" } },
+                {  },
+                {  }
+            },
+        } },
+        { "VsDebugStorm", "vs", {
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "PFC_WD_ACTION", "drop" }, { "oid:0x15000000000003", "PFC_WD_DETECTION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_WD_RESTORATION_TIME", "250000" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "0" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "10" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "DEBUG_STORM", "enabled" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5125000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5250000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\"]" } },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "stormed" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5375000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5500000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5625000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "DEBUG_STORM", "disabled" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5750000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5875000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"restore\"]" } },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6125000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"restore\"]" } },
+                {  }
+            },
+        } },
+        { "MellanoxStormAndDebug", "mellanox", {
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "PFC_WD_ACTION", "drop" }, { "oid:0x15000000000003", "PFC_WD_DETECTION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_WD_RESTORATION_TIME", "250000" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "10" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "100000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5125000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "224000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5250000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "349000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5375000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\",\"occupancy\",\"100\",\"packets\",\"10\",\"packets_last\",\"10\",\"pfc_rx_packets\",\"0\",\"pfc_rx_packets_last\",\"0\",\"pfc_duration\",\"349000\",\"pfc_duration_last\",\"224000\",\"timestamp\",\"1700000000.375\",\"timestamp_last\",\"1700000000.25\",\"effective_poll_time\",\"125000\",\"effective_pfcwd_poll_time_last\",\"125000\"]" } },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "474000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5500000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "stormed" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "10" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "599000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5625000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "640000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5750000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5875000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"restore\"]" } },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "DEBUG_STORM", "enabled", "true" }, { "DEBUG_STORM", "threshold", "50" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "700000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6125000000" } },
+                { { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 700000 effective poll time 125000(global 125000)" }, { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 700000 effective poll time 125000, triggered by threshold 50%" } },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "765000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6250000000" } },
+                { { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 765000 effective poll time 125000(global 125000)" }, { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 765000 effective poll time 125000, triggered by threshold 50%" } },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "890000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6375000000" } },
+                { { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 890000 effective poll time 125000(global 125000)" }, { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 890000 effective poll time 125000, triggered by threshold 50%" } },
+                {  }
+            },
+            {
+                { { "DEBUG_STORM", "enabled", "false" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "1015000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6500000000" } },
+                { { "PFC_WD_DEBUG", "Port ID oid:0x1000000000001 Queue index 3 occupancy 100 packets 10 pfc rx 10 pfc duration 1015000 effective poll time 125000, triggered by threshold 50%" }, { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\",\"occupancy\",\"100\",\"packets\",\"10\",\"packets_last\",\"10\",\"pfc_rx_packets\",\"10\",\"pfc_rx_packets_last\",\"10\",\"pfc_duration\",\"1015000\",\"pfc_duration_last\",\"890000\",\"timestamp\",\"1700000001.5\",\"timestamp_last\",\"1700000001.375\",\"effective_poll_time\",\"125000\",\"effective_pfcwd_poll_time_last\",\"125000\"]" } },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "1140000" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6625000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "DEBUG_STORM", "enabled" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6750000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6875000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\",\"occupancy\",\"100\",\"packets\",\"10\",\"packets_last\",\"10\",\"pfc_rx_packets\",\"10\",\"pfc_rx_packets_last\",\"10\",\"pfc_duration\",\"1140000\",\"pfc_duration_last\",\"1140000\",\"timestamp\",\"1700000001.875\",\"timestamp_last\",\"1700000001.75\",\"effective_poll_time\",\"125000\",\"effective_pfcwd_poll_time_last\",\"125000\"]" } },
+                {  }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "7000000000" } },
+                {  },
+                {  }
+            },
+        } },
+        { "BroadcomAlertAndHistory", "broadcom", {
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "PFC_WD_ACTION", "alert" }, { "oid:0x15000000000003", "PFC_WD_DETECTION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_WD_RESTORATION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_STAT_HISTORY", "enable" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "10" }, { "oid:0x15000000000003", "SAI_QUEUE_ATTR_PAUSE_STATUS", "false" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_ON2OFF_RX_PKTS", "0" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x15000000000003", "SAI_QUEUE_ATTR_PAUSE_STATUS", "true" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "5" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_ON2OFF_RX_PKTS", "1" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5125000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "125000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "125000" } }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "10" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5250000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "250000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "250000" } }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "15" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5375000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\"]" } },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "375000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "375000" } }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "20" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5500000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "500000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "500000" } }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "stormed" }, { "oid:0x15000000000003", "SAI_QUEUE_ATTR_PAUSE_STATUS", "false" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5625000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"restore\"]" } },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "500000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "500000" } }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5750000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "500000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "500000" } }
+            },
+            {
+                { { "oid:0x15000000000003", "SAI_QUEUE_ATTR_PAUSE_STATUS", "true" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5875000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "500000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "500000" } }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6000000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "625000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "625000" } }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "25" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "6125000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIMESTAMP", "1.7e+15" }, { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "750000" }, { "EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "750000" } }
+            },
+        } },
+        { "BroadcomDropWithPauseDuration", "broadcom", {
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "operational" }, { "oid:0x15000000000003", "PFC_WD_ACTION", "drop" }, { "oid:0x15000000000003", "PFC_WD_DETECTION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_WD_RESTORATION_TIME", "250000" }, { "oid:0x15000000000003", "PFC_STAT_HISTORY", "enable" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100" }, { "oid:0x15000000000003", "SAI_QUEUE_STAT_PACKETS", "10" }, { "oid:0x15000000000003", "SAI_QUEUE_ATTR_PAUSE_STATUS", "true" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_ON2OFF_RX_PKTS", "0" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5000000000" } },
+                {  },
+                {  }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "5" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5125000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "125000" } }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "10" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5250000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"storm\"]" } },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "250000" } }
+            },
+            {
+                { { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "15" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5375000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "375000" } }
+            },
+            {
+                { { "oid:0x15000000000003", "PFC_WD_STATUS", "stormed" }, { "oid:0x1000000000001", "SAI_PORT_STAT_PFC_3_RX_PKTS", "20" }, { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5500000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "375000" } }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5625000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "375000" } }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5750000000" } },
+                { { "PFC_WD_ACTION", "[\"oid:0x15000000000003\",\"restore\"]" } },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "375000" } }
+            },
+            {
+                { { "TIME_STAMP", "PFC_WD_Port_Counter_time_stamp", "5875000000" } },
+                {  },
+                { { "EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US", "375000" } }
+            },
+        } },
+    };
+}
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""
+Generates pfcwddetector_lua.h, the expected results of the PFC watchdog detection and
+restoration plugins for the counter sequences replayed on PfcWdDetector by pfcwddetector_ut.
+
+The sequences are run through orchagent/pfc_detect_<platform>.lua and orchagent/pfc_restore.lua
+in Lua 5.1, as redis does, on an in-memory model of the redis commands the plugins call.
+
+    pip install lupa
+    ./pfcwddetector_lua.py > pfcwddetector_lua.h
+"""
+
+import os
+import sys
+
+from lupa import lua51
+
+ORCHAGENT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'orchagent')
+
+QUEUE = 'oid:0x15000000000003'
+PORT = 'oid:0x1000000000001'
+QUEUE_INDEX = '3'
+COUNTERS_DB = '2'
+
+# The poll interval and the times are multiples of 1/8 s, so that the time stamps of the plugins,
+# in seconds as doubles, are exact
+POLL_INTERVAL_MS = 125
+START_TIME_US = 1700000000 * 1000000
+PORT_TIMESTAMP_START_NS = 5000000000
+
+
+class Redis(object):
+    def __init__(self):
+        self.hashes = {}
+        self.published = []
+        self.time_us = START_TIME_US
+
+    @staticmethod
+    def to_string(value):
+        # Lua numbers are converted to strings by redis with %.17g
+        if isinstance(value, float) or isinstance(value, int):
+            return '%.17g' % value
+        return value
+
+    def call(self, command, *args):
+        command = command.upper()
+        args = [self.to_string(arg) for arg in args]
+        if command == 'SELECT':
+            return 'OK'
+        if command == 'TIME':
+            return self.lua.table(str(self.time_us // 1000000), str(self.time_us % 1000000))
+        if command == 'HGET':
+            return self.hashes.get(args[0], {}).get(args[1], False)
+        if command == 'HSET':
+            self.hashes.setdefault(args[0], {})[args[1]] = args[2]
+            return 1
+        if command == 'HDEL':
+            return 1 if self.hashes.get(args[0], {}).pop(args[1], None) is not None else 0
+        if command == 'HKEYS':
+            return self.lua.table(*self.hashes.get(args[0], {}).keys())
+        if command == 'PUBLISH':
+            self.published.append((args[0], args[1]))
+            return 0
+        raise Exception('Unsupported command ' + command)
+
+
+def run_scenario(platform, polls):
+    redis = Redis()
+    lua = lua51.LuaRuntime(unpack_returned_tuples=True)
+    redis.lua = lua
+    lua.globals().redis = lua.table(call=redis.call)
+
+    plugins = []
+    for name in ['pfc_detect_' + platform + '.lua', 'pfc_restore.lua']:
+        with open(os.path.join(ORCHAGENT_DIR, name)) as script:
+            plugins.append(lua.eval('function(KEYS, ARGV) ' + script.read() + ' end'))
+
+    redis.hashes['COUNTERS_QUEUE_INDEX_MAP'] = {QUEUE: QUEUE_INDEX}
+    redis.hashes['COUNTERS_QUEUE_PORT_MAP'] = {QUEUE: PORT}
+
+    results = []
+    for i, sets in enumerate(polls):
+        # syncd records the time stamp of each poll of the counters
+        sets = sets + [('TIME_STAMP', 'PFC_WD_Port_Counter_time_stamp',
+                        str(PORT_TIMESTAMP_START_NS + i * POLL_INTERVAL_MS * 1000000))]
+        for key, field, value in sets:
+            name = key if key == 'DEBUG_STORM' else 'COUNTERS:' + key
+            redis.hashes.setdefault(name, {})[field] = value
+
+        redis.published = []
+        for plugin in plugins:
+            plugin(lua.table(QUEUE), lua.table(COUNTERS_DB, 'COUNTERS', str(POLL_INTERVAL_MS)))
+        redis.time_us += POLL_INTERVAL_MS * 1000
+
+        estimates = sorted((field, value) for field, value in redis.hashes.get('COUNTERS:' + PORT, {}).items()
+                           if field.startswith('EST_'))
+        results.append((sets, redis.published, estimates))
+
+    return results
+
+
+def queue(field, value):
+    return (QUEUE, field, value)
+
+
+def port(field, value):
+    return (PORT, 'SAI_PORT_STAT_PFC_' + QUEUE_INDEX + '_' + field, value)
+
+
+def debug(field, value):
+    return ('DEBUG_STORM', field, value)
+
+
+def init(action, *counters):
+    return [queue('PFC_WD_STATUS', 'operational'),
+            queue('PFC_WD_ACTION', action),
+            queue('PFC_WD_DETECTION_TIME', '250000'),
+            queue('PFC_WD_RESTORATION_TIME', '250000')] + list(counters)
+
+
+def vs_storm_and_restore():
+    polls = [init('drop',
+                  queue('SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES', '100'),
+                  queue('SAI_QUEUE_STAT_PACKETS', '10'),
+                  port('RX_PKTS', '0'),
+                  port('RX_PAUSE_DURATION_US', '0'))]
+    # Stuck queue receiving PFC frames, for the detection time
+    polls += [[port('RX_PKTS', '5')], [port('RX_PKTS', '10')]]
+    # In storm, restored once no PFC frame is received for the restoration time
+    polls += [[queue('PFC_WD_STATUS', 'stormed'), port('RX_PKTS', '15')], [port('RX_PKTS', '20')], [], [], []]
+    # Detected again
+    polls += [[queue('PFC_WD_STATUS', 'operational'), port('RX_PKTS', '25')], [port('RX_PKTS', '30')],
+              [port('RX_PKTS', '35')], [port('RX_PKTS', '40')]]
+    # A queue which transmits is not stuck
+    polls += [[queue('PFC_WD_STATUS', 'operational'), queue('SAI_QUEUE_STAT_PACKETS', str(10 + i * 10)),
+               port('RX_PKTS', str(40 + i * 5))] for i in range(1, 4)]
+    # Empty queue paused for most of the poll time
+    polls += [[queue('SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES', '0'), port('RX_PAUSE_DURATION_US', str(i * 110000))]
+              for i in range(1, 5)]
+    # Nothing is detected in big red switch mode
+    polls += [[queue('BIG_RED_SWITCH_MODE', 'enable'), port('RX_PKTS', '100')], [port('RX_PKTS', '105')]]
+    return polls
+
+
+def vs_debug_storm():
+    polls = [init('drop',
+                  queue('SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES', '0'),
+                  queue('SAI_QUEUE_STAT_PACKETS', '10'),
+                  port('RX_PKTS', '0'),
+                  port('RX_PAUSE_DURATION_US', '0'))]
+    polls += [[queue('DEBUG_STORM', 'enabled')], [], [queue('PFC_WD_STATUS', 'stormed')], [], []]
+    polls += [[queue('DEBUG_STORM', 'disabled')], [], [], []]
+    return polls
+
+
+def mellanox_storm_and_debug():
+    polls = [init('drop',
+                  queue('SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES', '100'),
+                  queue('SAI_QUEUE_STAT_PACKETS', '10'),
+                  port('RX_PKTS', '0'),
+                  port('RX_PAUSE_DURATION_US', '0'))]
+    # Paused for less than 99% of the poll time, then for all of it
+    polls += [[port('RX_PAUSE_DURATION_US', '100000')], [port('RX_PAUSE_DURATION_US', '224000')],
+              [port('RX_PAUSE_DURATION_US', '349000')], [port('RX_PAUSE_DURATION_US', '474000')]]
+    polls += [[queue('PFC_WD_STATUS', 'stormed'), port('RX_PKTS', '10'), port('RX_PAUSE_DURATION_US', '599000')],
+              [port('RX_PAUSE_DURATION_US', '640000')], [], []]
+    # Storms are debugged with the counters of all queues, and of the ones above the threshold
+    polls += [[queue('PFC_WD_STATUS', 'operational'), debug('enabled', 'true'), debug('threshold', '50'),
+               port('RX_PAUSE_DURATION_US', '700000')],
+              [port('RX_PAUSE_DURATION_US', '765000')], [port('RX_PAUSE_DURATION_US', '890000')],
+              [debug('enabled', 'false'), port('RX_PAUSE_DURATION_US', '1015000')],
+              [port('RX_PAUSE_DURATION_US', '1140000')]]
+    # Debugging a storm of the queue
+    polls += [[queue('DEBUG_STORM', 'enabled')], [], []]
+    return polls
+
+
+def broadcom_alert_and_history():
+    polls = [init('alert',
+                  queue('PFC_STAT_HISTORY', 'enable'),
+                  queue('SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES', '100'),
+                  queue('SAI_QUEUE_STAT_PACKETS', '10'),
+                  queue('SAI_QUEUE_ATTR_PAUSE_STATUS', 'false'),
+                  port('RX_PKTS', '0'),
+                  port('ON2OFF_RX_PKTS', '0'))]
+    # Pause starts, then the queue stays paused without any pause release
+    polls += [[queue('SAI_QUEUE_ATTR_PAUSE_STATUS', 'true'), port('RX_PKTS', '5'), port('ON2OFF_RX_PKTS', '1')],
+              [port('RX_PKTS', '10')], [port('RX_PKTS', '15')], [port('RX_PKTS', '20')]]
+    # Alert storms are restored by the detection as soon as the storm condition is gone
+    polls += [[queue('PFC_WD_STATUS', 'stormed'), queue('SAI_QUEUE_ATTR_PAUSE_STATUS', 'false')],
+              [queue('PFC_WD_STATUS', 'operational')]]
+    # Paused again, without any PFC frame
+    polls += [[queue('SAI_QUEUE_ATTR_PAUSE_STATUS', 'true')], [], [port('RX_PKTS', '25')]]
+    return polls
+
+
+def broadcom_drop_with_pause_duration():
+    polls = [init('drop',
+                  queue('PFC_STAT_HISTORY', 'enable'),
+                  queue('SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES', '100'),
+                  queue('SAI_QUEUE_STAT_PACKETS', '10'),
+                  queue('SAI_QUEUE_ATTR_PAUSE_STATUS', 'true'),
+                  port('RX_PKTS', '0'),
+                  port('ON2OFF_RX_PKTS', '0'),
+                  port('RX_PAUSE_DURATION_US', '0'))]
+    polls += [[port('RX_PKTS', str(i * 5))] for i in range(1, 4)]
+    polls += [[queue('PFC_WD_STATUS', 'stormed'), port('RX_PKTS', '20')], [], [], []]
+    return polls
+
+
+SCENARIOS = [
+    ('VsStormAndRestore', 'vs', vs_storm_and_restore()),
+    ('VsDebugStorm', 'vs', vs_debug_storm()),
+    ('MellanoxStormAndDebug', 'mellanox', mellanox_storm_and_debug()),
+    ('BroadcomAlertAndHistory', 'broadcom', broadcom_alert_and_history()),
+    ('BroadcomDropWithPauseDuration', 'broadcom', broadcom_drop_with_pause_duration()),
+]
+
+
+def c_string(value):
+    return '"' + value.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def main():
+    out = sys.stdout
+    out.write('// Generated by pfcwddetector_lua.py from pfc_detect_<platform>.lua and pfc_restore.lua, do not edit\n')
+    out.write('#pragma once\n\n')
+    out.write('#include <cstdint>\n#include <string>\n#include <utility>\n#include <vector>\n\n')
+    out.write('namespace pfcwddetector_test\n{\n')
+    out.write('    static const uint32_t LUA_POLL_INTERVAL_MS = %d;\n' % POLL_INTERVAL_MS)
+    out.write('    static const uint64_t LUA_START_TIME_US = %dULL;\n\n' % START_TIME_US)
+    out.write('    struct LuaPoll\n    {\n')
+    out.write('        // Fields set before the poll, as key, field and value\n')
+    out.write('        std::vector<std::vector<std::string>> sets;\n')
+    out.write('        // Messages published by the plugins, as channel and message\n')
+    out.write('        std::vector<std::pair<std::string, std::string>> published;\n')
+    out.write('        // Estimated fields of the port entry after the poll\n')
+    out.write('        std::vector<std::pair<std::string, std::string>> estimates;\n')
+    out.write('    };\n\n')
+    out.write('    struct LuaScenario\n    {\n')
+    out.write('        std::string name;\n        std::string platform;\n        std::vector<LuaPoll> polls;\n')
+    out.write('    };\n\n')
+    out.write('    static const std::vector<LuaScenario> luaScenarios = {\n')
+    for name, platform, polls in SCENARIOS:
+        out.write('        { %s, %s, {\n' % (c_string(name), c_string(platform)))
+        for sets, published, estimates in run_scenario(platform, polls):
+            out.write('            {\n')
+            out.write('                { %s },\n' % ', '.join(
+                '{ %s }' % ', '.join(c_string(v) for v in entry) for entry in sets))
+            out.write('                { %s },\n' % ', '.join(
+                '{ %s, %s }' % (c_string(c), c_string(m)) for c, m in published))
+            out.write('                { %s }\n' % ', '.join(
+                '{ %s, %s }' % (c_string(f), c_string(v)) for f, v in estimates))
+            out.write('            },\n')
+        out.write('        } },\n')
+    out.write('    };\n}\n')
+
+
+if __name__ == '__main__':
+    main()
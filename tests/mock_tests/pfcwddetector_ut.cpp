@@ -0,0 +1,268 @@
+#include "pfcwddetector.h"
+#include "pfcwddetector_lua.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <string>
+
+namespace pfcwddetector_test
+{
+    using namespace std;
+    using namespace swss;
+
+    static const string QUEUE_KEY = "oid:0x15000000000003";
+    static const string PORT_KEY = "oid:0x1000000000001";
+    static const uint32_t POLL_INTERVAL_MS = 100;
+
+    // Runs the detector on counters set by the test, as orchagent does on the ones of COUNTERS_DB
+    struct DetectorHarness
+    {
+        DetectorHarness(const string &platform, uint32_t pollInterval = POLL_INTERVAL_MS)
+        {
+            detector = PfcWdDetector::create(platform, pollInterval);
+            detector->addQueue(QUEUE_KEY, PORT_KEY, 3);
+        }
+
+        // Polls the detector elapsed microseconds after the previous poll
+        PfcWdDetector::PollResult poll(uint64_t elapsed, int64_t wallClockStep = 0)
+        {
+            now += elapsed;
+            wallTime = static_cast<uint64_t>(static_cast<int64_t>(wallTime + elapsed) + wallClockStep);
+
+            PfcWdDetector::PollResult result;
+            detector->poll(now, wallTime, [this](const string &key) -> const PfcWdDetector::Counters *
+            {
+                auto it = counters.find(key);
+                return it == counters.end() ? nullptr : &it->second;
+            }, debugStorm, result);
+
+            for (auto &update : result.updates)
+            {
+                for (auto &fv : update.second)
+                {
+                    counters[update.first][fvField(fv)] = fvValue(fv);
+                }
+            }
+
+            return result;
+        }
+
+        void init(const string &action, const string &detectionTime, const string &restorationTime)
+        {
+            counters[QUEUE_KEY] = {
+                { "PFC_WD_STATUS", "operational" },
+                { "PFC_WD_ACTION", action },
+                { "PFC_WD_DETECTION_TIME", detectionTime },
+                { "PFC_WD_RESTORATION_TIME", restorationTime }
+            };
+        }
+
+        void setQueue(const string &field, const string &value)
+        {
+            counters[QUEUE_KEY][field] = value;
+        }
+
+        void setPort(const string &field, const string &value)
+        {
+            counters[PORT_KEY][field] = value;
+        }
+
+        void setTimestamp(uint64_t timestamp)
+        {
+            counters["TIME_STAMP"]["PFC_WD_Port_Counter_time_stamp"] = to_string(timestamp);
+        }
+
+        unique_ptr<PfcWdDetector> detector;
+        map<string, PfcWdDetector::Counters> counters;
+        PfcWdDetector::Counters debugStorm;
+        uint64_t now = 1000000;
+        uint64_t wallTime = LUA_START_TIME_US;
+    };
+
+    // Message the plugins publish on PFC_WD_ACTION for the event
+    string actionMessage(const PfcWdDetector::Event &event)
+    {
+        string message = "[\"" + event.queueKey + "\",\"" + event.event + "\"";
+        for (const auto &fv : event.info)
+        {
+            message += ",\"" + fvField(fv) + "\",\"" + fvValue(fv) + "\"";
+        }
+        return message + "]";
+    }
+
+    vector<string> events(const PfcWdDetector::PollResult &result)
+    {
+        vector<string> events;
+        for (const auto &event : result.events)
+        {
+            events.push_back(event.event);
+        }
+        return events;
+    }
+
+    TEST(PfcWdDetectorTest, Create)
+    {
+        ASSERT_TRUE(PfcWdDetector::create("vs", POLL_INTERVAL_MS) != nullptr);
+        ASSERT_TRUE(PfcWdDetector::create("mellanox", POLL_INTERVAL_MS) != nullptr);
+        ASSERT_TRUE(PfcWdDetector::create("broadcom", POLL_INTERVAL_MS) != nullptr);
+        ASSERT_TRUE(PfcWdDetector::create("cisco-8000", POLL_INTERVAL_MS) == nullptr);
+    }
+
+    TEST(PfcWdDetectorTest, CountersKeys)
+    {
+        DetectorHarness h("vs");
+        h.detector->addQueue("oid:0x15000000000004", PORT_KEY, 4);
+
+        // The port of both queues is read once
+        vector<string> expected = { "TIME_STAMP", QUEUE_KEY, PORT_KEY, "oid:0x15000000000004" };
+        ASSERT_EQ(h.detector->getCountersKeys(), expected);
+    }
+
+    // Replays the counter sequences of pfcwddetector_lua.h and checks that the detector publishes
+    // what pfc_detect_<platform>.lua and pfc_restore.lua published on them
+    TEST(PfcWdDetectorTest, LuaParity)
+    {
+        for (const auto &scenario : luaScenarios)
+        {
+            DetectorHarness h(scenario.platform, LUA_POLL_INTERVAL_MS);
+
+            for (size_t i = 0; i < scenario.polls.size(); i++)
+            {
+                SCOPED_TRACE(scenario.name + " poll " + to_string(i));
+                const auto &poll = scenario.polls[i];
+
+                for (const auto &set : poll.sets)
+                {
+                    auto &entry = set[0] == "DEBUG_STORM" ? h.debugStorm : h.counters[set[0]];
+                    entry[set[1]] = set[2];
+                }
+
+                auto result = h.poll(i == 0 ? 0 : LUA_POLL_INTERVAL_MS * 1000);
+
+                vector<string> actions, debug;
+                for (const auto &published : poll.published)
+                {
+                    (published.first == "PFC_WD_ACTION" ? actions : debug).push_back(published.second);
+                }
+
+                vector<string> resultActions;
+                for (const auto &event : result.events)
+                {
+                    resultActions.push_back(actionMessage(event));
+                }
+                ASSERT_EQ(resultActions, actions);
+                ASSERT_EQ(result.debugMessages, debug);
+
+                map<string, string> estimates;
+                for (const auto &fv : h.counters[PORT_KEY])
+                {
+                    if (fv.first.find("EST_") == 0)
+                    {
+                        estimates.emplace(fv.first, fv.second);
+                    }
+                }
+                map<string, string> expectedEstimates(poll.estimates.begin(), poll.estimates.end());
+                ASSERT_EQ(estimates, expectedEstimates);
+            }
+        }
+    }
+
+    TEST(PfcWdDetectorTest, CountersNotPolledYetAreSkipped)
+    {
+        DetectorHarness h("vs");
+        h.init("drop", "300000", "300000");
+        h.setQueue("SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100");
+        h.setQueue("SAI_QUEUE_STAT_PACKETS", "10");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "0");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0");
+
+        ASSERT_TRUE(h.poll(0).events.empty());
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "5");
+        ASSERT_TRUE(h.poll(100000).events.empty());
+
+        // Counters that did not change since the previous poll don't reset the detection
+        ASSERT_TRUE(h.poll(50000).events.empty());
+
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "10");
+        ASSERT_TRUE(h.poll(50000).events.empty());
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "15");
+        ASSERT_EQ(events(h.poll(100000)), vector<string>({ "storm" }));
+    }
+
+    TEST(PfcWdDetectorTest, RestorationWaitsForNewCounters)
+    {
+        DetectorHarness h("vs");
+        h.init("drop", "200000", "200000");
+        h.setQueue("SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100");
+        h.setQueue("SAI_QUEUE_STAT_PACKETS", "10");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "0");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0");
+
+        uint64_t timestamp = 5000000000;
+        h.setTimestamp(timestamp);
+        ASSERT_TRUE(h.poll(0).events.empty());
+
+        for (int i = 1; i <= 2; i++)
+        {
+            h.setTimestamp(timestamp += 100000000);
+            h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", to_string(i * 5));
+            ASSERT_EQ(events(h.poll(100000)), vector<string>(i == 2 ? 1 : 0, "storm"));
+        }
+        h.setQueue("PFC_WD_STATUS", "stormed");
+
+        // The storm goes on, the detector polls more often than syncd
+        for (int i = 3; i <= 6; i++)
+        {
+            h.setTimestamp(timestamp += 100000000);
+            h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", to_string(i * 5));
+            ASSERT_TRUE(h.poll(34000).events.empty());
+            ASSERT_TRUE(h.poll(33000).events.empty());
+            ASSERT_TRUE(h.poll(33000).events.empty());
+        }
+
+        // The storm is over once the counters of two polls received no PFC frame
+        h.setTimestamp(timestamp += 100000000);
+        ASSERT_TRUE(h.poll(100000).events.empty());
+        h.setTimestamp(timestamp += 100000000);
+        ASSERT_EQ(events(h.poll(100000)), vector<string>({ "restore" }));
+    }
+
+    TEST(PfcWdDetectorTest, MeasuredInterval)
+    {
+        DetectorHarness h("vs");
+        h.init("drop", "400000", "400000");
+        h.setQueue("SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100");
+        h.setQueue("SAI_QUEUE_STAT_PACKETS", "10");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "0");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", "0");
+
+        // The detection time is counted down by the time between polls, not the poll interval
+        ASSERT_TRUE(h.poll(0).events.empty());
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "5");
+        ASSERT_TRUE(h.poll(200000).events.empty());
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "10");
+        ASSERT_EQ(events(h.poll(200000)), vector<string>({ "storm" }));
+    }
+
+    TEST(PfcWdDetectorTest, BroadcomHistoryOnWallClockStep)
+    {
+        DetectorHarness h("broadcom");
+        h.init("alert", "1000000", "1000000");
+        h.setQueue("PFC_STAT_HISTORY", "enable");
+        h.setQueue("SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "100");
+        h.setQueue("SAI_QUEUE_STAT_PACKETS", "10");
+        h.setQueue("SAI_QUEUE_ATTR_PAUSE_STATUS", "true");
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "0");
+        h.setPort("SAI_PORT_STAT_PFC_3_ON2OFF_RX_PKTS", "0");
+
+        h.poll(0);
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "5");
+        h.poll(100000);
+        ASSERT_EQ(h.counters[PORT_KEY]["EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US"], "100000");
+
+        // The paused time is estimated from the monotonic clock when the wall clock steps back
+        h.setPort("SAI_PORT_STAT_PFC_3_RX_PKTS", "10");
+        h.poll(100000, -3600000000LL);
+        ASSERT_EQ(h.counters[PORT_KEY]["EST_PORT_STAT_PFC_3_RECENT_PAUSE_TIME_US"], "200000");
+        ASSERT_EQ(h.counters[PORT_KEY]["EST_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US"], "200000");
+    }
+}
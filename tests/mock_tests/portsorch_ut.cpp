@@ -722,6 +722,123 @@ namespace portsorch_test
         cleanupPorts(gPortsOrch);
     }
 
+    /*
+    * Test that the oper speed and FEC of the ports that came up in one
+    * port_state_change batch are fetched with a single bulk get
+    */
+    static vector<uint32_t> _sai_get_ports_attribute_counts;
+
+    sai_status_t _ut_stub_sai_get_ports_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        _sai_get_ports_attribute_counts.push_back(object_count);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (attr_list[i][0].id == SAI_PORT_ATTR_OPER_SPEED)
+            {
+                attr_list[i][0].value.u32 = 100000;
+            }
+            else if (attr_list[i][0].id == SAI_PORT_ATTR_OPER_PORT_FEC_MODE)
+            {
+                attr_list[i][0].value.s32 = SAI_PORT_FEC_MODE_RS;
+            }
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    TEST_F(PortsOrchTest, PortOperStatusBatchBulkGet)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table statePortTable = Table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone, PortInitDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration :
+        //  create ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        // All ports come up in a single notification
+        vector<sai_port_oper_status_notification_t> port_oper_status;
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            sai_port_oper_status_notification_t ntf;
+            memset(&ntf, 0, sizeof(ntf));
+            ntf.port_id = port.m_port_id;
+            ntf.port_state = SAI_PORT_OPER_STATUS_UP;
+            port_oper_status.push_back(ntf);
+        }
+
+        _hook_sai_port_api();
+        ut_sai_port_api.get_ports_attribute = _ut_stub_sai_get_ports_attribute;
+        _sai_get_ports_attribute_counts.clear();
+        gPortsOrch->oper_fec_sup = true;
+
+        auto exec = static_cast<Notifier *>(gPortsOrch->getExecutor("PORT_STATUS_NOTIFICATIONS"));
+        auto consumer = exec->getNotificationConsumer();
+
+        mockReply = (redisReply *)calloc(sizeof(redisReply), 1);
+        mockReply->type = REDIS_REPLY_ARRAY;
+        mockReply->elements = 3; // REDIS_PUBLISH_MESSAGE_ELEMNTS
+        mockReply->element = (redisReply **)calloc(sizeof(redisReply *), mockReply->elements);
+        mockReply->element[2] = (redisReply *)calloc(sizeof(redisReply), 1);
+        mockReply->element[2]->type = REDIS_REPLY_STRING;
+        std::string data = sai_serialize_port_oper_status_ntf(static_cast<uint32_t>(port_oper_status.size()), port_oper_status.data());
+        std::vector<FieldValueTuple> notifyValues;
+        FieldValueTuple opdata("port_state_change", data);
+        notifyValues.push_back(opdata);
+        std::string msg = swss::JSon::buildJson(notifyValues);
+        mockReply->element[2]->str = (char*)calloc(1, msg.length() + 1);
+        memcpy(mockReply->element[2]->str, msg.c_str(), msg.length());
+
+        // trigger the notification
+        consumer->readData();
+        gPortsOrch->doTask(*consumer);
+        mockReply = nullptr;
+
+        gPortsOrch->oper_fec_sup = false;
+        _unhook_sai_port_api();
+
+        // One bulk get with the speed and the FEC of every port
+        ASSERT_EQ(_sai_get_ports_attribute_counts.size(), 1u);
+        ASSERT_EQ(_sai_get_ports_attribute_counts[0], 2 * ports.size());
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            ASSERT_EQ(port.m_oper_status, SAI_PORT_OPER_STATUS_UP);
+
+            string value;
+            ASSERT_TRUE(statePortTable.hget(it.first, "speed", value));
+            ASSERT_EQ(value, "100000");
+            ASSERT_TRUE(statePortTable.hget(it.first, "fec", value));
+            ASSERT_EQ(value, "rs");
+        }
+
+        cleanupPorts(gPortsOrch);
+    }
+
    /*
     * Test port oper error count
     */
@@ -1475,6 +1592,67 @@ namespace portsorch_test
         _unhook_sai_queue_api();
     }
 
+    /**
+     * Test that verifies PortsOrch::getPortPtr() looks up ports without copies
+     */
+    TEST_F(PortsOrchTest, GetPortPtrTest)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports to populate DB
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration :
+        //  create ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        // The pointer refers to the port held by PortsOrch, by alias and by OID
+        Port *p = gPortsOrch->getPortPtr("Ethernet0");
+        ASSERT_NE(p, nullptr);
+        ASSERT_EQ(p, &gPortsOrch->m_portList.at("Ethernet0"));
+        ASSERT_EQ(gPortsOrch->getPortPtr(p->m_port_id), p);
+
+        const PortsOrch *constPortsOrch = gPortsOrch;
+        ASSERT_EQ(constPortsOrch->getPortPtr("Ethernet0"), p);
+        ASSERT_EQ(constPortsOrch->getPortPtr(p->m_port_id), p);
+
+        ASSERT_EQ(gPortsOrch->getPortPtr("Ethernet1000"), nullptr);
+        ASSERT_EQ(gPortsOrch->getPortPtr(static_cast<sai_object_id_t>(0xdeadbeef)), nullptr);
+
+        // Updates made through setPort() are seen through the pointer
+        Port port;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", port));
+        port.m_fdb_count = 42;
+        gPortsOrch->setPort(port.m_alias, port);
+        ASSERT_EQ(p->m_fdb_count, 42u);
+        p->m_fdb_count = 0;
+
+        // Every port resolves to its live entry in m_portList, by alias and by OID
+        for (auto &it : gPortsOrch->m_portList)
+        {
+            ASSERT_EQ(gPortsOrch->getPortPtr(it.first), &it.second);
+        }
+        for (const auto &it : gPortsOrch->saiOidToAlias)
+        {
+            ASSERT_EQ(gPortsOrch->getPortPtr(it.first), &gPortsOrch->m_portList.at(it.second));
+        }
+
+        // Cleanup ports
+        cleanupPorts(gPortsOrch);
+    }
+
     TEST_F(PortsOrchTest, PortPTConfigDefaultTimestampTemplate)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
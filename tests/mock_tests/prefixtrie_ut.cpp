@@ -0,0 +1,82 @@
+#include "ut_helper.h"
+#include "prefixtrie.h"
+
+#include <string>
+#include <vector>
+
+namespace prefixtrie_test
+{
+    using namespace std;
+
+    struct PrefixTrieTest : public ::testing::Test
+    {
+        PrefixTrieTest() {}
+
+        vector<string> covering(PrefixTrie<int> &trie, const string &addr)
+        {
+            vector<string> prefixes;
+            trie.forEachCovering(IpAddress(addr), [&prefixes](const IpPrefix &prefix, int &)
+            {
+                prefixes.push_back(prefix.to_string());
+            });
+            return prefixes;
+        }
+
+        vector<string> covered(PrefixTrie<int> &trie, const string &pfx)
+        {
+            vector<string> prefixes;
+            trie.forEachCovered(IpPrefix(pfx), [&prefixes](const IpPrefix &prefix, int &)
+            {
+                prefixes.push_back(prefix.to_string());
+            });
+            return prefixes;
+        }
+    };
+
+    TEST_F(PrefixTrieTest, CoveringPrefixes)
+    {
+        PrefixTrie<int> trie;
+        trie.insert(IpPrefix("0.0.0.0/0"), 0);
+        trie.insert(IpPrefix("10.0.0.0/8"), 8);
+        trie.insert(IpPrefix("10.1.0.0/16"), 16);
+        trie.insert(IpPrefix("10.1.2.0/24"), 24);
+        trie.insert(IpPrefix("10.2.0.0/16"), 16);
+        trie.insert(IpPrefix("::/0"), 0);
+        trie.insert(IpPrefix("2000::/64"), 64);
+        ASSERT_EQ(7u, trie.size());
+
+        ASSERT_EQ(vector<string>({ "0.0.0.0/0", "10.0.0.0/8", "10.1.0.0/16", "10.1.2.0/24" }), covering(trie, "10.1.2.3"));
+        ASSERT_EQ(vector<string>({ "0.0.0.0/0", "10.0.0.0/8", "10.1.0.0/16" }), covering(trie, "10.1.3.3"));
+        ASSERT_EQ(vector<string>({ "0.0.0.0/0" }), covering(trie, "20.1.2.3"));
+        ASSERT_EQ(vector<string>({ "::/0", "2000::/64" }), covering(trie, "2000::1"));
+
+        ASSERT_TRUE(trie.erase(IpPrefix("10.1.0.0/16")));
+        ASSERT_FALSE(trie.erase(IpPrefix("10.1.0.0/16")));
+        ASSERT_FALSE(trie.erase(IpPrefix("10.3.0.0/16")));
+        ASSERT_EQ(vector<string>({ "0.0.0.0/0", "10.0.0.0/8", "10.1.2.0/24" }), covering(trie, "10.1.2.3"));
+        ASSERT_EQ(nullptr, trie.find(IpPrefix("10.1.0.0/16")));
+        ASSERT_EQ(24, *trie.find(IpPrefix("10.1.2.0/24")));
+        ASSERT_EQ(6u, trie.size());
+    }
+
+    TEST_F(PrefixTrieTest, CoveredPrefixes)
+    {
+        PrefixTrie<int> trie;
+        trie.insert(IpPrefix("10.1.2.3"), 1);
+        trie.insert(IpPrefix("10.1.2.4"), 2);
+        trie.insert(IpPrefix("10.1.3.1"), 3);
+        trie.insert(IpPrefix("10.2.0.1"), 4);
+        trie.insert(IpPrefix("2000::1"), 5);
+
+        ASSERT_EQ(vector<string>({ "10.1.2.3/32", "10.1.2.4/32" }), covered(trie, "10.1.2.0/24"));
+        ASSERT_EQ(vector<string>({ "10.1.2.3/32", "10.1.2.4/32", "10.1.3.1/32" }), covered(trie, "10.1.0.0/16"));
+        ASSERT_EQ(4u, covered(trie, "0.0.0.0/0").size());
+        ASSERT_EQ(vector<string>({ "10.2.0.1/32" }), covered(trie, "10.2.0.1/32"));
+        ASSERT_TRUE(covered(trie, "10.3.0.0/16").empty());
+        ASSERT_EQ(vector<string>({ "2000::1/128" }), covered(trie, "::/0"));
+
+        trie.clear();
+        ASSERT_TRUE(trie.empty());
+        ASSERT_TRUE(covered(trie, "0.0.0.0/0").empty());
+    }
+}
@@ -0,0 +1,221 @@
+#include "rateengine.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <string>
+
+namespace rateengine_test
+{
+    using namespace std;
+    using namespace swss;
+
+    static const string OBJECT_KEY = "oid:0x6000000000001";
+    static const uint32_t POLL_INTERVAL_MS = 1000;
+
+    // Replays the counters of consecutive polls on an engine. The expected fields are the ones
+    // <group>_rates.lua writes on the same counters
+    struct EngineHarness
+    {
+        EngineHarness(const string &group)
+        {
+            engine = RateEngine::create(group);
+            engine->setPollInterval(POLL_INTERVAL_MS);
+            engine->addObject(OBJECT_KEY);
+        }
+
+        void poll(double alpha = 0.5)
+        {
+            RateEngine::RatesUpdates updates;
+            engine->poll(now, alpha, [this](const string &key) -> const RateEngine::Counters *
+            {
+                auto it = counters.find(key);
+                return it == counters.end() ? nullptr : &it->second;
+            }, updates);
+
+            for (auto &update : updates)
+            {
+                for (auto &fv : update.second)
+                {
+                    rates[update.first][fvField(fv)] = fvValue(fv);
+                }
+            }
+
+            now += POLL_INTERVAL_MS;
+        }
+
+        void set(const string &field, uint64_t value, const string &key = OBJECT_KEY)
+        {
+            counters[key][field] = to_string(value);
+        }
+
+        string get(const string &field, const string &key = OBJECT_KEY)
+        {
+            return rates[key][field];
+        }
+
+        string initState(const string &key = OBJECT_KEY)
+        {
+            return rates[key + ":" + engine->getGroup()]["INIT_DONE"];
+        }
+
+        unique_ptr<RateEngine> engine;
+        map<string, RateEngine::Counters> counters;
+        map<string, map<string, string>> rates;
+        uint64_t now = 1000000;
+    };
+
+    TEST(RateEngineTest, Create)
+    {
+        ASSERT_TRUE(RateEngine::create("PORT") != nullptr);
+        ASSERT_TRUE(RateEngine::create("RIF") != nullptr);
+        ASSERT_TRUE(RateEngine::create("TRAP") != nullptr);
+        ASSERT_TRUE(RateEngine::create("TUNNEL") != nullptr);
+        ASSERT_TRUE(RateEngine::create("QUEUE") == nullptr);
+    }
+
+    TEST(RateEngineTest, RifRates)
+    {
+        EngineHarness h("RIF");
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS", 1000);
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_PACKETS", 10);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS", 2000);
+
+        // Nothing is done until all counters are there
+        h.poll();
+        ASSERT_TRUE(h.rates.empty());
+
+        // First run only records the counters
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS", 20);
+        h.poll();
+        ASSERT_EQ(h.initState(), "COUNTERS_LAST");
+        ASSERT_EQ(h.get("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last"), "1000");
+        ASSERT_EQ(h.get("RX_BPS"), "");
+
+        // The first rates are not smoothed
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS", 3000);
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_PACKETS", 30);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS", 2500);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS", 25);
+        h.poll();
+        ASSERT_EQ(h.initState(), "DONE");
+        ASSERT_EQ(h.get("RX_BPS"), "2000");
+        ASSERT_EQ(h.get("RX_PPS"), "20");
+        ASSERT_EQ(h.get("TX_BPS"), "500");
+        ASSERT_EQ(h.get("TX_PPS"), "5");
+        ASSERT_EQ(h.get("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last"), "3000");
+
+        // Then smoothed with alpha
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS", 4000);
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_PACKETS", 33);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS", 2500);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS", 25);
+        h.poll(0.2);
+        ASSERT_EQ(h.get("RX_BPS"), "1800");
+        ASSERT_EQ(h.get("RX_PPS"), "16.6");
+        ASSERT_EQ(h.get("TX_BPS"), "400");
+        ASSERT_EQ(h.get("TX_PPS"), "4");
+    }
+
+    TEST(RateEngineTest, CountersNotPolledYet)
+    {
+        EngineHarness h("RIF");
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS", 1000);
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_PACKETS", 10);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS", 1000);
+        h.set("SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS", 10);
+        h.poll();
+
+        // The counters were not polled again by syncd, the next sample covers two intervals
+        h.poll();
+        ASSERT_EQ(h.initState(), "COUNTERS_LAST");
+        h.set("SAI_ROUTER_INTERFACE_STAT_IN_OCTETS", 5000);
+        h.poll();
+        ASSERT_EQ(h.initState(), "DONE");
+        ASSERT_EQ(h.get("RX_BPS"), "2000");
+
+        // Idle counters still make a sample after two intervals
+        h.poll();
+        h.poll(1);
+        ASSERT_EQ(h.get("RX_BPS"), "0");
+    }
+
+    TEST(RateEngineTest, PortRatesAndFec)
+    {
+        EngineHarness h("PORT");
+        static_cast<PortRateEngine *>(h.engine.get())->setLineRate(OBJECT_KEY, 4, 100000);
+
+        auto set = [&](uint64_t octets, uint64_t ucast, uint64_t nonUcast, uint64_t corrected, uint64_t uncorrectable)
+        {
+            h.set("SAI_PORT_STAT_IF_IN_OCTETS", octets);
+            h.set("SAI_PORT_STAT_IF_OUT_OCTETS", octets);
+            h.set("SAI_PORT_STAT_IF_IN_UCAST_PKTS", ucast);
+            h.set("SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS", nonUcast);
+            h.set("SAI_PORT_STAT_IF_OUT_UCAST_PKTS", ucast);
+            h.set("SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS", nonUcast);
+            h.set("SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", corrected);
+            h.set("SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES", uncorrectable);
+        };
+
+        set(1000, 10, 1, 0, 0);
+        h.poll();
+        ASSERT_EQ(h.get("SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last"), "0");
+        ASSERT_EQ(h.get("FEC_PRE_BER"), "");
+
+        // PPS are of unicast and non unicast packets, BER over the 4 x 25.78125 Gb/s lanes
+        set(2000, 20, 3, 103125, 0);
+        h.set("SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S0", 5);
+        h.set("SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S3", 1);
+        h.set("SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S4", 0);
+        h.poll();
+        ASSERT_EQ(h.get("RX_BPS"), "1000");
+        ASSERT_EQ(h.get("RX_PPS"), "12");
+        ASSERT_EQ(h.get("TX_PPS"), "12");
+        ASSERT_EQ(h.get("FEC_PRE_BER"), "1e-06");
+        ASSERT_EQ(h.get("FEC_PRE_BER_MAX"), "1e-06");
+        ASSERT_EQ(h.get("FEC_POST_BER"), "0");
+        ASSERT_EQ(h.get("FEC_MAX_T"), "3");
+        ASSERT_EQ(h.get("SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last"), "0");
+
+        // The maximum pre FEC BER is kept
+        set(3000, 30, 5, 103125, 0);
+        h.poll();
+        ASSERT_EQ(h.get("FEC_PRE_BER"), "0");
+        ASSERT_EQ(h.get("FEC_PRE_BER_MAX"), "1e-06");
+    }
+
+    TEST(RateEngineTest, TrapMissingCountersAsZero)
+    {
+        EngineHarness h("TRAP");
+        h.poll();
+        ASSERT_EQ(h.initState(), "COUNTERS_LAST");
+        ASSERT_EQ(h.get("SAI_COUNTER_STAT_PACKETS_last"), "0");
+
+        h.set("SAI_COUNTER_STAT_PACKETS", 50);
+        h.poll();
+        ASSERT_EQ(h.get("RX_PPS"), "50");
+    }
+
+    TEST(RateEngineTest, RemoveObject)
+    {
+        static const string OTHER_KEY = "oid:0x6000000000002";
+
+        EngineHarness h("TUNNEL");
+        h.engine->addObject(OTHER_KEY);
+        h.set("SAI_TUNNEL_STAT_IN_PACKETS", 100, OTHER_KEY);
+        h.poll();
+        h.set("SAI_TUNNEL_STAT_IN_PACKETS", 300, OTHER_KEY);
+        h.poll();
+        ASSERT_EQ(h.get("RX_PPS", OTHER_KEY), "200");
+
+        // The other object keeps its state when it takes the place of the removed one
+        h.engine->removeObject(OBJECT_KEY);
+        ASSERT_EQ(h.engine->getObjects().size(), 1u);
+        h.rates.clear();
+        h.set("SAI_TUNNEL_STAT_IN_PACKETS", 400, OTHER_KEY);
+        h.poll(1);
+        ASSERT_EQ(h.get("RX_PPS", OTHER_KEY), "100");
+        ASSERT_TRUE(h.rates.find(OBJECT_KEY) == h.rates.end());
+
+        h.engine->clear();
+        ASSERT_TRUE(h.engine->getObjects().empty());
+    }
+}
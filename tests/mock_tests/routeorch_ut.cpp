@@ -846,27 +846,39 @@ namespace routeorch_test
     TEST_F(RouteOrchTest, RouteOrchSetItemNotFound)
     {
         IpPrefix prefix("1.1.1.0/32");
-        NextHopGroupKey nhg_key("10.0.0.2");
-        RouteNhg route_nhg(nhg_key, "");
-
-        gRouteOrch->m_syncdRoutes[gVirtualRouterId][prefix] = route_nhg;
 
         std::deque<KeyOpFieldsValuesTuple> entries;
         entries.push_back({"1.1.1.0/32", "SET", { {"ifname", "Ethernet0"},
-                                                  {"nexthop", "10.0.0.3"}}});
+                                                  {"nexthop", "10.0.0.2"}}});
 
         auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
         consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes.at(gVirtualRouterId).count(prefix), 1u);
+        ASSERT_NE(gRouteOrch->m_syncdRouteIndexes.at(gVirtualRouterId).find(prefix), nullptr);
+
+        entries.clear();
+        entries.push_back({"1.1.1.0/32", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.3"}}});
+        consumer->addToSync(entries);
 
         std::vector<sai_status_t> exp_status{SAI_STATUS_ITEM_NOT_FOUND};
         EXPECT_CALL(*mock_sai_route_api, set_route_entries_attribute)
             .WillOnce(DoAll(SetArrayArgument<4>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_ITEM_NOT_FOUND)));
         static_cast<Orch *>(gRouteOrch)->doTask();
 
+        /* The route missing in SAI is removed from the cache and its index */
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes.at(gVirtualRouterId).count(prefix), 0u);
+        ASSERT_EQ(gRouteOrch->m_syncdRouteIndexes.at(gVirtualRouterId).find(prefix), nullptr);
+
         exp_status = {SAI_STATUS_SUCCESS};
         EXPECT_CALL(*mock_sai_route_api, create_route_entries)
             .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
         static_cast<Orch *>(gRouteOrch)->doTask();
+
+        /* The route is created again and stays indexed */
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes.at(gVirtualRouterId).count(prefix), 1u);
+        ASSERT_NE(gRouteOrch->m_syncdRouteIndexes.at(gVirtualRouterId).find(prefix), nullptr);
     }
 
     /* Test default route DEL followed by SET scenario to verify bulker state handling */
@@ -1026,4 +1038,52 @@ namespace routeorch_test
         ASSERT_EQ(gRouteOrch->gRouteBulker.setting_entries_count(), 0);
         ASSERT_EQ(gRouteOrch->gRouteBulker.removing_entries_count(), 0);
     }
+
+    /* Routes with the same next hops share the next hop set of their key */
+    TEST_F(RouteOrchTest, RouteOrchSharedNextHopKeys)
+    {
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        auto before = gRouteOrch->getRouteTableMemoryUsage();
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (int i = 0; i < 16; i++)
+        {
+            entries.push_back({"30.0." + to_string(i) + ".0/24", "SET", { {"ifname", "Ethernet0"},
+                                                                         {"nexthop", "10.0.0.2"}}});
+            entries.push_back({"31.0." + to_string(i) + ".0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                                         {"nexthop", "10.0.0.2,10.0.0.3"}}});
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        const auto &routes = gRouteOrch->m_syncdRoutes.at(gVirtualRouterId);
+        const auto &nh = routes.at(IpPrefix("1.1.1.0/24")).nhg_key;
+        const auto &ecmp = routes.at(IpPrefix("31.0.0.0/24")).nhg_key;
+        ASSERT_EQ(2u, ecmp.getSize());
+        for (int i = 0; i < 16; i++)
+        {
+            ASSERT_EQ(&nh.getNextHops(), &routes.at(IpPrefix("30.0." + to_string(i) + ".0/24")).nhg_key.getNextHops());
+            ASSERT_EQ(&ecmp.getNextHops(), &routes.at(IpPrefix("31.0." + to_string(i) + ".0/24")).nhg_key.getNextHops());
+        }
+        ASSERT_EQ(&ecmp.getNextHops(), &gRouteOrch->m_syncdNextHopGroups.find(ecmp)->first.getNextHops());
+
+        auto after = gRouteOrch->getRouteTableMemoryUsage();
+        ASSERT_EQ(before.routes + 32, after.routes);
+        ASSERT_EQ(before.nextHopSets + 1, after.nextHopSets);
+        ASSERT_GT(after.routeBytes, before.routeBytes);
+        ASSERT_GT(after.nextHopBytes, before.nextHopBytes);
+
+        entries.clear();
+        for (int i = 0; i < 16; i++)
+        {
+            entries.push_back({"30.0." + to_string(i) + ".0/24", "DEL", {}});
+            entries.push_back({"31.0." + to_string(i) + ".0/24", "DEL", {}});
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        auto removed = gRouteOrch->getRouteTableMemoryUsage();
+        ASSERT_EQ(before.routes, removed.routes);
+        ASSERT_EQ(before.nextHopSets, removed.nextHopSets);
+    }
 }
@@ -0,0 +1,108 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#include "watermarkorch.h"
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+namespace watermarkorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const string QUEUE_SHARED_WM = "SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES";
+    static const string PG_SHARED_WM = "SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES";
+    static const string PG_HEADROOM_WM = "SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES";
+
+    class WatermarkOrchTest : public MockOrchTest
+    {
+    protected:
+        void PostSetUp()
+        {
+            vector<string> tables = { CFG_WATERMARK_TABLE_NAME, CFG_FLEX_COUNTER_TABLE_NAME };
+            m_watermarkOrch = make_unique<WatermarkOrch>(m_config_db.get(), tables);
+
+            m_watermarkOrch->m_pg_ids = { 0x1a000000000001, 0x1a000000000002 };
+            m_watermarkOrch->m_unicast_queue_ids = { 0x15000000000001, 0x15000000000002 };
+            m_watermarkOrch->m_multicast_queue_ids = { 0x15000000000003 };
+            m_watermarkOrch->m_queue_ids = { 0x15000000000001, 0x15000000000002, 0x15000000000003 };
+
+            m_periodicTable = m_watermarkOrch->m_periodicWatermarkTable;
+            for (auto id : m_watermarkOrch->m_pg_ids)
+            {
+                m_periodicTable->set(sai_serialize_object_id(id), { { PG_SHARED_WM, "100" }, { PG_HEADROOM_WM, "200" } });
+            }
+            for (auto id : m_watermarkOrch->m_unicast_queue_ids)
+            {
+                m_periodicTable->set(sai_serialize_object_id(id), { { QUEUE_SHARED_WM, "300" } });
+            }
+            for (auto id : m_watermarkOrch->m_multicast_queue_ids)
+            {
+                m_periodicTable->set(sai_serialize_object_id(id), { { QUEUE_SHARED_WM, "400" } });
+            }
+        }
+
+        void PreTearDown()
+        {
+            m_watermarkOrch.reset();
+        }
+
+        string getWm(sai_object_id_t id, const string &wm)
+        {
+            string value;
+            if (!m_periodicTable->hget(sai_serialize_object_id(id), wm, value))
+            {
+                return "absent";
+            }
+            return value;
+        }
+
+        unique_ptr<WatermarkOrch> m_watermarkOrch;
+        shared_ptr<Table> m_periodicTable;
+    };
+
+    TEST_F(WatermarkOrchTest, ClearSingleWm)
+    {
+        auto &unicast = m_watermarkOrch->m_unicast_queue_ids;
+        m_watermarkOrch->clearSingleWm(m_periodicTable.get(), QUEUE_SHARED_WM, unicast);
+
+        ASSERT_EQ(getWm(unicast[0], QUEUE_SHARED_WM), "0");
+        ASSERT_EQ(getWm(unicast[1], QUEUE_SHARED_WM), "0");
+        ASSERT_EQ(getWm(m_watermarkOrch->m_multicast_queue_ids[0], QUEUE_SHARED_WM), "400");
+    }
+
+    TEST_F(WatermarkOrchTest, PeriodicClearModes)
+    {
+        auto pg = m_watermarkOrch->m_pg_ids[0];
+        auto queue = m_watermarkOrch->m_multicast_queue_ids[0];
+
+        // Each watermark is zeroed by default
+        m_watermarkOrch->clearPeriodicWms();
+        ASSERT_EQ(getWm(pg, PG_SHARED_WM), "0");
+        ASSERT_EQ(getWm(pg, PG_HEADROOM_WM), "0");
+        ASSERT_EQ(getWm(queue, QUEUE_SHARED_WM), "0");
+
+        m_watermarkOrch->handleWmConfigUpdate("TELEMETRY_INTERVAL", { { "periodic_clear_mode", "delete" } });
+        ASSERT_TRUE(m_watermarkOrch->m_periodicClearDelete);
+
+        // The entries are removed in delete mode
+        m_watermarkOrch->deletePeriodicWms();
+        ASSERT_EQ(getWm(pg, PG_SHARED_WM), "absent");
+        ASSERT_EQ(getWm(pg, PG_HEADROOM_WM), "absent");
+        ASSERT_EQ(getWm(queue, QUEUE_SHARED_WM), "absent");
+        ASSERT_EQ(getWm(m_watermarkOrch->m_unicast_queue_ids[1], QUEUE_SHARED_WM), "absent");
+
+        m_watermarkOrch->handleWmConfigUpdate("TELEMETRY_INTERVAL", { { "periodic_clear_mode", "invalid" } });
+        ASSERT_TRUE(m_watermarkOrch->m_periodicClearDelete);
+        m_watermarkOrch->handleWmConfigUpdate("TELEMETRY_INTERVAL", { { "periodic_clear_mode", "zero" } });
+        ASSERT_FALSE(m_watermarkOrch->m_periodicClearDelete);
+    }
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "recorder.h"
+
+using namespace std;
+using namespace swss;
+
+static vector<string> readLines(istream &in)
+{
+    vector<string> lines;
+    string line;
+    while (getline(in, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/* Strip the timestamp of a text record */
+static string recordValue(const string &line)
+{
+    auto pos = line.find('|');
+    return pos == string::npos ? line : line.substr(pos + 1);
+}
+
+static vector<string> recordValues(const vector<string> &lines)
+{
+    vector<string> values;
+    for (const auto &line : lines)
+    {
+        values.push_back(recordValue(line));
+    }
+    return values;
+}
+
+static string recordFile(const string &name)
+{
+    string fname = "./" + name;
+    unlink(fname.c_str());
+    return name;
+}
+
+TEST(recorder, text_sync)
+{
+    auto name = recordFile("recorder_ut_sync.rec");
+    {
+        RecWriter rec;
+        rec.setRecord(true);
+        rec.setRotate(false);
+        rec.setLocation(".");
+        rec.setFileName(name);
+        rec.startRec(false);
+        rec.record("ROUTE_TABLE:10.0.0.0/24|SET|nexthop:10.0.0.1");
+    }
+
+    ifstream in("./" + name);
+    auto values = recordValues(readLines(in));
+    EXPECT_EQ(values, vector<string>({"recording started", "ROUTE_TABLE:10.0.0.0/24|SET|nexthop:10.0.0.1"}));
+}
+
+TEST(recorder, text_async)
+{
+    auto name = recordFile("recorder_ut_async.rec");
+    vector<string> expected = {"recording started"};
+    {
+        RecWriter rec;
+        rec.setRecord(true);
+        rec.setRotate(false);
+        rec.setLocation(".");
+        rec.setFileName(name);
+        rec.setAsync(true);
+        rec.startRec(false);
+        for (int i = 0; i < 3000; i++)
+        {
+            string val = "ROUTE_TABLE:10.0." + to_string(i / 256) + "." + to_string(i % 256) + "/32|DEL";
+            expected.push_back(val);
+            rec.record(val);
+        }
+        rec.flush();
+
+        ifstream in("./" + name);
+        EXPECT_EQ(recordValues(readLines(in)), expected);
+
+        rec.record("ROUTE_TABLE:resync|SET");
+        expected.push_back("ROUTE_TABLE:resync|SET");
+    }
+
+    // the writer drains staged records on destruction
+    ifstream in("./" + name);
+    EXPECT_EQ(recordValues(readLines(in)), expected);
+}
+
+TEST(recorder, binary_to_text)
+{
+    auto name = recordFile("recorder_ut_binary.rec");
+    vector<string> expected = {"recording started"};
+
+    // text records written before switching to binary are kept
+    {
+        ofstream out("./" + name);
+        out << "2024-01-01.00:00:00.000000|PORT_TABLE:Ethernet0|SET|mtu:9100" << "\n";
+        expected.insert(expected.begin(), "PORT_TABLE:Ethernet0|SET|mtu:9100");
+    }
+
+    {
+        RecWriter rec;
+        rec.setRecord(true);
+        rec.setRotate(false);
+        rec.setLocation(".");
+        rec.setFileName(name);
+        rec.setAsync(true);
+        rec.setBinary(true);
+        rec.startRec(false);
+        rec.record("NEIGH_TABLE:Vlan1000:192.168.0.2|SET|neigh:00:11:22:33:44:55|family:IPv4");
+        rec.record(string("empty|value:"));
+        expected.push_back("NEIGH_TABLE:Vlan1000:192.168.0.2|SET|neigh:00:11:22:33:44:55|family:IPv4");
+        expected.push_back("empty|value:");
+    }
+
+    ifstream in("./" + name, ifstream::binary);
+    stringstream text;
+    ASSERT_TRUE(Recorder::binaryToText(in, text));
+
+    auto lines = readLines(text);
+    EXPECT_EQ(recordValues(lines), expected);
+
+    // converted timestamps have the same format as text records
+    for (const auto &line : lines)
+    {
+        EXPECT_EQ(line.find('|'), string("2024-01-01.00:00:00.000000").size());
+    }
+
+    // truncated binary record
+    stringstream truncated(Recorder::BINARY_MAGIC + string("\x01\x02", 2));
+    stringstream out;
+    EXPECT_FALSE(Recorder::binaryToText(truncated, out));
+}
@@ -438,6 +438,59 @@ class TestBufferMgrDyn(object):
 
         self.cleanup_db(dvs)
 
+    def check_headroom_against_lua(self, dvs, profile, speed, cable_length, mtu):
+        lanes = self.config_db.get_entry('PORT', 'Ethernet0')['lanes']
+        lane_count = len(lanes.split(','))
+        _, output = dvs.runcmd("redis-cli --eval /usr/share/swss/buffer_headroom_vs.lua {} , {} {} {} 0 {}".format(
+            profile, speed, cable_length, mtu, lane_count))
+        expected = dict(re.findall(r"(xon|xoff|size):([0-9]+)", output))
+        assert len(expected) == 3, "Unexpected output of the headroom lua plugin: {}".format(output)
+
+        self.app_db.wait_for_field_match("BUFFER_PROFILE_TABLE", profile, expected)
+
+    def test_headroomCalculationParity(self, dvs, testlog):
+        self.setup_db(dvs)
+
+        # Startup interface
+        dvs.port_admin_set('Ethernet0', 'up')
+
+        original_pattern = self.config_db.get_entry('LOSSLESS_TRAFFIC_PATTERN', 'AZURE')
+        expectedProfile = self.make_lossless_profile_name(self.originalSpeed, self.originalCableLen)
+
+        try:
+            # The headroom calculated by buffermgrd matches the one of the lua plugin
+            self.config_db.update_entry('BUFFER_PG', 'Ethernet0|3-4', {'profile': 'NULL'})
+            self.app_db.wait_for_entry("BUFFER_PROFILE_TABLE", expectedProfile)
+            self.check_headroom_against_lua(dvs, expectedProfile, self.originalSpeed, self.originalCableLen, '9100')
+
+            # Remove the lossless PG so that the profile is removed
+            self.config_db.delete_entry('BUFFER_PG', 'Ethernet0|3-4')
+            self.app_db.wait_for_deleted_entry("BUFFER_PROFILE_TABLE", expectedProfile)
+
+            # Update the lossless traffic pattern, the profile created from now on takes it
+            pattern = dict(original_pattern)
+            pattern['small_packet_percentage'] = '50'
+            self.config_db.update_entry('LOSSLESS_TRAFFIC_PATTERN', 'AZURE', pattern)
+
+            self.config_db.update_entry('BUFFER_PG', 'Ethernet0|3-4', {'profile': 'NULL'})
+            self.app_db.wait_for_entry("BUFFER_PROFILE_TABLE", expectedProfile)
+            self.check_headroom_against_lua(dvs, expectedProfile, self.originalSpeed, self.originalCableLen, '9100')
+
+            # The same for the cable length
+            self.change_cable_length(self.cableLenTest1)
+            expectedProfile = self.make_lossless_profile_name(self.originalSpeed, self.cableLenTest1)
+            self.app_db.wait_for_field_match("BUFFER_PG_TABLE", "Ethernet0:3-4", {"profile": expectedProfile})
+            self.check_headroom_against_lua(dvs, expectedProfile, self.originalSpeed, self.cableLenTest1, '9100')
+        finally:
+            # clear configuration
+            self.config_db.delete_entry('BUFFER_PG', 'Ethernet0|3-4')
+            self.config_db.update_entry('LOSSLESS_TRAFFIC_PATTERN', 'AZURE', original_pattern)
+
+            # Shutdown interface
+            dvs.port_admin_set('Ethernet0', 'down')
+
+            self.cleanup_db(dvs)
+
     def test_nonDefaultAlpha(self, dvs, testlog):
         self.setup_db(dvs)
 